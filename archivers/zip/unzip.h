@@ -262,6 +262,13 @@ extern z_off_t ZEXPORT unztell OF((unzFile file));
   Give the current position in uncompressed data
 */
 
+extern uLong ZEXPORT unzGetCurrentFileZStreamPos OF((unzFile file));
+/*
+  Give the absolute position of the compressed data of the current file
+  in the zipfile (file must be opened with unzOpenCurrentFile and not
+  read from yet)
+*/
+
 extern int ZEXPORT unzeof OF((unzFile file));
 /*
   return 1 if the end of file was reached, 0 elsewhere
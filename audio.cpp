@@ -50,6 +50,14 @@
 
 #include <math.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AUDIO_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define AUDIO_NEON 1
+#include <arm_neon.h>
+#endif
+
 #define DEBUG_AUDIO 0
 #define DEBUG_AUDIO2 0
 #define DEBUG_AUDIO_HACK 0
@@ -96,6 +104,14 @@ typedef struct {
 	int time, output;
 } sinc_queue_t;
 
+/* Paula BLEPs are shorter than one output sample period, a state change
+ * only affects the next output sample. Its weight (BLEP phase) is known
+ * when the change happens: it is added to per channel accumulators, one
+ * for each LED filter state, and the output sample needs no queue scan. */
+static uae_u32 sinc_next_sample;
+static const int *sinc_phase[2];
+static int sinc_acc[2][AUDIO_CHANNELS_PAULA];
+
 struct audio_channel_data2
 {
 	int current_sample, last_sample;
@@ -616,6 +632,8 @@ static void samplexx_anti_handler (int *datasp, int ch_start, int ch_num)
 
 static void sinc_prehandler_paula (unsigned long best_evtime)
 {
+	uae_u32 age = sinc_next_sample;
+
 	for (int i = 0; i < AUDIO_CHANNELS_PAULA; i++)  {
 		struct audio_channel_data2 *acd = audio_data[i];
 		int vol = acd->mixvol;
@@ -624,19 +642,66 @@ static void sinc_prehandler_paula (unsigned long best_evtime)
 		/* if output state changes, record the state change and also
 		 * write data into sinc queue for mixing in the BLEP */
 		if (acd->sinc_output_state != output) {
+			int delta = output - acd->sinc_output_state;
 			acd->sinc_queue_head = (acd->sinc_queue_head - 1) & (SINC_QUEUE_LENGTH - 1);
 			acd->sinc_queue[acd->sinc_queue_head].time = acd->sinc_queue_time;
-			acd->sinc_queue[acd->sinc_queue_head].output = output - acd->sinc_output_state;
+			acd->sinc_queue[acd->sinc_queue_head].output = delta;
 			acd->sinc_output_state = output;
+			if (age < SINC_QUEUE_MAX_AGE) {
+				sinc_acc[0][i] -= sinc_phase[0][age] * delta;
+				sinc_acc[1][i] -= sinc_phase[1][age] * delta;
+			}
 		}
 
 		acd->sinc_queue_time += best_evtime;
 	}
 }
 
+static void sinc_set_phase(void)
+{
+	if (sound_use_filter_sinc) {
+		int n = (sound_use_filter_sinc == FILTER_MODEL_A500 || sound_use_filter_sinc == FILTER_MODEL_A500_FIXEDONLY) ? 0 : 2;
+		sinc_phase[0] = winsinc_integral[n];
+		sinc_phase[1] = winsinc_integral[n + 1];
+	} else {
+		sinc_phase[0] = sinc_phase[1] = winsinc_integral[4];
+	}
+	memset(sinc_acc, 0, sizeof sinc_acc);
+}
+
+/* all Paula channels in one pass: BLEP sum, >> 15 and clip to 16 bits */
+static void sinc_mix_paula(int *datasp)
+{
+	int state[AUDIO_CHANNELS_PAULA];
+	const int *acc = sinc_acc[led_filter_on ? 1 : 0];
+
+	for (int i = 0; i < AUDIO_CHANNELS_PAULA; i++) {
+		state[i] = audio_data[i]->sinc_output_state;
+	}
+#if defined(AUDIO_SSE2)
+	__m128i v = _mm_add_epi32(_mm_slli_epi32(_mm_loadu_si128((const __m128i*)state), 17), _mm_loadu_si128((const __m128i*)acc));
+	v = _mm_srai_epi32(v, 15);
+	v = _mm_packs_epi32(v, v);
+	_mm_storeu_si128((__m128i*)datasp, _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16));
+#elif defined(AUDIO_NEON)
+	int32x4_t v = vaddq_s32(vshlq_n_s32(vld1q_s32(state), 17), vld1q_s32(acc));
+	vst1q_s32(datasp, vmovl_s16(vqmovn_s32(vshrq_n_s32(v, 15))));
+#else
+	for (int i = 0; i < AUDIO_CHANNELS_PAULA; i++) {
+		int v = ((state[i] << 17) + acc[i]) >> 15;
+		if (v > 32767)
+			v = 32767;
+		else if (v < -32768)
+			v = -32768;
+		datasp[i] = v;
+	}
+#endif
+	memset(sinc_acc, 0, sizeof sinc_acc);
+}
+
 /* this interpolator performs BLEP mixing (bleps are shaped like integrated sinc
 * functions) with a type of BLEP that matches the filtering configuration. */
-static void samplexx_sinc_handler (int *datasp, int ch_start, int ch_num)
+static void sinc_queue_handler (int *datasp, int ch_start, int ch_num)
 {
 	int n, i, k;
 	int const *winsinc;
@@ -674,6 +739,148 @@ static void samplexx_sinc_handler (int *datasp, int ch_start, int ch_num)
     }
 }
 
+static void samplexx_sinc_handler (int *datasp, int ch_start, int ch_num)
+{
+	// accumulated BLEPs are valid if output samples are at least one BLEP apart
+	if (ch_start == 0 && ch_num == AUDIO_CHANNELS_PAULA && scaled_sample_evtime >= SINC_QUEUE_MAX_AGE + 1) {
+		sinc_mix_paula(datasp);
+		return;
+	}
+	sinc_queue_handler(datasp, ch_start, ch_num);
+	if (ch_start == 0) {
+		memset(sinc_acc, 0, sizeof sinc_acc);
+	}
+}
+
+#ifdef DEBUGGER
+
+static uae_u32 sincbench_seed;
+static uae_u32 sincbench_rand(void)
+{
+	sincbench_seed = sincbench_seed * 1103515245 + 12345;
+	return sincbench_seed >> 8;
+}
+
+// Random Paula activity, same event loop as update_audio(). Changes are
+// either far apart or in short bursts so that several BLEPs overlap.
+// mode 0: compare queue and accumulator output, 1: queue only, 2: accumulator only.
+static int sincbench_run(int samples, float evtime, int mode, int *maxdiff)
+{
+	float next = evtime;
+	int errors = 0;
+	int done = 0;
+	uae_u32 burst = 0;
+
+	while (done < samples) {
+		uae_u32 rounded = (uae_u32)floorf(next);
+		if (next - rounded >= 0.5)
+			rounded++;
+		uae_u32 gap = burst ? 1 + sincbench_rand() % 600 : 1 + sincbench_rand() % (uae_u32)(evtime * 2);
+		if (burst)
+			burst--;
+		else if ((sincbench_rand() & 7) == 0)
+			burst = sincbench_rand() % 8;
+		uae_u32 best = gap < rounded ? gap : rounded;
+
+		int ch = sincbench_rand() % AUDIO_CHANNELS_PAULA;
+		struct audio_channel_data2 *acd = audio_data[ch];
+		acd->current_sample = (uae_s8)sincbench_rand();
+		if ((sincbench_rand() & 15) == 0)
+			acd->mixvol = sincbench_rand() % 65;
+
+		next -= best;
+		sinc_next_sample = rounded;
+		sinc_prehandler_paula(best);
+		if (rounded == best) {
+			next += evtime;
+			int datas[AUDIO_CHANNELS_PAULA], ref[AUDIO_CHANNELS_PAULA];
+			if (mode != 2)
+				sinc_queue_handler(ref, 0, AUDIO_CHANNELS_PAULA);
+			if (mode != 1)
+				sinc_mix_paula(datas);
+			else
+				memset(sinc_acc, 0, sizeof sinc_acc);
+			if (mode == 0) {
+				bool bad = false;
+				for (int i = 0; i < AUDIO_CHANNELS_PAULA; i++) {
+					int d = abs(datas[i] - ref[i]);
+					if (d > *maxdiff)
+						*maxdiff = d;
+					if (d)
+						bad = true;
+				}
+				if (bad)
+					errors++;
+			}
+			done++;
+		}
+	}
+	return errors;
+}
+
+void audio_benchmark(int rounds)
+{
+	static const int rates[] = { 22050, 44100, 48000, 96000 };
+	static const int filters[] = { 0, FILTER_MODEL_A500, FILTER_MODEL_A1200 };
+	struct audio_channel_data2 *old_data[AUDIO_CHANNELS_PAULA];
+	struct audio_channel_data2 *tmp = xcalloc(struct audio_channel_data2, AUDIO_CHANNELS_PAULA);
+	int old_filter = sound_use_filter_sinc, old_led = led_filter_on;
+	int old_acc[2][AUDIO_CHANNELS_PAULA];
+	const int *old_phase[2] = { sinc_phase[0], sinc_phase[1] };
+
+	if (rounds <= 0)
+		rounds = 20;
+	memcpy(old_acc, sinc_acc, sizeof sinc_acc);
+	for (int i = 0; i < AUDIO_CHANNELS_PAULA; i++) {
+		old_data[i] = audio_data[i];
+		audio_data[i] = &tmp[i];
+		tmp[i].adk_mask = 0xffffffff;
+		tmp[i].mixvol = 64;
+	}
+	float clk = (float)(currprefs.ntscmode ? CHIPSET_CLOCK_NTSC : CHIPSET_CLOCK_PAL) * CYCLE_UNIT;
+
+	// output of both mixers must match exactly
+	int tests = 0, errors = 0, maxdiff = 0;
+	sincbench_seed = 0x12345678;
+	for (int f = 0; f < sizeof filters / sizeof filters[0]; f++) {
+		for (int led = 0; led < 2; led++) {
+			for (int r = 0; r < sizeof rates / sizeof rates[0]; r++) {
+				sound_use_filter_sinc = filters[f];
+				led_filter_on = led;
+				sinc_set_phase();
+				errors += sincbench_run(20000, clk / rates[r], 0, &maxdiff);
+				tests += 20000;
+			}
+		}
+	}
+	console_out_f(_T("%d samples, %d mismatches, max difference %d.\n"), tests, errors, maxdiff);
+
+	// throughput in samples/s
+	sound_use_filter_sinc = FILTER_MODEL_A500;
+	led_filter_on = 0;
+	sinc_set_phase();
+	for (int mode = 1; mode <= 2; mode++) {
+		sincbench_seed = 0x12345678;
+		frame_time_t t1 = read_processor_time();
+		sincbench_run(rounds * 10000, clk / 48000, mode, &maxdiff);
+		frame_time_t t2 = read_processor_time();
+		double secs = (double)(t2 - t1) / syncbase;
+		console_out_f(_T("%s: %.0f samples/s\n"), mode == 1 ? _T("Sinc queue ") : _T("Accumulator"),
+			secs > 0 ? rounds * 10000 / secs : 0);
+	}
+
+	for (int i = 0; i < AUDIO_CHANNELS_PAULA; i++)
+		audio_data[i] = old_data[i];
+	xfree(tmp);
+	sound_use_filter_sinc = old_filter;
+	led_filter_on = old_led;
+	sinc_phase[0] = old_phase[0];
+	sinc_phase[1] = old_phase[1];
+	memcpy(sinc_acc, old_acc, sizeof sinc_acc);
+}
+
+#endif
+
 static void do_filter(int *data, int num)
 {
 	if (currprefs.sound_filter)
@@ -2310,6 +2517,7 @@ void set_audio (void)
 		sample_prehandler = sinc_prehandler_paula;
 		sound_use_filter_sinc = sound_use_filter;
 		sound_use_filter = 0;
+		sinc_set_phase();
 	} else if (sample_handler == sample16si_anti_handler || sample_handler == sample16i_anti_handler || sample_handler == sample16ss_anti_handler) {
 		sample_prehandler = anti_prehandler;
 	}
@@ -2429,6 +2637,7 @@ void update_audio (void)
 		next_sample_evtime -= best_evtime;
 
 		if (currprefs.produce_sound > 1) {
+			sinc_next_sample = rounded;
 			if (sample_prehandler)
 				sample_prehandler (best_evtime);
 			if (extra_sample_prehandler)
@@ -0,0 +1,407 @@
+/*
+* UAE - The Un*x Amiga Emulator
+*
+* Generic blitter minterm kernel
+*
+* Handles all 256 minterms, A/B shifts, first/last word masks, fill
+* and descending mode. Source rows are read into word buffers, shifted
+* and combined 8 (SSE2/NEON) or 4 (64-bit) words at a time and then
+* written back to chip RAM. Minterm functions are instantiated from
+* one template, there is no per word minterm switch.
+*/
+
+#include "sysconfig.h"
+#include "sysdeps.h"
+
+#include "options.h"
+#include "memory.h"
+#include "blitter.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BLITGEN_SSE2 1
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define BLITGEN_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(BLITGEN_SSE2)
+
+#define BLITGEN_LANES 8
+struct blitvec {
+	__m128i v;
+};
+STATIC_INLINE blitvec bv_make(__m128i v)
+{
+	blitvec r;
+	r.v = v;
+	return r;
+}
+STATIC_INLINE blitvec bv_load(const uae_u16 *p) { return bv_make(_mm_loadu_si128((const __m128i*)p)); }
+STATIC_INLINE void bv_store(uae_u16 *p, blitvec a) { _mm_storeu_si128((__m128i*)p, a.v); }
+STATIC_INLINE blitvec bv_zero(void) { return bv_make(_mm_setzero_si128()); }
+STATIC_INLINE blitvec operator&(blitvec a, blitvec b) { return bv_make(_mm_and_si128(a.v, b.v)); }
+STATIC_INLINE blitvec operator|(blitvec a, blitvec b) { return bv_make(_mm_or_si128(a.v, b.v)); }
+STATIC_INLINE blitvec operator~(blitvec a) { return bv_make(_mm_xor_si128(a.v, _mm_set1_epi32(-1))); }
+// shift counts 0 to 16, 16 clears all bits
+STATIC_INLINE blitvec bv_shl(blitvec a, int n) { return bv_make(_mm_sll_epi16(a.v, _mm_cvtsi32_si128(n))); }
+STATIC_INLINE blitvec bv_shr(blitvec a, int n) { return bv_make(_mm_srl_epi16(a.v, _mm_cvtsi32_si128(n))); }
+
+#elif defined(BLITGEN_NEON)
+
+#define BLITGEN_LANES 8
+struct blitvec {
+	uint16x8_t v;
+};
+STATIC_INLINE blitvec bv_make(uint16x8_t v)
+{
+	blitvec r;
+	r.v = v;
+	return r;
+}
+STATIC_INLINE blitvec bv_load(const uae_u16 *p) { return bv_make(vld1q_u16(p)); }
+STATIC_INLINE void bv_store(uae_u16 *p, blitvec a) { vst1q_u16(p, a.v); }
+STATIC_INLINE blitvec bv_zero(void) { return bv_make(vdupq_n_u16(0)); }
+STATIC_INLINE blitvec operator&(blitvec a, blitvec b) { return bv_make(vandq_u16(a.v, b.v)); }
+STATIC_INLINE blitvec operator|(blitvec a, blitvec b) { return bv_make(vorrq_u16(a.v, b.v)); }
+STATIC_INLINE blitvec operator~(blitvec a) { return bv_make(vmvnq_u16(a.v)); }
+STATIC_INLINE blitvec bv_shl(blitvec a, int n) { return bv_make(vshlq_u16(a.v, vdupq_n_s16(n))); }
+STATIC_INLINE blitvec bv_shr(blitvec a, int n) { return bv_make(vshlq_u16(a.v, vdupq_n_s16(-n))); }
+
+#else
+
+// four words in a 64-bit integer, shifts mask off bits crossing word boundaries
+#define BLITGEN_LANES 4
+#define BLITGEN_REP(x) ((uae_u64)(x) * 0x0001000100010001ULL)
+struct blitvec {
+	uae_u64 v;
+};
+STATIC_INLINE blitvec bv_make(uae_u64 v)
+{
+	blitvec r;
+	r.v = v;
+	return r;
+}
+STATIC_INLINE blitvec bv_load(const uae_u16 *p)
+{
+	uae_u64 v;
+	memcpy(&v, p, sizeof v);
+	return bv_make(v);
+}
+STATIC_INLINE void bv_store(uae_u16 *p, blitvec a) { memcpy(p, &a.v, sizeof a.v); }
+STATIC_INLINE blitvec bv_zero(void) { return bv_make(0); }
+STATIC_INLINE blitvec operator&(blitvec a, blitvec b) { return bv_make(a.v & b.v); }
+STATIC_INLINE blitvec operator|(blitvec a, blitvec b) { return bv_make(a.v | b.v); }
+STATIC_INLINE blitvec operator~(blitvec a) { return bv_make(~a.v); }
+STATIC_INLINE blitvec bv_shl(blitvec a, int n) { return bv_make((a.v << n) & BLITGEN_REP((0xffff << n) & 0xffff)); }
+STATIC_INLINE blitvec bv_shr(blitvec a, int n) { return bv_make((a.v >> n) & BLITGEN_REP(0xffff >> n)); }
+
+#endif
+
+// Minterm bit n is set if D is 1 when A = n & 4, B = n & 2, C = n & 1.
+// Unused terms drop out at compile time.
+template<int MT, typename V>
+STATIC_INLINE V blitgen_minterm(V a, V b, V c, V zero)
+{
+	V hi = zero, lo = zero;
+	if (MT & 0xf0) {
+		if (MT & 0x80)
+			hi = hi | (b & c);
+		if (MT & 0x40)
+			hi = hi | (b & ~c);
+		if (MT & 0x20)
+			hi = hi | (~b & c);
+		if (MT & 0x10)
+			hi = hi | (~b & ~c);
+		hi = hi & a;
+	}
+	if (MT & 0x0f) {
+		if (MT & 0x08)
+			lo = lo | (b & c);
+		if (MT & 0x04)
+			lo = lo | (b & ~c);
+		if (MT & 0x02)
+			lo = lo | (~b & c);
+		if (MT & 0x01)
+			lo = lo | (~b & ~c);
+		lo = lo & ~a;
+	}
+	return hi | lo;
+}
+
+typedef void blitgen_row_func(uae_u16*, const uae_u16*, const uae_u16*, const uae_u16*, int);
+
+template<int MT>
+static void blitgen_row(uae_u16 *d, const uae_u16 *a, const uae_u16 *b, const uae_u16 *c, int n)
+{
+	int i = 0;
+	blitvec zero = bv_zero();
+	for (; i + BLITGEN_LANES <= n; i += BLITGEN_LANES) {
+		bv_store(d + i, blitgen_minterm<MT, blitvec>(bv_load(a + i), bv_load(b + i), bv_load(c + i), zero));
+	}
+	for (; i < n; i++) {
+		d[i] = (uae_u16)blitgen_minterm<MT, uae_u32>(a[i], b[i], c[i], 0);
+	}
+}
+
+#define BLITGEN_ROW4(n) blitgen_row<(n)>, blitgen_row<(n) + 1>, blitgen_row<(n) + 2>, blitgen_row<(n) + 3>
+#define BLITGEN_ROW16(n) BLITGEN_ROW4(n), BLITGEN_ROW4((n) + 4), BLITGEN_ROW4((n) + 8), BLITGEN_ROW4((n) + 12)
+#define BLITGEN_ROW64(n) BLITGEN_ROW16(n), BLITGEN_ROW16((n) + 16), BLITGEN_ROW16((n) + 32), BLITGEN_ROW16((n) + 48)
+
+static blitgen_row_func *const blitgen_rows[256] = {
+	BLITGEN_ROW64(0x00), BLITGEN_ROW64(0x40), BLITGEN_ROW64(0x80), BLITGEN_ROW64(0xc0)
+};
+
+// p[0] = previous word, p[1..n] = row words. Replaced in place with
+// p[i] = (hi << (16 - s)) | (lo >> s), hi:lo = p[i]:p[i + 1] ascending
+// or p[i + 1]:p[i] descending.
+static void blitgen_shift(uae_u16 *p, int n, int s, bool desc)
+{
+	int i = 0;
+	if (!desc) {
+		for (; i + BLITGEN_LANES <= n; i += BLITGEN_LANES) {
+			bv_store(p + i, bv_shl(bv_load(p + i), 16 - s) | bv_shr(bv_load(p + i + 1), s));
+		}
+		for (; i < n; i++) {
+			p[i] = (uae_u16)((((uae_u32)p[i] << 16) | p[i + 1]) >> s);
+		}
+	} else {
+		for (; i + BLITGEN_LANES <= n; i += BLITGEN_LANES) {
+			bv_store(p + i, bv_shl(bv_load(p + i + 1), 16 - s) | bv_shr(bv_load(p + i), s));
+		}
+		for (; i < n; i++) {
+			p[i] = (uae_u16)((((uae_u32)p[i + 1] << 16) | p[i]) >> s);
+		}
+	}
+}
+
+// Channel address range must be inside linear chip RAM.
+static bool blitgen_range(uaecptr pt, int mod, int h, int v, bool desc, uae_u32 limit)
+{
+	if (!pt) {
+		return true;
+	}
+	if ((pt | mod) & 1) {
+		return false;
+	}
+	uae_s64 row = (uae_s64)(h * 2 + mod) * (desc ? -1 : 1);
+	uae_s64 first = pt;
+	uae_s64 last = first + row * (v - 1);
+	uae_s64 lo = first < last ? first : last;
+	uae_s64 hi = first < last ? last : first;
+	if (desc) {
+		lo -= (h - 1) * 2;
+	} else {
+		hi += (h - 1) * 2;
+	}
+	// pointer 0 disables the channel in the word loop
+	return lo > 0 && hi + 2 <= limit;
+}
+
+// Rows read all source words before D of the same row is written, the
+// per word loop writes D one word behind its reads. Results only differ
+// if a source word reads a D word written two or more words earlier in
+// the same row.
+static bool blitgen_hazard(uaecptr pts, int mods, uaecptr ptd, int modd, int h, int v, bool desc)
+{
+	if (!pts || !ptd || h < 3) {
+		return false;
+	}
+	uae_s64 delta = desc ? (uae_s64)pts - ptd : (uae_s64)ptd - pts;
+	if (mods == modd) {
+		v = 1;
+	}
+	for (int j = 0; j < v; j++) {
+		if (delta >= 4 && delta <= (h - 1) * 2) {
+			return true;
+		}
+		delta += modd - mods;
+	}
+	return false;
+}
+
+static uae_u16 blitgen_a[BLITTER_MAX_WORDS + 1];
+static uae_u16 blitgen_b[BLITTER_MAX_WORDS + 1];
+static uae_u16 blitgen_c[BLITTER_MAX_WORDS];
+static uae_u16 blitgen_d[BLITTER_MAX_WORDS];
+
+STATIC_INLINE uae_u16 blitgen_get(uae_u8 *base, uaecptr addr)
+{
+	return do_get_mem_word((uae_u16*)(base + addr));
+}
+
+STATIC_INLINE void blitgen_put(uae_u8 *base, uaecptr addr, uae_u16 v)
+{
+	do_put_mem_word((uae_u16*)(base + addr), v);
+}
+
+// Same results as the word by word loop in blitter_dofast()/blitter_dofast_desc().
+// Returns false without doing anything if the blit can't be done in rows.
+bool blitter_generic(uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, struct bltinfo *bi, struct bltfill *fill, bool desc)
+{
+	int h = bi->hblitsize;
+	int v = bi->vblitsize;
+	if (h <= 0 || v <= 0 || h > BLITTER_MAX_WORDS) {
+		return false;
+	}
+	uae_u32 limit = chipmem_agnus_linear_size();
+	if (!limit) {
+		return false;
+	}
+	if (!blitgen_range(pta, bi->bltamod, h, v, desc, limit) || !blitgen_range(ptb, bi->bltbmod, h, v, desc, limit) ||
+		!blitgen_range(ptc, bi->bltcmod, h, v, desc, limit) || !blitgen_range(ptd, bi->bltdmod, h, v, desc, limit)) {
+		return false;
+	}
+	if (blitgen_hazard(pta, bi->bltamod, ptd, bi->bltdmod, h, v, desc) ||
+		blitgen_hazard(ptb, bi->bltbmod, ptd, bi->bltdmod, h, v, desc) ||
+		blitgen_hazard(ptc, bi->bltcmod, ptd, bi->bltdmod, h, v, desc)) {
+		return false;
+	}
+
+	uae_u8 *base = chipmem_bank.baseaddr;
+	bool usea = pta != 0, usec = ptc != 0;
+	blitgen_row_func *rowf = blitgen_rows[bi->bltcon0 & 0xff];
+	int step = desc ? -2 : 2;
+	int ash = bi->bltcon0 >> 12;
+	int bsh = bi->bltcon1 >> 12;
+	int as = desc ? 16 - ash : ash;
+	int bs = desc ? 16 - bsh : bsh;
+	int amod = desc ? -bi->bltamod : bi->bltamod;
+	int bmod = desc ? -bi->bltbmod : bi->bltbmod;
+	int cmod = desc ? -bi->bltcmod : bi->bltcmod;
+	int dmod = desc ? -bi->bltdmod : bi->bltdmod;
+	uae_u16 *a = blitgen_a, *b = blitgen_b, *c = blitgen_c, *d = blitgen_d;
+	const uae_u16 *sa, *sb;
+	uae_u16 adat = bi->bltadat, aold = bi->bltaold;
+	uae_u16 bdat = bi->bltbdat, bold = bi->bltbold, bhold = bi->bltbhold;
+	uae_u16 cdat = bi->bltcdat, ddat = bi->bltddat;
+	uae_u16 total = 0;
+	uaecptr dstp = 0;
+	bool dodst = false;
+	int fc = 0;
+
+	// shift 0: row words are used as they are
+	sa = (as == 0 || as == 16) ? a + 1 : a;
+	sb = (bs == 0 || bs == 16) ? b + 1 : b;
+	if (!ptb) {
+		sb = b;
+		for (int i = 0; i < h; i++) {
+			b[i] = bhold;
+		}
+	}
+	if (!ptc) {
+		for (int i = 0; i < h; i++) {
+			c[i] = cdat;
+		}
+	}
+
+	for (int j = 0; j < v; j++) {
+		// first word of each source is read before the delayed D write of the previous row
+		if (pta) {
+			adat = blitgen_get(base, pta);
+			pta += step;
+		}
+		a[1] = adat & blit_masktable[0];
+		if (ptb) {
+			b[1] = blitgen_get(base, ptb);
+			ptb += step;
+		}
+		if (ptc) {
+			c[0] = blitgen_get(base, ptc);
+			ptc += step;
+		}
+		if (dodst) {
+			blitgen_put(base, dstp, ddat);
+			dodst = false;
+		}
+		if (pta) {
+			for (int i = 1; i < h; i++) {
+				adat = blitgen_get(base, pta);
+				a[i + 1] = adat & blit_masktable[i];
+				pta += step;
+			}
+			pta += amod;
+		} else {
+			for (int i = 1; i < h; i++) {
+				a[i + 1] = adat & blit_masktable[i];
+			}
+		}
+		if (ptb) {
+			for (int i = 1; i < h; i++) {
+				b[i + 1] = blitgen_get(base, ptb);
+				ptb += step;
+			}
+			ptb += bmod;
+		}
+		if (ptc) {
+			for (int i = 1; i < h; i++) {
+				c[i] = blitgen_get(base, ptc);
+				ptc += step;
+			}
+			ptc += cmod;
+			cdat = c[h - 1];
+		}
+
+		a[0] = aold;
+		aold = a[h];
+		if (sa == a) {
+			blitgen_shift(a, h, as, desc);
+		}
+		if (ptb) {
+			b[0] = bold;
+			bold = bdat = b[h];
+			if (sb == b) {
+				blitgen_shift(b, h, bs, desc);
+			}
+			bhold = sb[h - 1];
+		}
+
+		rowf(d, sa, sb, c, h);
+
+		if (fill) {
+			int ifemode = fill->ifemode;
+			fc = fill->fc;
+			for (int i = 0; i < h; i++) {
+				uae_u16 dd = d[i];
+				int fc1 = fill->table[dd & 255][ifemode + fc][1];
+				d[i] = fill->table[dd & 255][ifemode + fc][0] + (fill->table[dd >> 8][ifemode + fc1][0] << 8);
+				fc = fill->table[dd >> 8][ifemode + fc1][1];
+			}
+		}
+
+		for (int i = 0; i < h; i++) {
+			total |= d[i];
+		}
+		if (ptd) {
+			for (int i = 0; i < h - 1; i++) {
+				blitgen_put(base, ptd, d[i]);
+				ptd += step;
+			}
+			dstp = ptd;
+			dodst = true;
+			ptd += step + dmod;
+		}
+		ddat = d[h - 1];
+	}
+	if (dodst) {
+		blitgen_put(base, dstp, ddat);
+	}
+
+	if (usea) {
+		bi->bltadat = adat;
+	}
+	bi->bltaold = aold;
+	bi->bltbold = bold;
+	bi->bltbhold = bhold;
+	// descending mode C reads also load BDAT
+	bi->bltbdat = (desc && usec) ? cdat : bdat;
+	bi->bltcdat = cdat;
+	bi->bltddat = ddat;
+	if (total) {
+		bi->blitzero = 0;
+	}
+	if (fill) {
+		fill->fc = fc;
+	}
+	return true;
+}
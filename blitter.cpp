@@ -477,6 +477,37 @@ static void blit_chipmem_agnus_wput(uaecptr addr, uae_u32 w, uae_u32 typemask)
 	}
 }
 
+#define BLIT_PATH_AUTO 0
+#define BLIT_PATH_WORD 1
+#define BLIT_PATH_GENERIC 2
+static int blit_fastpath;
+static int blit_generic_count;
+
+static bool blitter_dofast_generic(uaecptr pta, uaecptr ptb, uaecptr ptc, uaecptr ptd, bool desc)
+{
+	struct bltfill fill;
+
+	if (blit_fastpath == BLIT_PATH_WORD)
+		return false;
+	// D writes need to go through blit_chipmem_agnus_wput()
+	if (blit_fastpath == BLIT_PATH_AUTO && (blit_dof || (log_blitter & 4)))
+		return false;
+#ifdef DEBUGGER
+	if (blit_fastpath == BLIT_PATH_AUTO && memwatch_enabled)
+		return false;
+#endif
+	fill.table = blit_filltable;
+	fill.ifemode = blitife ? 2 : 0;
+	fill.fc = !!(blt_info.bltcon1 & BLTFC);
+	if (!blitter_generic(pta, ptb, ptc, ptd, &blt_info, blitfill ? &fill : NULL, desc))
+		return false;
+	blitfc = fill.fc;
+	if (ptd)
+		regs.chipset_latch_rw = blt_info.bltddat;
+	blit_generic_count++;
+	return true;
+}
+
 static void blitter_dofast(void)
 {
 	int i,j;
@@ -506,9 +537,9 @@ static void blitter_dofast(void)
 	}
 
 #if SPEEDUP
-	if (blitfunc_dofast[mt] && !blitfill) {
+	if (blit_fastpath == BLIT_PATH_AUTO && blitfunc_dofast[mt] && !blitfill) {
 		(*blitfunc_dofast[mt])(bltadatptr, bltbdatptr, bltcdatptr, bltddatptr, &blt_info);
-	} else
+	} else if (!blitter_dofast_generic(bltadatptr, bltbdatptr, bltcdatptr, bltddatptr, false))
 #endif
 	{
 		uae_u32 blitbhold = blt_info.bltbhold;
@@ -607,9 +638,9 @@ static void blitter_dofast_desc(void)
 		blt_info.bltdpt -= (blt_info.hblitsize * 2 + blt_info.bltdmod) * blt_info.vblitsize;
 	}
 #if SPEEDUP
-	if (blitfunc_dofast_desc[mt] && !blitfill) {
+	if (blit_fastpath == BLIT_PATH_AUTO && blitfunc_dofast_desc[mt] && !blitfill) {
 		(*blitfunc_dofast_desc[mt])(bltadatptr, bltbdatptr, bltcdatptr, bltddatptr, &blt_info);
-	} else
+	} else if (!blitter_dofast_generic(bltadatptr, bltbdatptr, bltcdatptr, bltddatptr, true))
 #endif
 	{
 		uae_u32 blitbhold = blt_info.bltbhold;
@@ -925,49 +956,202 @@ static void blitter_doblit_last(void)
 	blt_info.bltddat = ddat;
 }
 
-// immediate blit
-static void actually_do_blit(void)
+static void blitter_line_stepper(void)
 {
-	if (blitline) {
-		do {
-			blitter_line_proc_status();
-			blitter_line_proc_apt();
-			if (blt_info.hblitsize > 1) {
-				blitter_line_read_b();
-				blitter_line_read_c();
-				blitter_line_minterm(BLITTER_PIPELINE_FIRST);
-				blitter_doblit_last();
-				blitter_line_proc_cpt_x();
+	do {
+		blitter_line_proc_status();
+		blitter_line_proc_apt();
+		if (blt_info.hblitsize > 1) {
+			blitter_line_read_b();
+			blitter_line_read_c();
+			blitter_line_minterm(BLITTER_PIPELINE_FIRST);
+			blitter_doblit_last();
+			blitter_line_proc_cpt_x();
+		}
+		if (blt_info.hblitsize > 2) {
+			if (blitlineloop && !(blt_info.bltcon1 & BLTSUD)) {
+				blitter_line_proc_cpt_y();
+				blitlineloop = 0;
+			}
+			blitter_line_read_c();
+			blitter_line_minterm_extra();
+			blitter_doblit_last();
+		}
+		blitter_line_adat();
+		blitter_line_ovf();
+		if (blt_info.hblitsize >= 2) {
+			if (blitlineloop) {
+				blitter_line_proc_cpt_y();
+				blitlineloop = 0;
 			}
-			if (blt_info.hblitsize > 2) {
-				if (blitlineloop && !(blt_info.bltcon1 & BLTSUD)) {
-					blitter_line_proc_cpt_y();
-					blitlineloop = 0;
+		}
+		blitter_line_sign();
+		blitter_nxline();
+		if (blitlinepixel) {
+			blitter_line_write();
+			blitlinepixel = 0;
+		}
+		blt_info.bltdpt = blt_info.bltcpt;
+		blitter_line_minterm(BLITTER_PIPELINE_FIRST | BLITTER_PIPELINE_LAST);
+		blitter_doblit_last();
+		blitlineloop = 1;
+		blt_info.vblitsize--;
+	} while (blt_info.vblitsize != 0);
+}
+
+STATIC_INLINE uae_u16 blitter_line_get(uaecptr addr, uae_u8 *base, uae_u32 limit)
+{
+	if (addr < limit && !(addr & 1))
+		return do_get_mem_word((uae_u16*)(base + addr));
+	return chipmem_wget_indirect(addr);
+}
+
+// Immediate line draw with blitter state kept in locals. Same results
+// as blitter_line_stepper() and the blitter_line_* step functions.
+static bool blitter_line_fast(void)
+{
+	if (blit_fastpath == BLIT_PATH_WORD || blitfill || blt_info.vblitsize <= 0)
+		return false;
+	// D writes need to go through blit_chipmem_agnus_wput()
+	if (blit_fastpath == BLIT_PATH_AUTO && (blit_dof || (log_blitter & 4)))
+		return false;
+#ifdef DEBUGGER
+	if (blit_fastpath == BLIT_PATH_AUTO && (memwatch_enabled || debug_dma))
+		return false;
+#endif
+
+	uae_u8 *base = chipmem_bank.baseaddr;
+	uae_u32 limit = chipmem_agnus_linear_size();
+	uae_u16 con0 = blt_info.bltcon0, con1 = blt_info.bltcon1;
+	uae_u8 mt = con0 & 0xff;
+	bool cha = (con0 & BLTCHA) != 0, chb = (con0 & BLTCHB) != 0, chc = (con0 & BLTCHC) != 0;
+	bool sud = (con1 & BLTSUD) != 0, sul = (con1 & BLTSUL) != 0, aul = (con1 & BLTAUL) != 0;
+	bool sing = (con1 & BLTSING) != 0;
+	bool sign = (con1 & BLTSIGN) != 0;
+	int ash = con0 >> 12, bsh = con1 >> 12;
+	int h = blt_info.hblitsize;
+	int count = blt_info.vblitsize;
+	uaecptr apt = blt_info.bltapt, bpt = blt_info.bltbpt, cpt = blt_info.bltcpt, dpt = blt_info.bltdpt;
+	uae_s16 amod = blt_info.bltamod, bmod = blt_info.bltbmod, cmod = blt_info.bltcmod;
+	uae_u16 adat = blt_info.bltadat, afwm = blt_info.bltafwm, alwm = blt_info.bltalwm;
+	uae_u16 bdat = blt_info.bltbdat, bold = blt_info.bltbold, cdat = blt_info.bltcdat, ddat = blt_info.bltddat;
+	uae_u16 aold = blt_info.bltaold, bhold = blt_info.bltbhold, ahold = blt_info.bltahold2;
+	uae_u16 bb = blineb;
+	uae_u16 total = 0;
+	uae_u32 latch = regs.chipset_latch_rw;
+	int onedot = blitonedot, pixel = blitlinepixel, loop = blitlineloop, ovf = blit_ovf;
+
+	do {
+		pixel = !sing || !onedot;
+		onedot = 1;
+		if (cha)
+			apt += sign ? bmod : amod;
+		if (h > 1) {
+			if (chb) {
+				latch = bdat = blitter_line_get(bpt, base, limit);
+				bpt += bmod;
+			}
+			if (chc)
+				latch = cdat = blitter_line_get(cpt, base, limit);
+			ahold = (adat & afwm) >> ash;
+			if (chb)
+				bb = (((uae_u32)bold << 16) | bdat) >> bsh;
+			bhold = (bb & 0x0001) ? 0xFFFF : 0;
+			ddat = blit_func(ahold, bhold, cdat, mt) & 0xFFFF;
+			total |= ddat;
+			// x step: SUD set = always, otherwise if sign clear
+			if (sud || !sign) {
+				if (sud ? aul : sul) {
+					if (ash == 0)
+						cpt -= 2;
+					ovf = -1;
+				} else {
+					if (ash == 15)
+						cpt += 2;
+					ovf = 1;
 				}
-				blitter_line_read_c();
-				blitter_line_minterm_extra();
-				blitter_doblit_last();
 			}
-			blitter_line_adat();
-			blitter_line_ovf();
-			if (blt_info.hblitsize >= 2) {
-				if (blitlineloop) {
-					blitter_line_proc_cpt_y();
-					blitlineloop = 0;
+		}
+		if (h > 2) {
+			if (loop && !sud) {
+				if (chc) {
+					cpt += aul ? -cmod : cmod;
+					onedot = 0;
 				}
+				loop = 0;
 			}
-			blitter_line_sign();
-			blitter_nxline();
-			if (blitlinepixel) {
-				blitter_line_write();
-				blitlinepixel = 0;
+			if (chc)
+				latch = cdat = blitter_line_get(cpt, base, limit);
+			ahold = adat >> ash;
+			ddat = blit_func(ahold, bhold, cdat, mt) & 0xFFFF;
+			total |= ddat;
+		}
+		aold = (((uae_u32)aold << 16) | (adat & afwm)) >> ash;
+		ash = (ash + ovf) & 15;
+		ovf = 0;
+		if (h >= 2 && loop) {
+			// y step: SUD clear = always, otherwise if sign clear
+			if ((!sud || !sign) && chc) {
+				cpt += (sud ? sul : aul) ? -cmod : cmod;
+				onedot = 0;
 			}
-			blt_info.bltdpt = blt_info.bltcpt;
-			blitter_line_minterm(BLITTER_PIPELINE_FIRST | BLITTER_PIPELINE_LAST);
-			blitter_doblit_last();
-			blitlineloop = 1;
-			blt_info.vblitsize--;
-		} while (blt_info.vblitsize != 0);
+			loop = 0;
+		}
+		sign = (uae_s16)apt < 0;
+		bsh = (bsh - 1) & 15;
+		bb = (bdat >> bsh) | (bdat << (16 - bsh));
+		if (pixel) {
+			if (chc) {
+				if (dpt < limit && !(dpt & 1))
+					do_put_mem_word((uae_u16*)(base + dpt), ddat);
+				else
+					chipmem_wput_indirect(dpt, ddat);
+				latch = ddat;
+			}
+			pixel = 0;
+		}
+		dpt = cpt;
+		ahold = (adat & afwm & alwm) >> ash;
+		if (chb)
+			bb = (((uae_u32)bold << 16) | bdat) >> bsh;
+		bhold = (bb & 0x0001) ? 0xFFFF : 0;
+		ddat = blit_func(ahold, bhold, cdat, mt) & 0xFFFF;
+		total |= ddat;
+		loop = 1;
+	} while (--count != 0);
+
+	blt_info.bltcon0 = (con0 & 0x0fff) | (ash << 12);
+	blt_info.bltcon1 = (con1 & 0x0fff & ~BLTSIGN) | (sign ? BLTSIGN : 0) | (bsh << 12);
+	blt_info.bltapt = apt;
+	blt_info.bltbpt = bpt;
+	blt_info.bltcpt = cpt;
+	blt_info.bltdpt = dpt;
+	blt_info.bltbdat = bdat;
+	blt_info.bltcdat = cdat;
+	blt_info.bltddat = ddat;
+	blt_info.bltaold = aold;
+	blt_info.bltbhold = bhold;
+	blt_info.bltahold2 = ahold;
+	blt_info.bltbhold2 = bhold;
+	blt_info.bltchold2 = cdat;
+	blt_info.vblitsize = 0;
+	if (total)
+		blt_info.blitzero = 0;
+	blineb = bb;
+	blitonedot = onedot;
+	blitlinepixel = pixel;
+	blitlineloop = loop;
+	blit_ovf = ovf;
+	regs.chipset_latch_rw = latch;
+	return true;
+}
+
+// immediate blit
+static void actually_do_blit(void)
+{
+	if (blitline) {
+		if (!blitter_line_fast())
+			blitter_line_stepper();
 	} else {
 		if (blitdesc)
 			blitter_dofast_desc();
@@ -977,6 +1161,317 @@ static void actually_do_blit(void)
 	blt_info.blit_main = 0;
 }
 
+#ifdef DEBUGGER
+
+// Blitter fast path benchmark, uses and restores a block of chip RAM.
+// Generic kernel results are checked against the word by word loop,
+// line mode fast path against blitter_line_stepper().
+
+#define BLITBENCH_BASE 0x10000
+#define BLITBENCH_CHSIZE 0x8000
+#define BLITBENCH_SIZE (BLITBENCH_CHSIZE * 4)
+
+static uae_u32 blitbench_seed;
+
+static uae_u32 blitbench_rand(void)
+{
+	blitbench_seed = blitbench_seed * 1103515245 + 12345;
+	return blitbench_seed >> 8;
+}
+
+static void blitbench_setup(uae_u16 con0, uae_u16 con1, int h, int v, int mod, bool cd)
+{
+	bool desc = (con1 & BLTDESC) != 0;
+
+	blt_info.bltcon0 = con0;
+	blt_info.bltcon1 = con1;
+	blt_info.hblitsize = h;
+	blt_info.vblitsize = v;
+	blt_info.bltamod = blt_info.bltbmod = blt_info.bltcmod = blt_info.bltdmod = mod;
+	if (desc) {
+		blt_info.bltapt = BLITBENCH_BASE + 1 * BLITBENCH_CHSIZE - 2;
+		blt_info.bltbpt = BLITBENCH_BASE + 2 * BLITBENCH_CHSIZE - 2;
+		blt_info.bltcpt = BLITBENCH_BASE + 3 * BLITBENCH_CHSIZE - 2;
+		blt_info.bltdpt = BLITBENCH_BASE + 4 * BLITBENCH_CHSIZE - 2;
+	} else {
+		blt_info.bltapt = BLITBENCH_BASE + 0 * BLITBENCH_CHSIZE;
+		blt_info.bltbpt = BLITBENCH_BASE + 1 * BLITBENCH_CHSIZE;
+		blt_info.bltcpt = BLITBENCH_BASE + 2 * BLITBENCH_CHSIZE;
+		blt_info.bltdpt = BLITBENCH_BASE + 3 * BLITBENCH_CHSIZE;
+	}
+	// in place C/D as in cookie cut blits
+	if (cd)
+		blt_info.bltdpt = blt_info.bltcpt;
+	blitfill = (con1 & BLTFILL) != 0;
+	blitife = !!(con1 & BLTIFE);
+	blitfc = !!(con1 & BLTFC);
+}
+
+static void blitbench_run(int path)
+{
+	blit_fastpath = path;
+	if (blt_info.bltcon1 & BLTDESC)
+		blitter_dofast_desc();
+	else
+		blitter_dofast();
+	blit_fastpath = BLIT_PATH_AUTO;
+}
+
+static bool blitbench_compare(const struct bltinfo *r, int rfc)
+{
+	return r->bltadat == blt_info.bltadat && r->bltbdat == blt_info.bltbdat && r->bltcdat == blt_info.bltcdat &&
+		r->bltddat == blt_info.bltddat && r->bltaold == blt_info.bltaold && r->bltbold == blt_info.bltbold &&
+		r->bltbhold == blt_info.bltbhold && r->blitzero == blt_info.blitzero && rfc == blitfc &&
+		r->bltapt == blt_info.bltapt && r->bltbpt == blt_info.bltbpt && r->bltcpt == blt_info.bltcpt && r->bltdpt == blt_info.bltdpt;
+}
+
+static double blitbench_time(int path, uae_u16 con0, int h, int v, int rounds)
+{
+	frame_time_t t1 = read_processor_time();
+	for (int i = 0; i < rounds; i++) {
+		blitbench_setup(con0, 0, h, v, 0, false);
+		blitbench_run(path);
+	}
+	frame_time_t t2 = read_processor_time();
+	double secs = (double)(t2 - t1) / syncbase;
+	return secs > 0 ? (double)h * v * rounds / secs / 1000000.0 : 0;
+}
+
+// Random line in the middle of the test block, set up like graphics.library
+// does but with random octant, SING, OVF, shifts, minterm and B channel.
+static void blitbench_line_setup(int len)
+{
+	int dmax = len >= 0 ? len : blitbench_rand() % 200;
+	int dmin = blitbench_rand() % (dmax + 1);
+	int x = 160 + blitbench_rand() % 320;
+	uae_s16 err = 4 * dmin - 2 * dmax;
+
+	blt_info.bltcon0 = ((x & 15) << 12) | BLTCHA | BLTCHC | BLTCHD;
+	if (len < 0) {
+		blt_info.bltcon0 |= (blitbench_rand() & 3) ? ((blitbench_rand() & 1) ? 0xca : 0x4a) : (blitbench_rand() & 0xff);
+		if (!(blitbench_rand() & 7))
+			blt_info.bltcon0 |= BLTCHB;
+		blt_info.bltcon1 = ((blitbench_rand() & 15) << 12) | (blitbench_rand() & (BLTSUD | BLTSUL | BLTAUL | BLTSING | BLTOVF));
+		blt_info.hblitsize = (blitbench_rand() & 3) ? 2 : 1 + blitbench_rand() % 4;
+		blt_info.bltafwm = (blitbench_rand() & 3) ? 0xffff : (uae_u16)blitbench_rand();
+		blt_info.bltalwm = (blitbench_rand() & 3) ? 0xffff : (uae_u16)blitbench_rand();
+	} else {
+		blt_info.bltcon0 |= 0xca;
+		blt_info.bltcon1 = BLTSUD;
+		blt_info.hblitsize = 2;
+		blt_info.bltafwm = blt_info.bltalwm = 0xffff;
+	}
+	blt_info.bltcon1 |= BLTLINE | (err < 0 ? BLTSIGN : 0);
+	blt_info.vblitsize = dmax + 1;
+	blt_info.bltapt = (uae_u16)err;
+	blt_info.bltamod = 4 * (dmin - dmax);
+	blt_info.bltbmod = 4 * dmin;
+	blt_info.bltcmod = blt_info.bltdmod = 80;
+	blt_info.bltbpt = BLITBENCH_BASE;
+	blt_info.bltcpt = blt_info.bltdpt = BLITBENCH_BASE + BLITBENCH_SIZE / 2 + (x >> 4) * 2;
+	blt_info.bltadat = 0x8000;
+	blt_info.bltbdat = (len < 0 && (blitbench_rand() & 1)) ? (uae_u16)blitbench_rand() : 0xffff;
+	blt_info.bltcdat = (uae_u16)blitbench_rand();
+	blt_info.bltddat = (uae_u16)blitbench_rand();
+	blt_info.bltaold = 0;
+	blt_info.bltbold = 0;
+	blt_info.blitzero = 1;
+
+	int bshift = blt_info.bltcon1 >> 12;
+	blineb = (blt_info.bltbdat >> bshift) | (blt_info.bltbdat << (16 - bshift));
+	blitonedot = 0;
+	blitlinepixel = 0;
+	blitlineloop = 1;
+	blit_ovf = (blt_info.bltcon1 & BLTOVF) != 0;
+	blitline = 1;
+	blitfill = 0;
+}
+
+static void blitbench_line_run(int path)
+{
+	blit_fastpath = path;
+	actually_do_blit();
+	blit_fastpath = BLIT_PATH_AUTO;
+}
+
+static bool blitbench_line_compare(const struct bltinfo *r, uae_u16 rblineb, int rstate, uae_u32 rlatch)
+{
+	int state = blitonedot | (blitlinepixel << 1) | (blitlineloop << 2) | ((blit_ovf & 3) << 3);
+	return !memcmp(r, &blt_info, sizeof blt_info) && rblineb == blineb && rstate == state && rlatch == regs.chipset_latch_rw;
+}
+
+void blitter_benchmark(int rounds)
+{
+	static const int shapes[][2] = {
+		{ 1, 64 }, { 2, 16 }, { 3, 32 }, { 6, 64 }, { 20, 200 }, { 40, 256 }
+	};
+	static const uae_u8 minterms[] = { 0xf0, 0xca, 0x0a, 0x96, 0x1e, 0xe8 };
+	uae_u8 *chip = chipmem_bank.baseaddr + BLITBENCH_BASE;
+
+	if (blt_info.blit_main || blt_info.blit_pending) {
+		console_out(_T("Blitter is busy.\n"));
+		return;
+	}
+	if (chipmem_agnus_linear_size() < BLITBENCH_BASE + BLITBENCH_SIZE) {
+		console_out(_T("Chip RAM is not directly accessible.\n"));
+		return;
+	}
+	if (rounds <= 0)
+		rounds = 200;
+
+	struct bltinfo old_info = blt_info;
+	int old_fill = blitfill, old_ife = blitife, old_fc = blitfc, old_dof = blit_dof;
+	int old_line = blitline, old_onedot = blitonedot, old_pixel = blitlinepixel, old_loop = blitlineloop, old_ovf = blit_ovf;
+	uae_u16 old_blineb = blineb;
+	uae_u32 old_latch = regs.chipset_latch_rw;
+	uae_u8 *save = xmalloc(uae_u8, BLITBENCH_SIZE);
+	uae_u8 *orig = xmalloc(uae_u8, BLITBENCH_SIZE);
+	uae_u8 *ref = xmalloc(uae_u8, BLITBENCH_SIZE);
+	memcpy(save, chip, BLITBENCH_SIZE);
+	blit_dof = 0;
+
+	// all minterms, both directions, fill modes, shifts, masks and modulos
+	int tests = 0, errors = 0, fallbacks = 0;
+	blitbench_seed = 0x12345678;
+	for (int mt = 0; mt < 256; mt++) {
+		for (int variant = 0; variant < 8; variant++) {
+			bool desc = (variant & 1) != 0;
+			bool cd = (variant & 4) != 0;
+			int h = 1 + blitbench_rand() % 48;
+			int v = 1 + blitbench_rand() % 64;
+			int mod = (blitbench_rand() % 8) * 2;
+			static const uae_u16 fillmodes[] = { BLTIFE, BLTEFE, BLTIFE | BLTFC, BLTEFE | BLTFC };
+			uae_u16 con0 = (uae_u16)(((blitbench_rand() & 15) << 12) | (((blitbench_rand() & 7) << 9) | BLTCHD) | mt);
+			uae_u16 con1 = (uae_u16)(((blitbench_rand() & 15) << 12) | (desc ? BLTDESC : 0));
+			if (variant & 2)
+				con1 |= fillmodes[blitbench_rand() & 3];
+			if (cd)
+				con0 |= BLTCHC;
+
+			for (int i = 0; i < BLITBENCH_SIZE; i++)
+				orig[i] = (uae_u8)blitbench_rand();
+			blitbench_setup(con0, con1, h, v, mod, cd);
+			blt_info.bltafwm = (uae_u16)blitbench_rand();
+			blt_info.bltalwm = (uae_u16)blitbench_rand();
+			blt_info.bltadat = (uae_u16)blitbench_rand();
+			blt_info.bltbdat = (uae_u16)blitbench_rand();
+			blt_info.bltcdat = (uae_u16)blitbench_rand();
+			blt_info.bltddat = (uae_u16)blitbench_rand();
+			blt_info.bltaold = (uae_u16)blitbench_rand();
+			blt_info.bltbold = (uae_u16)blitbench_rand();
+			blt_info.bltbhold = (uae_u16)blitbench_rand();
+			blt_info.blitzero = 1;
+			struct bltinfo start = blt_info;
+
+			memcpy(chip, orig, BLITBENCH_SIZE);
+			blitbench_run(BLIT_PATH_WORD);
+			memcpy(ref, chip, BLITBENCH_SIZE);
+			struct bltinfo result = blt_info;
+			int result_fc = blitfc;
+
+			memcpy(chip, orig, BLITBENCH_SIZE);
+			blt_info = start;
+			blitfc = !!(con1 & BLTFC);
+			int cnt = blit_generic_count;
+			blitbench_run(BLIT_PATH_GENERIC);
+			tests++;
+			if (cnt == blit_generic_count) {
+				fallbacks++;
+			} else if (memcmp(chip, ref, BLITBENCH_SIZE) || !blitbench_compare(&result, result_fc)) {
+				if (errors < 10)
+					console_out_f(_T("Mismatch: CON0=%04X CON1=%04X %dx%d MOD=%d C=D:%d\n"), con0, con1, h, v, mod, cd);
+				errors++;
+			}
+		}
+	}
+	console_out_f(_T("%d tests, %d mismatches, %d not handled by generic kernel.\n"), tests, errors, fallbacks);
+
+	// line mode
+	tests = errors = 0;
+	for (int i = 0; i < 4096; i++) {
+		for (int j = 0; j < BLITBENCH_SIZE; j++)
+			orig[j] = (uae_u8)blitbench_rand();
+		blitbench_line_setup(-1);
+		struct bltinfo start = blt_info;
+		uae_u16 start_blineb = blineb;
+		int start_ovf = blit_ovf;
+
+		memcpy(chip, orig, BLITBENCH_SIZE);
+		blitbench_line_run(BLIT_PATH_WORD);
+		memcpy(ref, chip, BLITBENCH_SIZE);
+		struct bltinfo result = blt_info;
+		uae_u16 result_blineb = blineb;
+		int result_state = blitonedot | (blitlinepixel << 1) | (blitlineloop << 2) | ((blit_ovf & 3) << 3);
+		uae_u32 result_latch = regs.chipset_latch_rw;
+
+		memcpy(chip, orig, BLITBENCH_SIZE);
+		blt_info = start;
+		blineb = start_blineb;
+		blitonedot = 0;
+		blitlinepixel = 0;
+		blitlineloop = 1;
+		blit_ovf = start_ovf;
+		blitbench_line_run(BLIT_PATH_GENERIC);
+		tests++;
+		if (memcmp(chip, ref, BLITBENCH_SIZE) || !blitbench_line_compare(&result, result_blineb, result_state, result_latch)) {
+			if (errors < 10)
+				console_out_f(_T("Line mismatch: CON0=%04X CON1=%04X SIZE=%dx%d APT=%04X\n"),
+					start.bltcon0, start.bltcon1, start.hblitsize, start.vblitsize, start.bltapt);
+			errors++;
+		}
+	}
+	console_out_f(_T("%d line tests, %d mismatches.\n"), tests, errors);
+
+	// throughput in Mwords/s
+	console_out(_T("Minterm Size     Generated Generic  Word loop\n"));
+	for (int i = 0; i < sizeof minterms / sizeof minterms[0]; i++) {
+		uae_u16 con0 = 0x0f00 | (1 << 12) | minterms[i];
+		for (int j = 0; j < sizeof shapes / sizeof shapes[0]; j++) {
+			int h = shapes[j][0], v = shapes[j][1];
+			TCHAR gen[16];
+			if (blitfunc_dofast[minterms[i]])
+				_stprintf(gen, _T("%9.1f"), blitbench_time(BLIT_PATH_AUTO, con0, h, v, rounds));
+			else
+				_tcscpy(gen, _T("        -"));
+			double g = blitbench_time(BLIT_PATH_GENERIC, con0, h, v, rounds);
+			double w = blitbench_time(BLIT_PATH_WORD, con0, h, v, rounds);
+			console_out_f(_T("%02X      %3dx%-4d %s %7.1f  %9.1f\n"), minterms[i], h, v, gen, g, w);
+		}
+	}
+
+	// 200 pixel lines, Mpixels/s
+	for (int path = BLIT_PATH_WORD; path <= BLIT_PATH_GENERIC; path++) {
+		frame_time_t t1 = read_processor_time();
+		for (int i = 0; i < rounds * 10; i++) {
+			blitbench_line_setup(199);
+			blitbench_line_run(path);
+		}
+		frame_time_t t2 = read_processor_time();
+		double secs = (double)(t2 - t1) / syncbase;
+		console_out_f(_T("Line %s: %.1f\n"), path == BLIT_PATH_WORD ? _T("stepper") : _T("fast   "),
+			secs > 0 ? 200.0 * rounds * 10 / secs / 1000000.0 : 0);
+	}
+
+	memcpy(chip, save, BLITBENCH_SIZE);
+	xfree(ref);
+	xfree(orig);
+	xfree(save);
+	blt_info = old_info;
+	blitfill = old_fill;
+	blitife = old_ife;
+	blitfc = old_fc;
+	blit_dof = old_dof;
+	blitline = old_line;
+	blitonedot = old_onedot;
+	blitlinepixel = old_pixel;
+	blitlineloop = old_loop;
+	blit_ovf = old_ovf;
+	blineb = old_blineb;
+	regs.chipset_latch_rw = old_latch;
+}
+
+#endif
+
 static void blitter_doit(void)
 {
 	if (blt_info.vblitsize == 0) {
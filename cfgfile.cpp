@@ -115,7 +115,10 @@ static const struct cfg_lines opttable[] =
 	{_T("comp_trustlong"), _T("How to access longs in compiler (direct/indirect/indirectKS/afterPic") },
 	{_T("comp_nf"), _T("Whether to optimize away flag generation where possible") },
 	{_T("comp_fpu"), _T("Whether to provide JIT FPU emulation") },
+	{_T("comp_fpu_sse2"), _T("Use SSE2 instead of x87 for JIT FPU in double precision mode (experimental, FPCR precision is ignored)") },
+	{_T("comp_trace"), _T("Continue JIT blocks through forward Bcc/DBF branches, the other direction becomes a side exit") },
 	{_T("cachesize"), _T("How many MB to use to buffer translated instructions")},
+	{_T("comp_budget"), _T("Maximum percentage of each frame spent translating, other blocks stay interpreted (0 = unlimited)")},
 	{_T("override_dga_address"),_T("Address from which to map the frame buffer (upper 16 bits) (DANGEROUS!)")},
 	{_T("avoid_dga"), _T("Set to yes if the use of DGA extension creates problems") },
 	{_T("avoid_vid"), _T("Set to yes if the use of the Vidmode extension creates problems") },
@@ -2233,9 +2236,12 @@ void cfgfile_save_options (struct zfile *f, struct uae_prefs *p, int type)
 	cfgfile_write_strarr(f, _T("comp_trustnaddr"), compmode, p->comptrustnaddr);
 	cfgfile_write_bool (f, _T("comp_nf"), p->compnf);
 	cfgfile_write_bool (f, _T("comp_constjump"), p->comp_constjump);
+	cfgfile_dwrite_bool(f, _T("comp_trace"), p->comp_trace);
+	cfgfile_dwrite(f, _T("comp_budget"), _T("%d"), p->comp_budget);
 	cfgfile_write_strarr(f, _T("comp_flushmode"), flushmode, p->comp_hardflush);
 #ifdef USE_JIT_FPU
 	cfgfile_write_bool (f, _T("compfpu"), p->compfpu);
+	cfgfile_dwrite_bool(f, _T("comp_fpu_sse2"), p->compfpu_sse2);
 #endif
 	cfgfile_write_bool(f, _T("comp_catchfault"), p->comp_catchfault);
 	cfgfile_write(f, _T("cachesize"), _T("%d"), p->cachesize);
@@ -2481,6 +2487,7 @@ void cfgfile_save_options (struct zfile *f, struct uae_prefs *p, int type)
 	cfgfile_dwrite(f, _T("gfx_horizontal_extra"), _T("%d"), p->gfx_extrawidth);
 	cfgfile_dwrite(f, _T("gfx_vertical_extra"), _T("%d"), p->gfx_extraheight);
 	cfgfile_dwrite(f, _T("gfx_frame_slices"), _T("%d"), p->gfx_display_sections);
+	cfgfile_dwrite(f, _T("gfx_denise_threads"), _T("%d"), p->gfx_denise_threads);
 	cfgfile_dwrite_bool(f, _T("gfx_vrr_monitor"), p->gfx_variable_sync != 0);
 	cfgfile_dwrite_strarr(f, _T("gfx_overscanmode"), overscanmodes, p->gfx_overscanmode);
 	cfgfile_dwrite(f, _T("gfx_monitorblankdelay"), _T("%d"), p->gfx_monitorblankdelay);
@@ -2999,7 +3006,7 @@ void cfgfile_save_options (struct zfile *f, struct uae_prefs *p, int type)
 	cfgfile_dwrite_bool (f, _T("cpu_no_unimplemented"), p->int_no_unimplemented);
 	cfgfile_write_bool (f, _T("fpu_strict"), p->fpu_strict);
 	cfgfile_dwrite_bool (f, _T("fpu_softfloat"), p->fpu_mode > 0);
-#ifdef MSVC_LONG_DOUBLE
+#if defined(MSVC_LONG_DOUBLE) || defined(X87_LONG_DOUBLE)
 	cfgfile_dwrite_bool(f, _T("fpu_msvc_long_double"), p->fpu_mode < 0);
 #endif
 
@@ -3041,6 +3048,7 @@ void cfgfile_save_options (struct zfile *f, struct uae_prefs *p, int type)
 	cfgfile_dwrite(f, _T("warp_limit"), _T("%d"), p->turbo_emulation_limit);
 	cfgfile_dwrite_bool(f, _T("warpboot"), p->turbo_boot);
 	cfgfile_dwrite(f, _T("warpboot_delay"), _T("%d"), p->turbo_boot_delay);
+	cfgfile_dwrite_bool(f, _T("nodisplay"), p->nodisplay);
 
 #ifdef FILESYS
 	write_filesys_config (p, f);
@@ -3049,6 +3057,9 @@ void cfgfile_save_options (struct zfile *f, struct uae_prefs *p, int type)
 	cfgfile_dwrite (f, _T("filesys_max_size"), _T("%d"), p->filesys_limit);
 	cfgfile_dwrite (f, _T("filesys_max_name_length"), _T("%d"), p->filesys_max_name);
 	cfgfile_dwrite (f, _T("filesys_max_file_size"), _T("%d"), p->filesys_max_file_size);
+	cfgfile_dwrite (f, _T("hardfile_cache"), _T("%d"), p->hardfile_cache);
+	cfgfile_dwrite_bool (f, _T("hardfile_mmap"), p->hardfile_mmap);
+	cfgfile_dwrite (f, _T("zfile_cache"), _T("%d"), p->zfile_cache);
 	cfgfile_dwrite_bool (f, _T("filesys_inject_icons"), p->filesys_inject_icons);
 	cfgfile_dwrite_str (f, _T("filesys_inject_icons_drawer"), p->filesys_inject_icons_drawer);
 	cfgfile_dwrite_str (f, _T("filesys_inject_icons_project"), p->filesys_inject_icons_project);
@@ -3682,6 +3693,7 @@ static int cfgfile_parse_host (struct uae_prefs *p, TCHAR *option, TCHAR *value)
 		|| cfgfile_intval(option, value, _T("warpboot_delay"), &p->turbo_emulation_limit, 1)
 
 		|| cfgfile_intval(option, value, _T("gfx_frame_slices"), &p->gfx_display_sections, 1)
+		|| cfgfile_intval(option, value, _T("gfx_denise_threads"), &p->gfx_denise_threads, 1)
 		|| cfgfile_intval(option, value, _T("gfx_framerate"), &p->gfx_framerate, 1)
 		|| cfgfile_intval(option, value, _T("gfx_x_windowed"), &p->gfx_monitor[0].gfx_size_win.x, 1)
 		|| cfgfile_intval(option, value, _T("gfx_y_windowed"), &p->gfx_monitor[0].gfx_size_win.y, 1)
@@ -3704,6 +3716,9 @@ static int cfgfile_parse_host (struct uae_prefs *p, TCHAR *option, TCHAR *value)
 		|| cfgfile_intval (option, value, _T("filesys_max_size"), &p->filesys_limit, 1)
 		|| cfgfile_intval (option, value, _T("filesys_max_name_length"), &p->filesys_max_name, 1)
 		|| cfgfile_intval (option, value, _T("filesys_max_file_size"), &p->filesys_max_file_size, 1)
+		|| cfgfile_intval (option, value, _T("hardfile_cache"), &p->hardfile_cache, 1)
+		|| cfgfile_yesno (option, value, _T("hardfile_mmap"), &p->hardfile_mmap)
+		|| cfgfile_intval (option, value, _T("zfile_cache"), &p->zfile_cache, 1)
 		|| cfgfile_yesno (option, value, _T("filesys_inject_icons"), &p->filesys_inject_icons)
 		|| cfgfile_string (option, value, _T("filesys_inject_icons_drawer"), p->filesys_inject_icons_drawer, sizeof p->filesys_inject_icons_drawer / sizeof (TCHAR))
 		|| cfgfile_string (option, value, _T("filesys_inject_icons_project"), p->filesys_inject_icons_project, sizeof p->filesys_inject_icons_project / sizeof (TCHAR))
@@ -3772,6 +3787,7 @@ static int cfgfile_parse_host (struct uae_prefs *p, TCHAR *option, TCHAR *value)
 		|| cfgfile_yesno(option, value, _T("warp"), &p->turbo_emulation)
 		|| cfgfile_yesno(option, value, _T("warpboot"), &p->turbo_boot)
 		|| cfgfile_yesno(option, value, _T("headless"), &p->headless)
+		|| cfgfile_yesno(option, value, _T("nodisplay"), &p->nodisplay)
 		|| cfgfile_yesno(option, value, _T("clipboard_sharing"), &p->clipboard_sharing)
 		|| cfgfile_yesno(option, value, _T("native_code"), &p->native_code)
 		|| cfgfile_yesno(option, value, _T("tablet_library"), &p->tablet_library)
@@ -6022,9 +6038,11 @@ static int cfgfile_parse_hardware (struct uae_prefs *p, const TCHAR *option, TCH
 		|| cfgfile_yesno(option, value, _T("fpu_strict"), &p->fpu_strict)
 		|| cfgfile_yesno(option, value, _T("comp_nf"), &p->compnf)
 		|| cfgfile_yesno(option, value, _T("comp_constjump"), &p->comp_constjump)
+		|| cfgfile_yesno(option, value, _T("comp_trace"), &p->comp_trace)
 		|| cfgfile_yesno(option, value, _T("comp_catchfault"), &p->comp_catchfault)
 #ifdef USE_JIT_FPU
 		|| cfgfile_yesno (option, value, _T("compfpu"), &p->compfpu)
+		|| cfgfile_yesno(option, value, _T("comp_fpu_sse2"), &p->compfpu_sse2)
 #endif
 		|| cfgfile_yesno(option, value, _T("jit_inhibit"), &p->cachesize_inhibit)
 		|| cfgfile_yesno(option, value, _T("rtg_nocustom"), &p->picasso96_nocustom)
@@ -6038,6 +6056,7 @@ static int cfgfile_parse_hardware (struct uae_prefs *p, const TCHAR *option, TCH
 		return 1;
 
 	if (cfgfile_intval(option, value, _T("cachesize"), &p->cachesize, 1)
+		|| cfgfile_intval(option, value, _T("comp_budget"), &p->comp_budget, 1)
 		|| cfgfile_intval(option, value, _T("cd32nvram_size"), &p->cs_cd32nvram_size, 1024)
 		|| cfgfile_intval(option, value, _T("chipset_hacks"), &p->cs_hacks, 1)
 		|| cfgfile_intval(option, value, _T("serial_stopbits"), &p->serial_stopbits, 1)
@@ -6150,7 +6169,7 @@ static int cfgfile_parse_hardware (struct uae_prefs *p, const TCHAR *option, TCH
 			p->fpu_mode = 1;
 		return 1;
 	}
-#ifdef MSVC_LONG_DOUBLE
+#if defined(MSVC_LONG_DOUBLE) || defined(X87_LONG_DOUBLE)
 	if (cfgfile_yesno(option, value, _T("fpu_msvc_long_double"), &dummybool)) {
 		if (dummybool)
 			p->fpu_mode = -1;
@@ -8533,11 +8552,14 @@ void default_prefs (struct uae_prefs *p, bool reset, int type)
 	p->compnf = 1;
 	p->comp_hardflush = 0;
 	p->comp_constjump = 1;
+	p->comp_trace = false;
+	p->comp_budget = 0;
 #ifdef USE_JIT_FPU
 	p->compfpu = 1;
 #else
 	p->compfpu = 0;
 #endif
+	p->compfpu_sse2 = false;
 	p->comp_catchfault = true;
 	p->cachesize = 0;
 
@@ -8572,6 +8594,7 @@ void default_prefs (struct uae_prefs *p, bool reset, int type)
 	p->gfx_apmode[0].gfx_backbuffers = 2;
 	p->gfx_apmode[1].gfx_backbuffers = 1;
 	p->gfx_display_sections = 4;
+	p->gfx_denise_threads = 0;
 	p->gfx_variable_sync = 0;
 	p->gfx_windowed_resize = true;
 	p->gfx_overscanmode = 3;
@@ -8591,6 +8614,7 @@ void default_prefs (struct uae_prefs *p, bool reset, int type)
 	p->turbo_boot = 0;
 	p->turbo_boot_delay = 100;
 	p->headless = 0;
+	p->nodisplay = 0;
 	p->catweasel = 0;
 	p->tod_hack = 0;
 	p->maprom = 0;
@@ -8718,6 +8742,9 @@ void default_prefs (struct uae_prefs *p, bool reset, int type)
 	p->filesys_limit = 0;
 	p->filesys_max_name = 107;
 	p->filesys_max_file_size = 0x7fffffff;
+	p->hardfile_cache = 0;
+	p->hardfile_mmap = false;
+	p->zfile_cache = 0;
 
 	p->z3autoconfig_start = 0x10000000;
 	p->chipmem.size = 0x00080000;
@@ -0,0 +1,420 @@
+/*
+* UAE - The Un*x Amiga Emulator
+*
+* Headless CPU core throughput benchmark
+*
+* Runs fixed instruction mixes through the generated CPU core tables
+* (cpustbl.cpp) without chipset emulation and reports MIPS, host cycles
+* per emulated instruction and host cache misses.
+*
+*/
+
+#include "sysconfig.h"
+#include "sysdeps.h"
+
+#include "options.h"
+#include "memory.h"
+#include "newcpu.h"
+#include "cpummu.h"
+#include "cpummu030.h"
+#include "fpp.h"
+#include "uae/io.h"
+#include "uae/time.h"
+#include "cpubench.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+#define CPUBENCH_CODE 0x1000
+#define CPUBENCH_STACK 0x7000
+#define CPUBENCH_DATA 0x8000
+#define CPUBENCH_MMUREGS 0x8f00
+#define CPUBENCH_ROUNDS 3
+#define CPUBENCH_WARMUP 100000
+
+TCHAR *cpubench_file;
+uae_s64 cpubench_instructions = 20000000;
+
+#define MIX_FPU 1
+#define MIX_MMU 2
+
+struct cpubench_mix
+{
+	const TCHAR *name;
+	const uae_u16 *code;
+	int words;
+	int flags;
+};
+
+// add.l/sub.l/and.l/or.l/eor.l/lsl.l/addq/move/swap/not/mulu/neg/ext/cmp
+static const uae_u16 mix_alu[] = {
+	0xd081, 0x9282, 0xc483, 0x8684, 0xbb84, 0xe78d, 0x5286, 0x2c00,
+	0x4840, 0x4681, 0xc6c2, 0x4484, 0x48c2, 0xb081,
+	0x60e2
+};
+// (An), d16(An), (An)+, -(An), d8(An,Xn), abs.l, lea
+static const uae_u16 mix_ea[] = {
+	0x2010,
+	0x2140, 0x0004,
+	0x3218,
+	0x3101,
+	0x2630, 0x2008,
+	0xd691,
+	0x2283,
+	0x45e8, 0x0010,
+	0x2352, 0x0004,
+	0x2839, 0x0000, 0x8020,
+	0x2184, 0x2000,
+	0x4aa9, 0xfffc,
+	0x60d6
+};
+// Bcc taken/not taken, DBF loop, BSR/RTS
+static const uae_u16 mix_branch[] = {
+	0x5380,
+	0x6602,
+	0x7007,
+	0x0800, 0x0000,
+	0x6702,
+	0x5281,
+	0x0800, 0x0001,
+	0x6602,
+	0x610a,
+	0x7403,
+	0x5283,
+	0x51ca, 0xfffc,
+	0x60e0,
+	0x5284,
+	0x4e75
+};
+// FMOVE.D load/store, FADD/FMUL/FSUB/FDIV/FSQRT/FCMP, FMOVE.L to/from Dn
+static const uae_u16 mix_fpu[] = {
+	0xf210, 0x5400,
+	0xf210, 0x5480,
+	0xf228, 0x5500, 0x0008,
+	0xf210, 0x5580,
+	0xf228, 0x5600, 0x0008,
+	0xf200, 0x0422,
+	0xf200, 0x08a3,
+	0xf200, 0x0d28,
+	0xf200, 0x11a0,
+	0xf200, 0x0204,
+	0xf200, 0x0438,
+	0xf200, 0x4300,
+	0xf201, 0x6300,
+	0xf228, 0x7400, 0x0010,
+	0x60c0
+};
+
+static const struct cpubench_mix mixes[] = {
+	{ _T("alu"), mix_alu, sizeof mix_alu / sizeof(uae_u16), 0 },
+	{ _T("ea"), mix_ea, sizeof mix_ea / sizeof(uae_u16), 0 },
+	{ _T("branch"), mix_branch, sizeof mix_branch / sizeof(uae_u16), 0 },
+	{ _T("fpu"), mix_fpu, sizeof mix_fpu / sizeof(uae_u16), MIX_FPU },
+	{ _T("mmu"), mix_ea, sizeof mix_ea / sizeof(uae_u16), MIX_MMU },
+	{ NULL }
+};
+
+// 68030: PMOVE (A5),TT0 / PMOVE 8(A5),CRP / PMOVE 4(A5),TC
+static const uae_u16 prologue_mmu030[] = {
+	0xf015, 0x0800,
+	0xf02d, 0x4c00, 0x0008,
+	0xf02d, 0x4000, 0x0004
+};
+// 68040/060: transparent translation of everything, then enable MMU.
+static const uae_u16 prologue_mmu040[] = {
+	0x203c, 0x00ff, 0xc000,
+	0x4e7b, 0x0004,
+	0x4e7b, 0x0006,
+	0x223c, 0x0000, 0x8000,
+	0x4e7b, 0x1003
+};
+
+struct cpubench_cpu
+{
+	int cpu, fpu, mmu;
+	bool address_space_24;
+};
+
+static const struct cpubench_cpu cpus[] = {
+	{ 68000, 0, 0, true },
+	{ 68020, 68882, 0, true },
+	{ 68030, 68882, 68030, false },
+	{ 68040, 68040, 68040, false },
+	{ 68060, 68060, 68060, false },
+	{ 0 }
+};
+
+// cputbls[][] columns benchmarked, cycle-exact and prefetch cores need the chipset.
+static const int modes[] = { 0, 1, 2, 5, -1 };
+static const TCHAR *modenames[] = { _T("generic"), _T("direct"), _T("indirect"), NULL, NULL, _T("mmu") };
+
+// op_smalltbl_<n> numbers, same layout as cputbls[] in newcpu.cpp
+static const int tblnums[6][6] = {
+	{ 5, 45, 55, -1, -1, -1 },
+	{ 4, 44, 54, -1, -1, -1 },
+	{ 3, 43, 53, -1, -1, -1 },
+	{ 2, 42, 52, -1, -1, 32 },
+	{ 1, 41, 51, -1, -1, 31 },
+	{ 0, 40, 50, -1, -1, 33 }
+};
+
+static uae_u64 cpubench_tsc(void)
+{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_AMD64))
+	return __rdtsc();
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+	return __builtin_ia32_rdtsc();
+#else
+	return 0;
+#endif
+}
+
+#ifdef __linux__
+static int perf_fd = -1;
+
+static void perf_open(void)
+{
+	struct perf_event_attr pe;
+
+	memset(&pe, 0, sizeof pe);
+	pe.type = PERF_TYPE_HARDWARE;
+	pe.size = sizeof pe;
+	pe.config = PERF_COUNT_HW_CACHE_MISSES;
+	pe.disabled = 1;
+	pe.exclude_kernel = 1;
+	pe.exclude_hv = 1;
+	perf_fd = (int)syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0);
+	if (perf_fd < 0)
+		write_log(_T("CPUBENCH: perf_event_open failed (%d), cache misses not available\n"), errno);
+}
+static void perf_close(void)
+{
+	if (perf_fd >= 0)
+		close(perf_fd);
+	perf_fd = -1;
+}
+static void perf_start(void)
+{
+	if (perf_fd < 0)
+		return;
+	ioctl(perf_fd, PERF_EVENT_IOC_RESET, 0);
+	ioctl(perf_fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+static uae_s64 perf_stop(void)
+{
+	uae_s64 v;
+	if (perf_fd < 0)
+		return -1;
+	ioctl(perf_fd, PERF_EVENT_IOC_DISABLE, 0);
+	if (read(perf_fd, &v, sizeof v) != sizeof v)
+		return -1;
+	return v;
+}
+#else
+static void perf_open(void)
+{
+}
+static void perf_close(void)
+{
+}
+static void perf_start(void)
+{
+}
+static uae_s64 perf_stop(void)
+{
+	return -1;
+}
+#endif
+
+static void put_double(uaecptr addr, uae_u32 hi, uae_u32 lo)
+{
+	put_long(addr + 0, hi);
+	put_long(addr + 4, lo);
+}
+
+static uaecptr setup_code(const struct cpubench_mix *mix, const struct cpubench_cpu *c)
+{
+	uaecptr addr = CPUBENCH_CODE;
+	const uae_u16 *pro = NULL;
+	int prowords = 0;
+
+	if (mix->flags & MIX_MMU) {
+		if (c->mmu == 68030) {
+			pro = prologue_mmu030;
+			prowords = sizeof prologue_mmu030 / sizeof(uae_u16);
+		} else {
+			pro = prologue_mmu040;
+			prowords = sizeof prologue_mmu040 / sizeof(uae_u16);
+		}
+	}
+	for (int i = 0; i < prowords; i++) {
+		put_word(addr, pro[i]);
+		addr += 2;
+	}
+	uaecptr body = addr;
+	for (int i = 0; i < mix->words; i++) {
+		put_word(addr, mix->code[i]);
+		addr += 2;
+	}
+
+	for (int i = 0; i < 0x200; i += 4)
+		put_long(CPUBENCH_DATA + i, 0x01020304 * (i + 1));
+	put_double(CPUBENCH_DATA + 0, 0x3ff80000, 0x00000000); // 1.5
+	put_double(CPUBENCH_DATA + 8, 0x400a0000, 0x00000000); // 3.25
+	// 68030 TT0: all addresses, all FC, R/W ignored. TC: 4K pages, 10/10 split.
+	put_long(CPUBENCH_MMUREGS + 0, 0x00ff8107);
+	put_long(CPUBENCH_MMUREGS + 4, 0x80c0aa00);
+	put_long(CPUBENCH_MMUREGS + 8, 0x00000002);
+	put_long(CPUBENCH_MMUREGS + 12, CPUBENCH_MMUREGS + 0x100);
+
+	return body;
+}
+
+static void setup_regs(void)
+{
+	for (int i = 0; i < 8; i++)
+		m68k_dreg(regs, i) = 0x10001 * (i + 1);
+	m68k_dreg(regs, 0) = 7;
+	m68k_dreg(regs, 2) = 0;
+	m68k_areg(regs, 0) = CPUBENCH_DATA;
+	m68k_areg(regs, 1) = CPUBENCH_DATA + 0x100;
+	m68k_areg(regs, 2) = CPUBENCH_DATA + 0x10;
+	m68k_areg(regs, 5) = CPUBENCH_MMUREGS;
+	m68k_areg(regs, 7) = CPUBENCH_STACK;
+}
+
+static void reset_cpu_state(uaecptr pc)
+{
+	regs.vbr = 0;
+	regs.sr = 0x2700;
+	MakeFromSR();
+	regs.isp = CPUBENCH_STACK;
+	setup_regs();
+	m68k_setpc_normal(pc);
+	fill_prefetch();
+}
+
+static void write_result(FILE *f, const struct cpubench_cpu *c, int mode, const struct cpubench_mix *mix,
+	uae_s64 insns, double secs, uae_u64 tsc, uae_s64 misses)
+{
+	int lvl = (c->cpu - 68000) / 10;
+	if (lvl > 5)
+		lvl = 5;
+	double mips = secs > 0 ? insns / secs / 1000000.0 : 0;
+	double cpi = insns > 0 ? (double)tsc / insns : 0;
+	double mpki = misses >= 0 && insns > 0 ? misses * 1000.0 / insns : -1;
+
+	write_log(_T("CPUBENCH: %d/%d/%d %-8s op_smalltbl_%-2d %-6s %6.1f MIPS %7.2f cyc/insn %lld misses\n"),
+		c->cpu, c->fpu, c->mmu, modenames[mode], tblnums[lvl][mode], mix->name, mips, cpi, misses);
+	if (f) {
+		fprintf(f, "%d,%d,%d,%s,op_smalltbl_%d,%s,%lld,%.6f,%.3f,%.3f,%lld,%.4f\n",
+			c->cpu, c->fpu, c->mmu, modenames[mode], tblnums[lvl][mode], mix->name,
+			insns, secs, mips, cpi, misses, mpki);
+	}
+}
+
+static bool run_mix(FILE *f, const struct cpubench_cpu *c, int mode, const struct cpubench_mix *mix)
+{
+	uaecptr body = setup_code(mix, c);
+	double best = 0;
+	uae_u64 besttsc = 0;
+	uae_s64 bestmisses = -1;
+
+	// prologue (MMU enable) runs with the benchmarked core
+	reset_cpu_state(CPUBENCH_CODE);
+	if (cpu_benchmark_run(100, body) < 0 || m68k_getpc() != body) {
+		write_log(_T("CPUBENCH: %d %s prologue failed, PC=%08x\n"), c->cpu, mix->name, m68k_getpc());
+		return false;
+	}
+	setup_regs();
+	if (cpu_benchmark_run(CPUBENCH_WARMUP, 0xffffffff) < 0)
+		return false;
+
+	for (int round = 0; round < CPUBENCH_ROUNDS; round++) {
+		setup_regs();
+		m68k_setpc_normal(body);
+		fill_prefetch();
+		frame_time_t t1 = read_processor_time();
+		uae_u64 tsc1 = cpubench_tsc();
+		perf_start();
+		uae_s64 cnt = cpu_benchmark_run(cpubench_instructions, 0xffffffff);
+		uae_s64 misses = perf_stop();
+		uae_u64 tsc2 = cpubench_tsc();
+		frame_time_t t2 = read_processor_time();
+		if (cnt != cpubench_instructions)
+			return false;
+		double secs = (double)(t2 - t1) / syncbase;
+		if (round == 0 || secs < best) {
+			best = secs;
+			besttsc = tsc2 - tsc1;
+			bestmisses = misses;
+		}
+	}
+	write_result(f, c, mode, mix, cpubench_instructions, best, besttsc, bestmisses);
+	return true;
+}
+
+bool cpubench_run(void)
+{
+	struct uae_prefs oldprefs;
+	FILE *f = NULL;
+	bool ok = true;
+
+	if (!cpubench_file)
+		return false;
+	if (cpubench_file[0]) {
+		f = uae_tfopen(cpubench_file, _T("wt"));
+		if (!f)
+			write_log(_T("CPUBENCH: could not create '%s'\n"), cpubench_file);
+	}
+	if (f)
+		fprintf(f, "cpu,fpu,mmu,core,table,mix,instructions,seconds,mips,host_cycles_per_insn,cache_misses,cache_misses_per_kinsn\n");
+
+	memcpy(&oldprefs, &changed_prefs, sizeof oldprefs);
+	changed_prefs.cachesize = currprefs.cachesize = 0;
+	changed_prefs.cpu_compatible = false;
+	changed_prefs.cpu_cycle_exact = false;
+	changed_prefs.cpu_memory_cycle_exact = false;
+	changed_prefs.cpu_data_cache = false;
+	changed_prefs.mmu_ec = false;
+	changed_prefs.fpu_mode = 0;
+	perf_open();
+
+	for (int i = 0; cpus[i].cpu; i++) {
+		const struct cpubench_cpu *c = &cpus[i];
+		for (int j = 0; modes[j] >= 0; j++) {
+			int mode = modes[j];
+			if (mode == 5 && !c->mmu)
+				continue;
+			changed_prefs.cpu_model = c->cpu;
+			changed_prefs.fpu_model = c->fpu;
+			changed_prefs.mmu_model = mode == 5 ? c->mmu : 0;
+			changed_prefs.address_space_24 = mode == 5 ? false : c->address_space_24;
+			cpu_benchmark_core(mode);
+			for (int k = 0; mixes[k].name; k++) {
+				const struct cpubench_mix *mix = &mixes[k];
+				if ((mix->flags & MIX_FPU) && !c->fpu)
+					continue;
+				if (((mix->flags & MIX_MMU) != 0) != (mode == 5))
+					continue;
+				if (!run_mix(f, c, mode, mix)) {
+					write_log(_T("CPUBENCH: %d %s %s failed\n"), c->cpu, modenames[mode], mix->name);
+					ok = false;
+				}
+			}
+		}
+	}
+
+	perf_close();
+	if (f)
+		fclose(f);
+	memcpy(&changed_prefs, &oldprefs, sizeof oldprefs);
+	return ok;
+}
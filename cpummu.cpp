@@ -71,13 +71,16 @@ static struct mmu_debug_data mddm;
 #if MMU_ICACHE
 struct mmu_icache mmu_icache_data[MMU_ICACHE_SZ];
 #endif
+#if MMU_IPAGECACHE || MMU_DPAGECACHE
+uae_u32 mmu_fastcache_gen = 1;
+int mmu_fastcache_flush_all, mmu_fastcache_flush_page;
+#endif
 #if MMU_IPAGECACHE
-uae_u32 atc_last_ins_laddr, atc_last_ins_paddr;
-uae_u8 atc_last_ins_cache;
+struct mmufastcache atc_ins_cache[MMUFASTCACHE_SETS][MMUFASTCACHE_WAYS];
 #endif
 #if MMU_DPAGECACHE
-struct mmufastcache atc_data_cache_read[MMUFASTCACHE_ENTRIES];
-struct mmufastcache atc_data_cache_write[MMUFASTCACHE_ENTRIES];
+struct mmufastcache atc_data_cache_read[MMUFASTCACHE_SETS][MMUFASTCACHE_WAYS];
+struct mmufastcache atc_data_cache_write[MMUFASTCACHE_SETS][MMUFASTCACHE_WAYS];
 #endif
 
 #if CACHE_HIT_COUNT
@@ -327,7 +330,14 @@ static void mmu_dump_table(const char * label, uaecptr root_ptr)
 /* {{{ mmu_dump_atc */
 static void mmu_dump_atc(void)
 {
-
+#if MMU_IPAGECACHE || MMU_DPAGECACHE
+	console_out_f(_T("ATC fast cache: gen=%u flush all=%d flush page=%d\n"),
+		mmu_fastcache_gen, mmu_fastcache_flush_all, mmu_fastcache_flush_page);
+#endif
+#if CACHE_HIT_COUNT
+	console_out_f(_T("ins %d/%d read %d/%d write %d/%d (hit/miss)\n"),
+		mmu_ins_hit, mmu_ins_miss, mmu_data_read_hit, mmu_data_read_miss, mmu_data_write_hit, mmu_data_write_miss);
+#endif
 }
 /* }}} */
 
@@ -348,23 +358,63 @@ void mmu_dump_tables(void)
 }
 /* }}} */
 
+#if MMU_IPAGECACHE || MMU_DPAGECACHE
+static void mmu_fastcache_flush(struct mmufastcache (*c)[MMUFASTCACHE_WAYS], uae_u32 idx1)
+{
+	struct mmufastcache *e = c[idx1 & (MMUFASTCACHE_SETS - 1)];
+	for (int i = 0; i < MMUFASTCACHE_WAYS; i++) {
+		if (e[i].log == idx1)
+			e[i].gen = 0;
+	}
+}
+
+static void mmu_fastcache_add(struct mmufastcache (*c)[MMUFASTCACHE_WAYS], uaecptr addr, uaecptr phys, bool super)
+{
+	uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
+	struct mmufastcache *e = c[idx1 & (MMUFASTCACHE_SETS - 1)];
+	int way;
+
+	// most recently used entry first, replace old copy of this page or the last one
+	for (way = 0; way < MMUFASTCACHE_WAYS - 1; way++) {
+		if (e[way].log == idx1 && e[way].gen == mmu_fastcache_gen)
+			break;
+	}
+	for (; way > 0; way--)
+		e[way] = e[way - 1];
+	e[0].log = idx1;
+	e[0].gen = mmu_fastcache_gen;
+	e[0].phys = phys;
+	e[0].cache_state = mmu_cache_state;
+}
+#endif
+
 static void flush_shortcut_cache(uaecptr addr, bool super)
 {
+#if MMU_IPAGECACHE || MMU_DPAGECACHE
+	if (addr == 0xffffffff) {
+		mmu_fastcache_flush_all++;
+		mmu_fastcache_gen++;
+		if (!mmu_fastcache_gen) {
+			// wrapped, old entries could match again
 #if MMU_IPAGECACHE
-	atc_last_ins_laddr = mmu_pagemask;
+			memset(&atc_ins_cache, 0, sizeof atc_ins_cache);
 #endif
 #if MMU_DPAGECACHE
-	if (addr == 0xffffffff) {
-		memset(&atc_data_cache_read, 0xff, sizeof atc_data_cache_read);
-		memset(&atc_data_cache_write, 0xff, sizeof atc_data_cache_write);
-	} else {
-		for (int i = 0; i < MMUFASTCACHE_ENTRIES; i++) {
-			uae_u32 idx = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
-			if (atc_data_cache_read[i].log == idx)
-				atc_data_cache_read[i].log = 0xffffffff;
-			if (atc_data_cache_write[i].log == idx)
-				atc_data_cache_write[i].log = 0xffffffff;
+			memset(&atc_data_cache_read, 0, sizeof atc_data_cache_read);
+			memset(&atc_data_cache_write, 0, sizeof atc_data_cache_write);
+#endif
+			mmu_fastcache_gen = 1;
 		}
+	} else {
+		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
+		mmu_fastcache_flush_page++;
+#if MMU_IPAGECACHE
+		mmu_fastcache_flush(atc_ins_cache, idx1);
+#endif
+#if MMU_DPAGECACHE
+		mmu_fastcache_flush(atc_data_cache_read, idx1);
+		mmu_fastcache_flush(atc_data_cache_write, idx1);
+#endif
 	}
 #endif
 }
@@ -660,6 +710,12 @@ static uae_u32 mmu_fill_atc(uaecptr addr, bool super, uae_u32 tag, bool write, s
     int i;
 	int old_s;
     
+	if (l->valid) {
+		// line gets replaced, forget the page it translated
+		uae_u32 slotmask = (ATC_SLOTS << mmu_pageshift) - 1;
+		flush_shortcut_cache(((l->tag << 1) & ~slotmask) | (addr & slotmask), (l->tag & 0x80000000) != 0);
+	}
+
     // Use supervisor mode to access descriptors (really is fc = 7)
     old_s = regs.s;
     regs.s = 1;
@@ -822,30 +878,11 @@ static void mmu_add_cache(uaecptr addr, uaecptr phys, bool super, bool data, boo
 {
 	if (!data) {
 #if MMU_IPAGECACHE
-		uae_u32 laddr = (addr & mmu_pagemaski) | (super ? 1 : 0);
-		atc_last_ins_laddr = laddr;
-		atc_last_ins_paddr = phys;
-		atc_last_ins_cache = mmu_cache_state;
-#else
-	;
+		mmu_fastcache_add(atc_ins_cache, addr, phys, super);
 #endif
 #if MMU_DPAGECACHE
 	} else {
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (write) {
-			if (idx2 < MMUFASTCACHE_ENTRIES - 1) {
-				atc_data_cache_write[idx2].log = idx1;
-				atc_data_cache_write[idx2].phys = phys;
-				atc_data_cache_write[idx2].cache_state = mmu_cache_state;
-			}
-		} else {
-			if (idx2 < MMUFASTCACHE_ENTRIES - 1) {
-				atc_data_cache_read[idx2].log = idx1;
-				atc_data_cache_read[idx2].phys = phys;
-				atc_data_cache_read[idx2].cache_state = mmu_cache_state;
-			}
-		}
+		mmu_fastcache_add(write ? atc_data_cache_write : atc_data_cache_read, addr, phys, super);
 #endif
 	}
 }
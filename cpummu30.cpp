@@ -87,15 +87,25 @@ static uae_u32 mmu030_table_search(uaecptr addr, uae_u32 fc, bool write, int lev
 static TT_info mmu030_decode_tt(uae_u32 TT);
 
 #if MMU_DPAGECACHE030
-#define MMUFASTCACHE_ENTRIES030 256
+/* Data translation shortcut cache, keyed by (logical page << 3) | fc.
+ * Also caches transparently translated pages so that hits skip the TTx
+ * compare. Entries are valid only when gen matches atc_data_cache_gen,
+ * flushing everything is a generation bump. */
+#define MMUFASTCACHE_SETS030 256
+#define MMUFASTCACHE_WAYS030 2
 struct mmufastcache030
 {
 	uae_u32 log;
+	uae_u32 gen;
 	uae_u32 phys;
 	uae_u8 cs;
 };
-static struct mmufastcache030 atc_data_cache_read[MMUFASTCACHE_ENTRIES030];
-static struct mmufastcache030 atc_data_cache_write[MMUFASTCACHE_ENTRIES030];
+static struct mmufastcache030 atc_data_cache_read[MMUFASTCACHE_SETS030][MMUFASTCACHE_WAYS030];
+static struct mmufastcache030 atc_data_cache_write[MMUFASTCACHE_SETS030][MMUFASTCACHE_WAYS030];
+static uae_u32 atc_data_cache_gen = 1;
+#if MMU030_FASTCACHE_CHECK
+static uae_u32 atc_data_cache_mismatch;
+#endif
 #endif
 
 /* for debugging messages */
@@ -217,6 +227,49 @@ static struct {
 
 /* -- ATC flushing functions -- */
 
+#if MMU_DPAGECACHE030
+STATIC_INLINE uae_u32 mmu030_fastcache_key(uaecptr addr, uae_u32 fc)
+{
+	return ((addr & mmu030.translation.page.imask) >> mmu030.translation.page.size3m) | fc;
+}
+
+STATIC_INLINE struct mmufastcache030 *mmu030_fastcache_set(struct mmufastcache030 (*c)[MMUFASTCACHE_WAYS030], uae_u32 key)
+{
+	return c[(key ^ (key >> 11)) & (MMUFASTCACHE_SETS030 - 1)];
+}
+
+STATIC_INLINE struct mmufastcache030 *mmu030_fastcache_lookup(struct mmufastcache030 (*c)[MMUFASTCACHE_WAYS030], uae_u32 key)
+{
+	struct mmufastcache030 *set = mmu030_fastcache_set(c, key);
+	if (set[0].log == key && set[0].gen == atc_data_cache_gen)
+		return &set[0];
+	if (set[1].log == key && set[1].gen == atc_data_cache_gen)
+		return &set[1];
+	return NULL;
+}
+
+static void mmu030_fastcache_add(struct mmufastcache030 (*c)[MMUFASTCACHE_WAYS030], uae_u32 key, uaecptr phys)
+{
+	struct mmufastcache030 *set = mmu030_fastcache_set(c, key);
+	// keep most recently used entry in way 0
+	if (set[0].log != key || set[0].gen != atc_data_cache_gen)
+		set[1] = set[0];
+	set[0].log = key;
+	set[0].gen = atc_data_cache_gen;
+	set[0].phys = phys;
+	set[0].cs = mmu030_cache_state;
+}
+
+static void mmu030_fastcache_flush_page(struct mmufastcache030 (*c)[MMUFASTCACHE_WAYS030], uae_u32 key)
+{
+	struct mmufastcache030 *set = mmu030_fastcache_set(c, key);
+	for (int i = 0; i < MMUFASTCACHE_WAYS030; i++) {
+		if (set[i].log == key)
+			set[i].gen = 0;
+	}
+}
+#endif
+
 static void mmu030_flush_cache(uaecptr addr)
 {
 #if MMU_IPAGECACHE030
@@ -224,15 +277,17 @@ static void mmu030_flush_cache(uaecptr addr)
 #endif
 #if MMU_DPAGECACHE030
 	if (addr == 0xffffffff) {
-		memset(&atc_data_cache_read, 0xff, sizeof atc_data_cache_read);
-		memset(&atc_data_cache_write, 0xff, sizeof atc_data_cache_write);
+		atc_data_cache_gen++;
+		if (atc_data_cache_gen == 0) {
+			memset(&atc_data_cache_read, 0, sizeof atc_data_cache_read);
+			memset(&atc_data_cache_write, 0, sizeof atc_data_cache_write);
+			atc_data_cache_gen = 1;
+		}
 	} else {
-		uae_u32 idx = ((addr & mmu030.translation.page.imask) >> mmu030.translation.page.size3m) | 7;
-		for (int i = 0; i < MMUFASTCACHE_ENTRIES030; i++) {
-			if ((atc_data_cache_read[i].log | 7) == idx)
-				atc_data_cache_read[i].log = 0xffffffff;
-			if ((atc_data_cache_write[i].log | 7) == idx)
-				atc_data_cache_write[i].log = 0xffffffff;
+		for (uae_u32 fc = 0; fc < 8; fc++) {
+			uae_u32 key = mmu030_fastcache_key(addr, fc);
+			mmu030_fastcache_flush_page(atc_data_cache_read, key);
+			mmu030_fastcache_flush_page(atc_data_cache_write, key);
 		}
 	}
 #endif
@@ -627,6 +682,9 @@ TT_info mmu030_decode_tt(uae_u32 TT) {
     
     TT_info ret;
 
+	// cached data translations may include transparently translated pages
+	mmu030_flush_cache(0xffffffff);
+
     ret.fc_mask = ~((TT&TT_FC_MASK)|0xFFFFFFF8);
     ret.fc_base = (TT&TT_FC_BASE)>>4;
     ret.addr_base = TT & TT_ADDR_BASE;
@@ -839,9 +897,7 @@ static void mmu030_do_fake_prefetch(void)
 
 bool mmu030_decode_tc(uae_u32 TC, bool check)
 {
-#if MMU_IPAGECACHE030
-	mmu030.mmu030_last_logical_address = 0xffffffff;
-#endif
+	mmu030_flush_cache(0xffffffff);
 
 	if (currprefs.mmu_ec)
 		TC &= ~TC_ENABLE_TRANSLATION;
@@ -990,7 +1046,8 @@ bool mmu030_decode_tc(uae_u32 TC, bool check)
 #define RP_ZERO_BITS 0x0000FFFC /* These bits in upper longword of RP must be 0 */
 
 bool mmu030_decode_rp(uae_u64 RP) {
-    
+
+	mmu030_flush_cache(0xffffffff);
     uae_u8 descriptor_type = (uae_u8)((RP & RP_DESCR_MASK) >> 32);
     if (!descriptor_type) { /* If descriptor type is invalid */
         write_log(_T("MMU Configuration Exception: Root Pointer is invalid!\n"));
@@ -1634,6 +1691,10 @@ static uae_u32 mmu030_table_search(uaecptr addr, uae_u32 fc, bool write, int lev
 	}
 
     mmu030_atc_handle_history_bit(i);
+
+	/* Replaced entry must not survive in the shortcut cache */
+	if (mmu030.atc[i].logical.valid)
+		mmu030_flush_cache(mmu030.atc[i].logical.addr);
     
     /* Create ATC entry */
     mmu030.atc[i].logical.addr = addr & mmu030.translation.page.imask; /* delete page index bits */
@@ -1916,26 +1977,14 @@ bool mmu030_is_super_access(bool read)
 static void mmu030_add_data_read_cache(uaecptr addr, uaecptr phys, uae_u32 fc)
 {
 #if MMU_DPAGECACHE030
-	uae_u32 idx1 = ((addr & mmu030.translation.page.imask) >>  mmu030.translation.page.size3m) | fc;
-	uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES030 - 1);
-	if (idx2 < MMUFASTCACHE_ENTRIES030 - 1) {
-		atc_data_cache_read[idx2].log = idx1;
-		atc_data_cache_read[idx2].phys = phys;
-		atc_data_cache_read[idx2].cs = mmu030_cache_state;
-	}
+	mmu030_fastcache_add(atc_data_cache_read, mmu030_fastcache_key(addr, fc), phys);
 #endif
 }
 
 static void mmu030_add_data_write_cache(uaecptr addr, uaecptr phys, uae_u32 fc)
 {
 #if MMU_DPAGECACHE030
-	uae_u32 idx1 = ((addr & mmu030.translation.page.imask) >>  mmu030.translation.page.size3m) | fc;
-	uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES030 - 1);
-	if (idx2 < MMUFASTCACHE_ENTRIES030 - 1) {
-		atc_data_cache_write[idx2].log = idx1;
-		atc_data_cache_write[idx2].phys = phys;
-		atc_data_cache_write[idx2].cs = mmu030_cache_state;
-	}
+	mmu030_fastcache_add(atc_data_cache_write, mmu030_fastcache_key(addr, fc), phys);
 #endif
 }
 
@@ -2108,28 +2157,86 @@ STATIC_INLINE void cacheablecheck(uaecptr addr)
 	}
 }
 
-void mmu030_put_long(uaecptr addr, uae_u32 val, uae_u32 fc)
+#if MMU_DPAGECACHE030 && MMU030_FASTCACHE_CHECK
+/* Debug: verify a shortcut cache hit against TTx and the ATC contents */
+static void mmu030_fastcache_check(uaecptr addr, uae_u32 fc, bool write, const struct mmufastcache030 *c)
 {
- 	mmu030_cache_state = CACHE_ENABLE_ALL;
-	if (fc != 7 && (!tt_enabled || !mmu030_match_ttr_access(addr,fc,true)) && mmu030.enabled) {
-#if MMU_DPAGECACHE030
-		uae_u32 idx1 = ((addr & mmu030.translation.page.imask) >> mmu030.translation.page.size3m) | fc;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES030 - 1);
-		if (atc_data_cache_write[idx2].log == idx1) {
-			addr = atc_data_cache_write[idx2].phys | (addr & mmu030.translation.page.mask);
-			mmu030_cache_state = atc_data_cache_write[idx2].cs;
-		} else
-#endif
-		{
-			int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
-			if (atc_line_num>=0) {
-				addr = mmu030_put_atc(addr, atc_line_num, fc, MMU030_SSW_SIZE_L);
-			} else {
-				mmu030_table_search(addr,fc,true,0);
-				addr = mmu030_put_atc(addr, mmu030_logical_is_in_atc(addr,fc,true), fc, MMU030_SSW_SIZE_L);
+	uae_u32 maddr = addr & mmu030.translation.page.imask;
+	uae_u32 phys = 0xffffffff;
+	if (mmu030_match_ttr_access(addr, fc, write)) {
+		phys = maddr;
+	} else {
+		for (int i = 0; i < ATC030_NUM_ENTRIES; i++) {
+			MMU030_ATC_LINE *l = &mmu030.atc[i];
+			if (l->logical.valid && l->logical.fc == fc && (l->logical.addr & mmu030.translation.page.imask) == maddr) {
+				if (!l->physical.bus_error && (!write || (l->physical.modified && !l->physical.write_protect)))
+					phys = l->physical.addr & mmu030.translation.page.imask;
+				break;
 			}
 		}
 	}
+	if (phys != c->phys) {
+		atc_data_cache_mismatch++;
+		write_log(_T("MMU030 fast cache mismatch #%u: %c %08x FC=%d cached=%08x expected=%08x PC=%08x\n"),
+			atc_data_cache_mismatch, write ? 'W' : 'R', addr, fc, c->phys, phys, M68K_GETPC);
+	}
+}
+#endif
+
+STATIC_INLINE uaecptr mmu030_translate_data_write(uaecptr addr, uae_u32 fc, uae_u32 size)
+{
+#if MMU_DPAGECACHE030
+	struct mmufastcache030 *c = mmu030_fastcache_lookup(atc_data_cache_write, mmu030_fastcache_key(addr, fc));
+	if (c) {
+#if MMU030_FASTCACHE_CHECK
+		mmu030_fastcache_check(addr, fc, true, c);
+#endif
+		mmu030_cache_state = c->cs;
+		return c->phys | (addr & mmu030.translation.page.mask);
+	}
+#endif
+	if (tt_enabled && mmu030_match_ttr_access(addr, fc, true)) {
+		mmu030_add_data_write_cache(addr, addr & mmu030.translation.page.imask, fc);
+		return addr;
+	}
+	int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
+	if (atc_line_num < 0) {
+		mmu030_table_search(addr, fc, true, 0);
+		atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
+	}
+	return mmu030_put_atc(addr, atc_line_num, fc, size);
+}
+
+STATIC_INLINE uaecptr mmu030_translate_data_read(uaecptr addr, uae_u32 fc, uae_u32 size)
+{
+#if MMU_DPAGECACHE030
+	struct mmufastcache030 *c = mmu030_fastcache_lookup(atc_data_cache_read, mmu030_fastcache_key(addr, fc));
+	if (c) {
+#if MMU030_FASTCACHE_CHECK
+		mmu030_fastcache_check(addr, fc, false, c);
+#endif
+		mmu030_cache_state = c->cs;
+		return c->phys | (addr & mmu030.translation.page.mask);
+	}
+#endif
+	if (tt_enabled && mmu030_match_ttr_access(addr, fc, false)) {
+		mmu030_add_data_read_cache(addr, addr & mmu030.translation.page.imask, fc);
+		return addr;
+	}
+	int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
+	if (atc_line_num < 0) {
+		mmu030_table_search(addr, fc, false, 0);
+		atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
+	}
+	return mmu030_get_atc(addr, atc_line_num, fc, size);
+}
+
+void mmu030_put_long(uaecptr addr, uae_u32 val, uae_u32 fc)
+{
+ 	mmu030_cache_state = CACHE_ENABLE_ALL;
+	if (fc != 7 && mmu030.enabled) {
+		addr = mmu030_translate_data_write(addr, fc, MMU030_SSW_SIZE_L);
+	}
 	cacheablecheck(addr);
 	x_phys_put_long(addr,val);
 }
@@ -2137,24 +2244,8 @@ void mmu030_put_long(uaecptr addr, uae_u32 val, uae_u32 fc)
 void mmu030_put_word(uaecptr addr, uae_u16 val, uae_u32 fc)
 {
  	mmu030_cache_state = CACHE_ENABLE_ALL;
-	if (fc != 7 && (!tt_enabled || !mmu030_match_ttr_access(addr,fc,true)) && mmu030.enabled) {
-#if MMU_DPAGECACHE030
-		uae_u32 idx1 = ((addr & mmu030.translation.page.imask) >> mmu030.translation.page.size3m) | fc;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES030 - 1);
-		if (atc_data_cache_write[idx2].log == idx1) {
-			addr = atc_data_cache_write[idx2].phys | (addr & mmu030.translation.page.mask);
-			mmu030_cache_state = atc_data_cache_write[idx2].cs;
-		} else
-#endif
-		{
-			int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
-			if (atc_line_num>=0) {
-				addr = mmu030_put_atc(addr, atc_line_num, fc, MMU030_SSW_SIZE_W);
-			} else {
-				mmu030_table_search(addr, fc, true, 0);
-				addr = mmu030_put_atc(addr,  mmu030_logical_is_in_atc(addr,fc,true), fc, MMU030_SSW_SIZE_W);
-			}
-		}
+	if (fc != 7 && mmu030.enabled) {
+		addr = mmu030_translate_data_write(addr, fc, MMU030_SSW_SIZE_W);
 	}
 	cacheablecheck(addr);
 	x_phys_put_word(addr,val);
@@ -2163,24 +2254,8 @@ void mmu030_put_word(uaecptr addr, uae_u16 val, uae_u32 fc)
 void mmu030_put_byte(uaecptr addr, uae_u8 val, uae_u32 fc)
 {
  	mmu030_cache_state = CACHE_ENABLE_ALL;
-	if (fc != 7 && (!tt_enabled || !mmu030_match_ttr_access(addr,fc,true)) && mmu030.enabled) {
-#if MMU_DPAGECACHE030
-		uae_u32 idx1 = ((addr & mmu030.translation.page.imask) >> mmu030.translation.page.size3m) | fc;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES030 - 1);
-		if (atc_data_cache_write[idx2].log == idx1) {
-			addr = atc_data_cache_write[idx2].phys | (addr & mmu030.translation.page.mask);
-			mmu030_cache_state = atc_data_cache_write[idx2].cs;
-		} else
-#endif
-		{
-			int atc_line_num = mmu030_logical_is_in_atc(addr, fc, true);
-			if (atc_line_num>=0) {
-				addr = mmu030_put_atc(addr, atc_line_num, fc, MMU030_SSW_SIZE_B);
-			} else {
-				mmu030_table_search(addr, fc, true, 0);
-				addr = mmu030_put_atc(addr, mmu030_logical_is_in_atc(addr,fc,true), fc, MMU030_SSW_SIZE_B);
-			}
-		}
+	if (fc != 7 && mmu030.enabled) {
+		addr = mmu030_translate_data_write(addr, fc, MMU030_SSW_SIZE_B);
 	}
 	cacheablecheck(addr);
 	x_phys_put_byte(addr,val);
@@ -2190,24 +2265,8 @@ void mmu030_put_byte(uaecptr addr, uae_u8 val, uae_u32 fc)
 uae_u32 mmu030_get_long(uaecptr addr, uae_u32 fc)
 {
  	mmu030_cache_state = CACHE_ENABLE_ALL;
-	if (fc != 7 && (!tt_enabled || !mmu030_match_ttr_access(addr,fc,false)) && mmu030.enabled) {
-#if MMU_DPAGECACHE030
-		uae_u32 idx1 = ((addr & mmu030.translation.page.imask) >> mmu030.translation.page.size3m) | fc;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES030 - 1);
-		if (atc_data_cache_read[idx2].log == idx1) {
-			addr = atc_data_cache_read[idx2].phys | (addr & mmu030.translation.page.mask);
-			mmu030_cache_state = atc_data_cache_read[idx2].cs;
-		} else
-#endif
-		{
-			int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
-			if (atc_line_num>=0) {
-				addr = mmu030_get_atc(addr, atc_line_num, fc, MMU030_SSW_SIZE_L);
-			} else {
-				mmu030_table_search(addr, fc, false, 0);
-				addr = mmu030_get_atc(addr, mmu030_logical_is_in_atc(addr,fc,false), fc, MMU030_SSW_SIZE_L);
-			}
-		}
+	if (fc != 7 && mmu030.enabled) {
+		addr = mmu030_translate_data_read(addr, fc, MMU030_SSW_SIZE_L);
 	}
 	cacheablecheck(addr);
 	uae_u32 v = x_phys_get_long(addr);
@@ -2217,24 +2276,8 @@ uae_u32 mmu030_get_long(uaecptr addr, uae_u32 fc)
 uae_u16 mmu030_get_word(uaecptr addr, uae_u32 fc)
 {
  	mmu030_cache_state = CACHE_ENABLE_ALL;
-	if (fc != 7 && (!tt_enabled || !mmu030_match_ttr_access(addr,fc,false)) && mmu030.enabled) {
-#if MMU_DPAGECACHE030
-		uae_u32 idx1 = ((addr & mmu030.translation.page.imask) >> mmu030.translation.page.size3m) | fc;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES030 - 1);
-		if (atc_data_cache_read[idx2].log == idx1) {
-			addr = atc_data_cache_read[idx2].phys | (addr & mmu030.translation.page.mask);
-			mmu030_cache_state = atc_data_cache_read[idx2].cs;
-		} else
-#endif
-		{
-			int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
-		    if (atc_line_num>=0) {
-				addr = mmu030_get_atc(addr, atc_line_num, fc, MMU030_SSW_SIZE_W);
-			} else {
-				mmu030_table_search(addr, fc, false, 0);
-				addr = mmu030_get_atc(addr, mmu030_logical_is_in_atc(addr,fc,false), fc, MMU030_SSW_SIZE_W);
-			}
-		}
+	if (fc != 7 && mmu030.enabled) {
+		addr = mmu030_translate_data_read(addr, fc, MMU030_SSW_SIZE_W);
 	}
 	cacheablecheck(addr);
 	uae_u16 v = x_phys_get_word(addr);
@@ -2244,24 +2287,8 @@ uae_u16 mmu030_get_word(uaecptr addr, uae_u32 fc)
 uae_u8 mmu030_get_byte(uaecptr addr, uae_u32 fc)
 {
  	mmu030_cache_state = CACHE_ENABLE_ALL;
-	if (fc != 7 && (!tt_enabled || !mmu030_match_ttr_access(addr,fc,false)) && mmu030.enabled) {
-#if MMU_DPAGECACHE030
-		uae_u32 idx1 = ((addr & mmu030.translation.page.imask) >> mmu030.translation.page.size3m) | fc;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES030 - 1);
-		if (atc_data_cache_read[idx2].log == idx1) {
-			addr = atc_data_cache_read[idx2].phys | (addr & mmu030.translation.page.mask);
-			mmu030_cache_state = atc_data_cache_read[idx2].cs;
-		} else
-#endif
-		{
-			int atc_line_num = mmu030_logical_is_in_atc(addr, fc, false);
-			if (atc_line_num>=0) {
-				addr = mmu030_get_atc(addr, atc_line_num, fc, MMU030_SSW_SIZE_B);
-			} else {
-				mmu030_table_search(addr, fc, false, 0);
-				addr = mmu030_get_atc(addr, mmu030_logical_is_in_atc(addr,fc,false), fc, MMU030_SSW_SIZE_B);
-			}
-		}
+	if (fc != 7 && mmu030.enabled) {
+		addr = mmu030_translate_data_read(addr, fc, MMU030_SSW_SIZE_B);
 	}
 	cacheablecheck(addr);
 	uae_u8 v = x_phys_get_byte(addr);
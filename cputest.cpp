@@ -882,6 +882,10 @@ uae_u16 get_wordi_test(int o)
 	return v;
 }
 
+// no direct banks, everything goes through the test handlers
+uae_u8 *mem_direct_r[MEMORY_BANKS];
+uae_u8 *mem_direct_w[MEMORY_BANKS];
+
 uae_u32 memory_get_byte(uaecptr addr)
 {
 	return get_byte_test(addr);
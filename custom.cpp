@@ -383,7 +383,6 @@ static int extra_cycle;
 
 static int rpt_did_reset;
 struct ev eventtab[ev_max];
-struct ev2 eventtab2[ev2_max];
 
 int vpos, vpos_prev;
 bool lof_store; // real bit in custom registers
@@ -3446,7 +3445,7 @@ static void doint_delay_intreq(uae_u16 v)
 						ev->data == 8 && (v & 0x0100) ||
 						ev->data == 9 && (v & 0x0200) ||
 						ev->data == 10 && (v & 0x0400)) {
-						ev->active = false;
+						event2_remevent(i);
 					}
 				}
 			}
@@ -4396,7 +4395,7 @@ bool blitter_cant_access(void)
 }
 
 // return if register is in Agnus or Denise (or both)
-static int get_reg_chip(int reg)
+static int calc_reg_chip(int reg)
 {
 #if VPOSW_DISABLED
 	if (reg == 0x2a || reg == 0x2c) {
@@ -4435,6 +4434,21 @@ static int get_reg_chip(int reg)
 	return 1;
 }
 
+// Copper MOVE and CPU write target lookup, rebuilt if cycle exact mode changes (VPOSW)
+static uae_u8 reg_chip_tab[0x200 / 2];
+static int reg_chip_tab_ce = -1;
+
+STATIC_INLINE int get_reg_chip(int reg)
+{
+	if (reg_chip_tab_ce != currprefs.cpu_memory_cycle_exact) {
+		reg_chip_tab_ce = currprefs.cpu_memory_cycle_exact;
+		for (int i = 0; i < 0x200; i += 2) {
+			reg_chip_tab[i >> 1] = calc_reg_chip(i);
+		}
+	}
+	return reg_chip_tab[reg >> 1];
+}
+
 static void custom_wput_pipelined(uaecptr pt, uae_u16 v)
 {
 	pipelined_write_addr = pt;
@@ -4694,6 +4708,9 @@ static void maybe_process_pull_audio(void)
 
 static bool crender_screen(int monid, int mode, bool immediate)
 {
+	if (currprefs.nodisplay) {
+		return false;
+	}
 	if (currprefs.gfx_vresolution && interlace_seen > 0 && currprefs.gfx_iscanlines == 0) {
 		// if non-fields interlace mode: render only complete frames
 		if (!lof_display) {
@@ -4760,6 +4777,16 @@ static bool framewait(void)
 
 	frameskiptime = 0;
 
+	// no display: nothing to render or show, never wait
+	if (currprefs.nodisplay) {
+		curr_time = read_processor_time();
+		vsyncmintime = curr_time;
+		vsyncmaxtime = vsyncwaittime = curr_time + vsynctimebase;
+		vsynctimeperline = 1;
+		frame_shown = true;
+		return true;
+	}
+
 	if (vs > 0) {
 
 		static struct mavg_data ma_legacy;
@@ -5360,6 +5387,10 @@ static void virtual_vsync_check(void)
 }
 
 // emulated hardware vsync
+static frame_time_t nodisplay_start;
+static double nodisplay_emutime;
+static uae_u32 nodisplay_frames;
+
 static void vsync_handler_post(void)
 {
 	int monid = 0;
@@ -5368,6 +5399,14 @@ static void vsync_handler_post(void)
 	//write_log (_T("%d %d %d\n"), vsynctimebase, read_processor_time () - vsyncmintime, read_processor_time () - prevtime);
 	prevtime = read_processor_time();
 
+	if (currprefs.nodisplay && vblank_hz > 0) {
+		if (!nodisplay_start) {
+			nodisplay_start = prevtime;
+		}
+		nodisplay_emutime += 1.0 / vblank_hz;
+		nodisplay_frames++;
+	}
+
 	check_nocustom();
 
 #if CUSTOM_DEBUG > 1
@@ -7801,8 +7840,10 @@ void custom_prepare_savestate(void)
 	if (!currprefs.cpu_cycle_exact) {
 		for (int i = 0; i < ev2_max; i++) {
 			if (eventtab2[i].active) {
-				eventtab2[i].active = 0;
-				eventtab2[i].handler(eventtab2[i].data);
+				evfunc2 f = eventtab2[i].handler;
+				uae_u32 data = eventtab2[i].data;
+				event2_remevent(i);
+				f(data);
 			}
 		}
 	}
@@ -8662,9 +8703,10 @@ uae_u8 *restore_custom_slots(uae_u8 *src)
 
 uae_u8 *restore_custom_event_delay(uae_u8 *src)
 {
-	if (restore_u32() != 1)
+	uae_u32 v = restore_u32();
+	if (v != 1 && v != 2)
 		return src;
-	int cnt = restore_u8();
+	int cnt = v == 1 ? restore_u8() : restore_u32();
 	for (int i = 0; i < cnt; i++) {
 		uae_u8 type = restore_u8();
 		evt_t e = restore_u64();
@@ -8718,11 +8760,64 @@ uae_u8 *restore_custom_event_delay(uae_u8 *src)
 	}
 	return src;
 }
+static uae_u8 save_custom_event_type(evfunc2 f)
+{
+	if (f == event_send_interrupt_do_ext) {
+		return 1;
+	} else if (f == event_doint_delay_do_ext_old) {
+		return 2;
+	} else if (f == event_audxdat_func) {
+		return 3;
+	} else if (f == event_setdsr) {
+		return 4;
+	} else if (f == event_CIA_synced_interrupt) {
+		return 5;
+	} else if (f == event_doint_delay_do_intreq) {
+		return 6;
+	} else if (f == event_doint_delay_do_intena) {
+		return 7;
+	} else if (f == event_CIA_tod_inc_event) {
+		return 8;
+	} else if (f == event_DISK_handler) {
+		return 9;
+	} else if (f == bitplane_dma_change) {
+		return 10;
+	} else if (f == event_doint_delay_do_ext) {
+		return 11;
+	}
+	return 0;
+}
+
+// upper bound of save_custom_event_delay() output
+size_t save_custom_event_delay_size(void)
+{
+	int cnt = 0;
+	for (int i = ev2_misc; i < ev2_max; i++) {
+		if (eventtab2[i].active) {
+			cnt++;
+		}
+	}
+	return 4 + 4 + cnt * (1 + 8 + 4);
+}
+
 uae_u8 *save_custom_event_delay(size_t *len, uae_u8 *dstptr)
 {
 	uae_u8 *dstbak, *dst;
 	int cnt = 0, cnt2 = 0;
 
+	// events that can't be saved are executed immediately
+	for (int i = ev2_misc; i < ev2_max; i++) {
+		struct ev2 *e = &eventtab2[i];
+		if (e->active && !save_custom_event_type(e->handler)) {
+			evfunc2 f = e->handler;
+			uae_u32 data = e->data;
+			write_log("unknown event2 handler %p\n", f);
+			event2_remevent(i);
+			// handler can add new events and reallocate eventtab2
+			f(data);
+		}
+	}
+
 	for (int i = ev2_misc; i < ev2_max; i++) {
 		struct ev2 *e = &eventtab2[i];
 		if (e->active) {
@@ -8735,42 +8830,21 @@ uae_u8 *save_custom_event_delay(size_t *len, uae_u8 *dstptr)
 	if (dstptr)
 		dstbak = dst = dstptr;
 	else
-		dstbak = dst = xmalloc(uae_u8, 1000);
+		dstbak = dst = xmalloc(uae_u8, 4 + 4 + cnt * (1 + 8 + 4));
 
-	save_u32(1);
-	save_u8(cnt);
+	// version 1 (u8 count) unless there are too many events for it
+	if (cnt <= 255) {
+		save_u32(1);
+		save_u8(cnt);
+	} else {
+		save_u32(2);
+		save_u32(cnt);
+	}
 	for (int i = ev2_misc; i < ev2_max; i++) {
 		struct ev2 *e = &eventtab2[i];
 		if (e->active) {
-			evfunc2 f = e->handler;
-			uae_u8 type = 0;
-			if (f == event_send_interrupt_do_ext) {
-				type = 1;
-			} else if (f == event_doint_delay_do_ext_old) {
-				type = 2;
-			} else if (f == event_audxdat_func) {
-				type = 3;
-			} else if (f == event_setdsr) {
-				type = 4;
-			} else if (f == event_CIA_synced_interrupt) {
-				type = 5;
-			} else if (f == event_doint_delay_do_intreq) {
-				type = 6;
-			} else if (f == event_doint_delay_do_intena) {
-				type = 7;
-			} else if (f == event_CIA_tod_inc_event) {
-				type = 8;
-			} else if (f == event_DISK_handler) {
-				type = 9;
-			} else if (f == bitplane_dma_change) {
-				type = 10;
-			} else if (f == event_doint_delay_do_ext) {
-				type = 11;
-			} else {
-				write_log("unknown event2 handler %p\n", e->handler);
-				e->active = false;
-				f(e->data);
-			}
+			// type 0: added by unknown handler above, ignored when restored
+			uae_u8 type = save_custom_event_type(e->handler);
 			if (type) {
 				cnt2++;
 			}
@@ -12883,3 +12957,17 @@ void custom_end_drawing(void)
 	draw_denise_line_queue_flush();
 	end_draw_denise();
 }
+
+// emulated seconds per host second of no display run
+void custom_nodisplay_report(void)
+{
+	if (!nodisplay_start || !nodisplay_frames) {
+		return;
+	}
+	double host = (double)(read_processor_time() - nodisplay_start) / syncbase;
+	write_log(_T("No display: %u frames, %.2fs emulated in %.2fs host time, %.2fx real time\n"),
+		nodisplay_frames, nodisplay_emutime, host, host > 0 ? nodisplay_emutime / host : 0.0);
+	nodisplay_start = 0;
+	nodisplay_emutime = 0;
+	nodisplay_frames = 0;
+}
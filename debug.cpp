@@ -50,6 +50,8 @@
 #include "drawing.h"
 #include "devices.h"
 #include "blitter.h"
+#include "audio.h"
+#include "filesys.h"
 #include "ini.h"
 #include "readcpu.h"
 #include "keybuf.h"
@@ -205,6 +207,7 @@ static const TCHAR help[] = {
 	_T("   reg=Dx,Ax,PC,USP,ISP,VBR,SR. oper:!=,==,<,>,>=,<=,-,!- (-=val to val2 range).\n")
 	_T("  f <addr1> <addr2>     Step forward until <addr1> <= PC <= <addr2>.\n")
 	_T("  e[x]                  Dump contents of all custom registers, ea = AGA colors.\n")
+	_T("  ev                    Show event queue state and per handler dispatch counts.\n")
 	_T("  i [<addr>]            Dump contents of interrupt and trap vectors.\n")
 	_T("  il [<mask>]           Exception breakpoint.\n")
 	_T("  o <0-2|addr> [<lines>]View memory as Copper instructions.\n")
@@ -234,6 +237,10 @@ static const TCHAR help[] = {
 	_T("  Td,Tl,Tr,Tp,Ts,TS,Ti,TO,TM,Tf Show devs, libs, resources, ports, semaphores,\n")
 	_T("                        residents, interrupts, doslist, memorylist, fsres.\n")
 	_T("  b                     Step to previous state capture position.\n")
+	_T("  bb [<rounds>]         Blitter fast path self-check and benchmark.\n")
+	_T("  ba [<rounds>]         Paula sinc mixer self-check and benchmark.\n")
+	_T("  bl [<rounds>]         Line renderer SIMD span self-check and benchmark.\n")
+	_T("  bh [<unit>] [<MB>]    Hardfile 64K-1M sequential read benchmark.\n")
 	_T("  M<a/b/s> <val>        Enable or disable audio channels, bitplanes or sprites.\n")
 	_T("  sp <addr> [<addr2][<size>] Dump sprite information.\n")
 	_T("  di <mode> [<track>]   Break on disk access. R=DMA read,W=write,RW=both,P=PIO.\n")
@@ -6917,6 +6924,10 @@ static bool debug_line (TCHAR *input)
 		}
 		case 'e':
 		{
+			if (tolower(*inptr) == 'v') {
+				events_dump_stats();
+				break;
+			}
 			bool aga = tolower(*inptr) == 'a';
 			if (aga)
 				next_char(&inptr);
@@ -7454,6 +7465,27 @@ static bool debug_line (TCHAR *input)
 		case 'O':
 			break;
 		case 'b':
+			if (*inptr == 'b') {
+				next_char(&inptr);
+				blitter_benchmark(more_params(&inptr) ? readint(&inptr, NULL) : 0);
+				break;
+			}
+			if (*inptr == 'a') {
+				next_char(&inptr);
+				audio_benchmark(more_params(&inptr) ? readint(&inptr, NULL) : 0);
+				break;
+			}
+			if (*inptr == 'l') {
+				next_char(&inptr);
+				linetoscr_simd_benchmark(more_params(&inptr) ? readint(&inptr, NULL) : 0);
+				break;
+			}
+			if (*inptr == 'h') {
+				next_char(&inptr);
+				int unit = more_params(&inptr) ? readint(&inptr, NULL) : 0;
+				hardfile_benchmark(unit, more_params(&inptr) ? readint(&inptr, NULL) : 0);
+				break;
+			}
 			if (staterecorder (&inptr))
 				return true;
 			break;
@@ -32,6 +32,7 @@
 #include "blkdev.h"
 #include "parallel.h"
 #include "autoconf.h"
+#include "filesys.h"
 #include "sampler.h"
 #include "newcpu.h"
 #include "blitter.h"
@@ -273,6 +274,7 @@ void devices_vsync_pre(void)
 	CIA_vsync_prehandler();
 	inputdevice_vsync();
 	filesys_vsync();
+	hardfile_vsync();
 	sampler_vsync();
 	clipboard_vsync();
 	statusline_vsync();
@@ -391,6 +393,7 @@ void virtualdevice_free(void)
 void do_leave_program (void)
 {
 	virtualdevice_free();
+	drawing_free();
 	graphics_leave();
 	close_sound();
 	if (! no_gui)
@@ -119,6 +119,10 @@ static void denise_handle_quick_strobe(uae_u16 strobe, int offset, int vpos);
 static void draw_denise_vsync(int);
 static void denise_update_reg(uae_u16 reg, uae_u16 v, uae_u32 linecnt);
 static void draw_denise_line(int gfx_ypos, nln_how how, uae_u32 linecnt, int startpos, int startcycle, int endcycle, int skip, int skip2, int dtotal, int calib_start, int calib_len, bool lol, int hdelay, bool blanked, bool finalseg, struct linestate *ls);
+static bool denise_line_dispatch(struct denise_rga_queue *q);
+static void denise_line_workers_sync(void);
+static void denise_line_workers_reset(void);
+static void denise_line_workers_stop(void);
 
 static void sprwrite(int reg, uae_u32 v);
 static int spr_unalign_reg, spr_unalign_val;
@@ -168,13 +172,24 @@ static void read_denise_line_queue(void)
 #endif
 
 
+	// lines that need full Denise state wait for line workers
+	if (q->type == 0 || q->type == 5 || q->type == 7) {
+		denise_line_workers_sync();
+	}
+
 	if (q->type == 0) {
 		draw_denise_line(q->gfx_ypos, q->how, q->linecnt, q->startpos, q->startcycle, q->endcycle, q->skip, q->skip2, q->dtotal, q->calib_start, q->calib_len, q->lol, q->hdelay, q->blanked, q->finalseg, q->ls);
 		next = q->finalseg;
 	} else if (q->type == 1) {
-		draw_denise_bitplane_line_fast(q->gfx_ypos, q->how, q->ls);
+		if (!denise_line_dispatch(q)) {
+			denise_line_workers_sync();
+			draw_denise_bitplane_line_fast(q->gfx_ypos, q->how, q->ls);
+		}
 	} else if (q->type == 2) {
-		draw_denise_border_line_fast(q->gfx_ypos, q->blanked, q->how, q->ls);
+		if (!denise_line_dispatch(q)) {
+			denise_line_workers_sync();
+			draw_denise_border_line_fast(q->gfx_ypos, q->blanked, q->how, q->ls);
+		}
 	} else if (q->type == 3) {
 		quick_denise_rga(q->linecnt, q->startpos, q->endpos);
 	} else if (q->type == 4) {
@@ -395,7 +410,42 @@ static struct denise_rga rga_denise_fast[DENISE_RGA_SLOT_FAST_TOTAL];
 typedef void (*LINETOSRC_FUNC)(void);
 static LINETOSRC_FUNC lts;
 static bool lts_changed, lts_request;
-typedef void (*LINETOSRC_FUNCF)(int,int,int,int,int,int,int,int,uae_u32,uae_u8**,uae_u8**,int,int*,int,struct linestate*);
+
+// Fast line (linestate) renderer state. Denise thread uses fastline_main,
+// each line worker thread has its own copy with private scratch buffers.
+struct fastline_state
+{
+	// output position
+	uae_u32 *buf1, *buf2, *buf_d;
+	uae_u8 *gbuf;
+	uae_u32 *buf1t, *buf2t;
+	uae_u8 *gbuft;
+	uae_u8 *xlinebuffer, *xlinebuffer_start, *xlinebuffer_end;
+	uae_u8 *xlinebuffer2, *xlinebuffer2_start, *xlinebuffer2_end;
+	uae_u8 *xlinebuffer_genlock, *xlinebuffer_genlock_start, *xlinebuffer_genlock_end;
+	// Denise register state when line was queued
+	uae_u16 *bplcoltable;
+	int *dpf_lookup, *dpf_lookup_no;
+	int bpldualpf2of;
+	uae_u8 bplehb_mask;
+	bool strlong_seen;
+	int planes, res;
+	// results, merged to globals by fastline_merge()
+	uae_u16 clxdat;
+	int resolution_count[RES_MAX + 1], lines_count;
+	int diwfirstword, diwlastword;
+	int y_end;
+	// scratch
+	uae_u32 *chunky_out, *dpf_chunky_out;
+	int chunky_out_prev_len;
+	uae_u8 *row_tmp8;
+	int row_tmp8_size;
+	uae_u32 *debug_buf;
+};
+static struct fastline_state fastline_main;
+static void fastline_init(struct fastline_state *fs, uae_u32 *chunky, uae_u32 *dpf_chunky, uae_u8 *tmprow, int tmprow_size, uae_u32 *debugbuf);
+
+typedef void (*LINETOSRC_FUNCF)(int,int,int,int,int,int,int,int,uae_u32,uae_u8**,uae_u8**,int,int*,int,struct linestate*,struct fastline_state*);
 
 static int denise_hcounter, denise_hcounter_next, denise_hcounter_new, denise_hcounter_prev, denise_hcounter_cmp;
 static bool denise_accurate_mode;
@@ -1745,31 +1795,42 @@ uae_u8 *get_row_genlock(int monid, int line)
 	return row_map_genlock_buffer + vidinfo->inbuffer->width_allocated * (line + 1);
 }
 
-static void setxlinebuffer(int monid, int line)
+static void setxlinebuffer_state(struct fastline_state *fs, int monid, int line)
 {
 	struct vidbuf_description* vidinfo = &adisplays[monid].gfxvidinfo;
 
 	line += thisframe_y_adjust_real;
 	if (line < 0 || line >= max_uae_height) {
-		xlinebuffer = get_row(monid, -1);
-		xlinebuffer_genlock = NULL;
-
-		xlinebuffer_start = xlinebuffer;
-		xlinebuffer_end = xlinebuffer + (vidinfo->inbuffer->outwidth * sizeof(uae_u32));
-
+		fs->xlinebuffer = get_row(monid, -1);
+		fs->xlinebuffer_genlock = NULL;
 	} else {
-		xlinebuffer = get_row(monid, line);
+		fs->xlinebuffer = get_row(monid, line);
 
-		xlinebuffer_start = xlinebuffer;
-		xlinebuffer_end = xlinebuffer + (vidinfo->inbuffer->outwidth * sizeof(uae_u32));
-
-		xlinebuffer_genlock = get_row_genlock(monid, line);
-		if (xlinebuffer_genlock) {
-			xlinebuffer_genlock_start = xlinebuffer_genlock;
-			xlinebuffer_genlock_end = xlinebuffer_genlock + (vidinfo->inbuffer->outwidth);
+		fs->xlinebuffer_genlock = get_row_genlock(monid, line);
+		if (fs->xlinebuffer_genlock) {
+			fs->xlinebuffer_genlock_start = fs->xlinebuffer_genlock;
+			fs->xlinebuffer_genlock_end = fs->xlinebuffer_genlock + (vidinfo->inbuffer->outwidth);
 		}
-
 	}
+	// invisible line: draw to thread's own dummy row
+	if (fs->xlinebuffer == row_tmp8 && fs->row_tmp8) {
+		fs->xlinebuffer = fs->row_tmp8;
+	}
+	fs->xlinebuffer_start = fs->xlinebuffer;
+	fs->xlinebuffer_end = fs->xlinebuffer + (vidinfo->inbuffer->outwidth * sizeof(uae_u32));
+}
+
+static void setxlinebuffer(int monid, int line)
+{
+	struct fastline_state *fs = &fastline_main;
+
+	setxlinebuffer_state(fs, monid, line);
+	xlinebuffer = fs->xlinebuffer;
+	xlinebuffer_start = fs->xlinebuffer_start;
+	xlinebuffer_end = fs->xlinebuffer_end;
+	xlinebuffer_genlock = fs->xlinebuffer_genlock;
+	xlinebuffer_genlock_start = fs->xlinebuffer_genlock_start;
+	xlinebuffer_genlock_end = fs->xlinebuffer_genlock_end;
 }
 
 static uae_u8 *status_line_ptr(int monid, int line)
@@ -2016,13 +2077,16 @@ static void finish_drawing_frame(bool drawlines)
 	struct vidbuffer *vbout = vidinfo->outbuffer;
 	struct vidbuffer *vbin = vidinfo->inbuffer;
 
-	if (!drawlines || !vbout || !vbin) {
+	if (!drawlines || !vbout || !vbin || currprefs.nodisplay) {
 		return;
 	}
 
 	vbout->last_drawn_line = 0;
 	vbout->hardwiredpositioning = false;
 
+	// all lines of this frame, including line workers, must be finished
+	draw_denise_line_queue_flush();
+
 	draw_frame_extras(vbin, -1, -1);
 
 #ifdef WITH_SPECIALMONITORS
@@ -2411,6 +2475,7 @@ void drawing_init(void)
 	struct vidbuf_description *vidinfo = &ad->gfxvidinfo;
 
 	if (!denise_thread_state) {
+		fastline_init(&fastline_main, chunky_out, dpf_chunky_out, row_tmp8, sizeof(row_tmp8), debug_bufx);
 		uae_sem_init(&read_sem, 0, 1);
 		uae_sem_init(&write_sem, 0, 1);
 		denise_thread_state = 1;
@@ -2443,6 +2508,13 @@ void drawing_init(void)
 	reset_drawing();
 }
 
+// stop line worker threads, restarted on demand by next drawn frame
+void drawing_free(void)
+{
+	draw_denise_line_queue_flush();
+	denise_line_workers_stop();
+}
+
 int isvsync_chipset(void)
 {
 	struct amigadisplay *ad = &adisplays[0];
@@ -3471,6 +3543,7 @@ void denise_reset(bool hard)
 	memset(&dummydrec, 0, sizeof(dummydrec));
 	memset(chunky_out, 0, sizeof(chunky_out));
 	memset(dpf_chunky_out, 0, sizeof(dpf_chunky_out));
+	denise_line_workers_reset();
 	debug_dma_dhpos_odd = &dummyint;
 	debug_dma_ptr = &dummydrec;
 	denise_cycle_half = 0;
@@ -5329,6 +5402,10 @@ bool start_draw_denise(void)
 
 	vidinfo->outbuffer = vb;
 
+	if (currprefs.nodisplay) {
+		return false;
+	}
+
 	if (!lockscr(vb, false, display_reset > 0)) {
 		return false;
 	}
@@ -5548,24 +5625,21 @@ static void lts_null(void)
 	}
 }
 
-static void get_line(int monid, int gfx_ypos, enum nln_how how, int lol_shift_prev)
+// Select output row(s) of gfx_ypos. Returns horizontal shift or -1 if line can't be drawn.
+static int get_line_state(struct fastline_state *fs, int monid, int gfx_ypos, enum nln_how how, int lol_shift_prev)
 {
 	struct vidbuf_description *vidinfo = &adisplays[monid].gfxvidinfo;
 	struct vidbuffer *vb = vidinfo->inbuffer;
-	int eraselines = 0;
 	int yadjust = currprefs.gfx_overscanmode < OVERSCANMODE_ULTRA ? minfirstline_linear << currprefs.gfx_vresolution : 0;
 	int xshift = 0;
+	int y_end = -1;
 
-	xlinebuffer = NULL;
-	xlinebuffer2 = NULL;
-	xlinebuffer_genlock = NULL;
-
-	denise_pixtotal_max = denise_pixtotalv - denise_pixtotalskip2;
-	denise_pixtotal = -denise_pixtotalskip;
+	fs->xlinebuffer = NULL;
+	fs->xlinebuffer2 = NULL;
+	fs->xlinebuffer_genlock = NULL;
 
 	if (!vb->locked) {
-		denise_pixtotal_max = -0x7fffffff;
-		return;
+		return -1;
 	}
 
 	if (erase_next_draw) {
@@ -5583,77 +5657,120 @@ static void get_line(int monid, int gfx_ypos, enum nln_how how, int lol_shift_pr
 	gfx_ypos -= yadjust;
 
 	if (how == nln_none) {
-		return;
+		return -1;
 	}
 
 	if (gfx_ypos >= 0 && gfx_ypos < vb->inheight) {
-		denise_y_end = gfx_ypos + 1;
+		y_end = gfx_ypos + 1;
 		switch (how)
 		{
 			case nln_lower_black_always:
 			if (gfx_ypos + 1 < vb->inheight) {
-				setxlinebuffer(0, gfx_ypos + 1);
-				memset(xlinebuffer, 0, vb->inwidth * vb->pixbytes);
+				setxlinebuffer_state(fs, 0, gfx_ypos + 1);
+				memset(fs->xlinebuffer, 0, vb->inwidth * vb->pixbytes);
 			}
 			break;
 			case nln_upper_black_always:
 			if (gfx_ypos > 0) {
-				setxlinebuffer(0, gfx_ypos - 1);
-				memset(xlinebuffer, 0, vb->inwidth * vb->pixbytes);
+				setxlinebuffer_state(fs, 0, gfx_ypos - 1);
+				memset(fs->xlinebuffer, 0, vb->inwidth * vb->pixbytes);
 			}
 			break;
 			case nln_doubled:
 			if (gfx_ypos + 1 < vb->inheight) {
-				setxlinebuffer(0, gfx_ypos + 1);
-				xlinebuffer2 = xlinebuffer;
-				xlinebuffer2_start = xlinebuffer_start;
-				xlinebuffer2_end = xlinebuffer_end;
-				denise_y_end++;
+				setxlinebuffer_state(fs, 0, gfx_ypos + 1);
+				fs->xlinebuffer2 = fs->xlinebuffer;
+				fs->xlinebuffer2_start = fs->xlinebuffer_start;
+				fs->xlinebuffer2_end = fs->xlinebuffer_end;
+				y_end++;
 			}
 			break;
 			case nln_nblack:
 			if (gfx_ypos + 1 < vb->inheight) {
-				setxlinebuffer(0, gfx_ypos + 1);
-				memset(xlinebuffer, 0, vb->inwidth * vb->pixbytes);
-				denise_y_end++;
+				setxlinebuffer_state(fs, 0, gfx_ypos + 1);
+				memset(fs->xlinebuffer, 0, vb->inwidth * vb->pixbytes);
+				y_end++;
 			}
 			break;
 		}
-		setxlinebuffer(0, gfx_ypos);
+		setxlinebuffer_state(fs, 0, gfx_ypos);
 		xshift = linetoscr_x_adjust >> hresolution;
-		denise_pixtotal -= xshift;
+		if (y_end > fs->y_end) {
+			fs->y_end = y_end;
+		}
 	}
 
-	buf1 = (uae_u32*)xlinebuffer;
-	if (!xlinebuffer2) {
-		xlinebuffer2 = xlinebuffer;
-		xlinebuffer2_start = xlinebuffer_start;
-		xlinebuffer2_end = xlinebuffer_end;
+	fs->buf1 = (uae_u32*)fs->xlinebuffer;
+	if (!fs->xlinebuffer2) {
+		fs->xlinebuffer2 = fs->xlinebuffer;
+		fs->xlinebuffer2_start = fs->xlinebuffer_start;
+		fs->xlinebuffer2_end = fs->xlinebuffer_end;
 	}
-	buf2 = (uae_u32*)xlinebuffer2;
-	buf_d = debug_bufx;
-	gbuf = xlinebuffer_genlock;
+	fs->buf2 = (uae_u32*)fs->xlinebuffer2;
+	fs->buf_d = fs->debug_buf;
+	fs->gbuf = fs->xlinebuffer_genlock;
 
-	if (buf1) {
+	if (fs->buf1) {
 		for (int i = 0; i < lol_shift_prev; i++) {
-			if (buf1 >= (uae_u32*)xlinebuffer_start && buf1 < (uae_u32*)xlinebuffer_end) {
-				*buf1++ = DEBUG_LOL_COLOR;
-				*buf2++ = DEBUG_LOL_COLOR;
-				*buf_d++ = 0;
-				if (gbuf) {
-					*gbuf++ = 0xff;
+			if (fs->buf1 >= (uae_u32*)fs->xlinebuffer_start && fs->buf1 < (uae_u32*)fs->xlinebuffer_end) {
+				*fs->buf1++ = DEBUG_LOL_COLOR;
+				*fs->buf2++ = DEBUG_LOL_COLOR;
+				*fs->buf_d++ = 0;
+				if (fs->gbuf) {
+					*fs->gbuf++ = 0xff;
 				}
 			} else {
-				buf1++;
-				buf2++;
-				buf_d++;
-				if (gbuf) {
-					gbuf++;
+				fs->buf1++;
+				fs->buf2++;
+				fs->buf_d++;
+				if (fs->gbuf) {
+					fs->gbuf++;
 				}
 			}
 		}
 	}
-	
+
+	return xshift;
+}
+
+static void get_line(int monid, int gfx_ypos, enum nln_how how, int lol_shift_prev)
+{
+	struct vidbuf_description *vidinfo = &adisplays[monid].gfxvidinfo;
+	struct vidbuffer *vb = vidinfo->inbuffer;
+	struct fastline_state *fs = &fastline_main;
+
+	denise_pixtotal_max = denise_pixtotalv - denise_pixtotalskip2;
+	denise_pixtotal = -denise_pixtotalskip;
+
+	fs->y_end = -1;
+	int xshift = get_line_state(fs, monid, gfx_ypos, how, lol_shift_prev);
+
+	xlinebuffer = fs->xlinebuffer;
+	xlinebuffer_start = fs->xlinebuffer_start;
+	xlinebuffer_end = fs->xlinebuffer_end;
+	xlinebuffer2 = fs->xlinebuffer2;
+	xlinebuffer2_start = fs->xlinebuffer2_start;
+	xlinebuffer2_end = fs->xlinebuffer2_end;
+	xlinebuffer_genlock = fs->xlinebuffer_genlock;
+	xlinebuffer_genlock_start = fs->xlinebuffer_genlock_start;
+	xlinebuffer_genlock_end = fs->xlinebuffer_genlock_end;
+	if (fs->y_end >= 0) {
+		denise_y_end = fs->y_end;
+	}
+
+	if (xshift < 0) {
+		if (!vb->locked) {
+			denise_pixtotal_max = -0x7fffffff;
+		}
+		return;
+	}
+
+	buf1 = fs->buf1;
+	buf2 = fs->buf2;
+	buf_d = fs->buf_d;
+	gbuf = fs->gbuf;
+	denise_pixtotal -= xshift;
+
 	if ((denise_pixtotal_max << (1 + hresolution)) > vb->inwidth) {
 		denise_pixtotal_max = vb->inwidth >> (1 + hresolution);
 	}
@@ -5714,20 +5831,20 @@ static uae_u32 *buf2t;
 static uae_u32 *bufdt;
 static uae_u8 *bufg;
 
-static void edgeblanking(int hbstrt_offset, int hbstop_offset, int internal_pixel_start_cnt, bool strlong_seen, bool lol, int lol_shift_prev)
+static void edgeblanking(uae_u32 *b1t, uae_u32 *b2t, uae_u8 *bg, uae_u32 *b1, uae_u32 *b2, int hbstrt_offset, int hbstop_offset, int internal_pixel_start_cnt, bool strlong_seen, bool lol, int lol_shift_prev)
 {
 	int rshift = hresolution_inv;
 	int hbstrt_offset2 = (hbstrt_offset - internal_pixel_start_cnt) >> rshift;
 	int hbstop_offset2 = (hbstop_offset - internal_pixel_start_cnt) >> rshift;
-	uae_u32 *hbstrt_ptr1 = buf1t && hbstrt_offset2 >= 0 ? buf1t + hbstrt_offset2 : NULL;
-	uae_u32 *hbstop_ptr1 = buf1t && hbstop_offset2 >= 0 ? buf1t + hbstop_offset2 : NULL;
-	uae_u32 *hbstrt_ptr2 = buf2t && hbstrt_offset2 >= 0 ? buf2t + hbstrt_offset2 : NULL;
-	uae_u32 *hbstop_ptr2 = buf2t && hbstop_offset2 >= 0 ? buf2t + hbstop_offset2 : NULL;
+	uae_u32 *hbstrt_ptr1 = b1t && hbstrt_offset2 >= 0 ? b1t + hbstrt_offset2 : NULL;
+	uae_u32 *hbstop_ptr1 = b1t && hbstop_offset2 >= 0 ? b1t + hbstop_offset2 : NULL;
+	uae_u32 *hbstrt_ptr2 = b2t && hbstrt_offset2 >= 0 ? b2t + hbstrt_offset2 : NULL;
+	uae_u32 *hbstop_ptr2 = b2t && hbstop_offset2 >= 0 ? b2t + hbstop_offset2 : NULL;
 	// blank last pixel row if normal overscan mode, it might have NTSC artifacts
 	if (strlong_seen && hbstrt_ptr1) {
 		int add = 1 << hresolution;
-		uae_u32 *ptre1 = buf1;
-		uae_u32 *ptre2 = buf2;
+		uae_u32 *ptre1 = b1;
+		uae_u32 *ptre2 = b2;
 		if (no_denise_lol) {
 			int padd = lol ? 0 : 2;
 			uae_u32 *p1 = hbstrt_ptr1 - padd * add;
@@ -5769,29 +5886,29 @@ static void edgeblanking(int hbstrt_offset, int hbstop_offset, int internal_pixe
 			{
 				case 0:
 					ptr = hbstrt_ptr1;
-					ptrs = buf1t;
-					ptre = buf1;
+					ptrs = b1t;
+					ptre = b1;
 					lolshift = no_denise_lol ? (lol ? add : -add) : (lol ? add : 0);
 					w = ww2;
 					break;
 				case 1:
 					ptr = hbstrt_ptr2;
-					ptrs = buf2t;
-					ptre = buf2;
+					ptrs = b2t;
+					ptre = b2;
 					lolshift = no_denise_lol ? (lol ? add : -add) : (lol ? add : 0);
 					w = ww2;
 					break;
 				case 2:
 					ptr = hbstop_ptr1;
-					ptrs = buf1t;
-					ptre = buf1;
+					ptrs = b1t;
+					ptre = b1;
 					lolshift = lol || no_denise_lol ? 0 : add;
 					w = ww1;
 					break;
 				case 3:
 					ptr = hbstop_ptr2;
-					ptrs = buf2t;
-					ptre = buf2;
+					ptrs = b2t;
+					ptre = b2;
 					lolshift = lol || no_denise_lol ? 0 : add;
 					w = ww1;
 					break;
@@ -5813,8 +5930,8 @@ static void edgeblanking(int hbstrt_offset, int hbstop_offset, int internal_pixe
 						}
 						if (w > 0) {
 							memset(p1, DEBUG_TVOVERSCAN_H_GRAYSCALE, w * sizeof(uae_u32));
-							if (bufg) {
-								uae_u8 *gp1 = (p1 - ptrs) + bufg + wxadd;
+							if (bg) {
+								uae_u8 *gp1 = (p1 - ptrs) + bg + wxadd;
 								memset(gp1, 0, w);
 							}
 						}
@@ -5834,8 +5951,8 @@ static void edgeblanking(int hbstrt_offset, int hbstop_offset, int internal_pixe
 						}
 						if (w > 0) {
 							memset(p1, DEBUG_TVOVERSCAN_H_GRAYSCALE, w * sizeof(uae_u32));
-							if (bufg) {
-								uae_u8 *gp1 = (p1 - ptrs) + bufg + wxadd;
+							if (bg) {
+								uae_u8 *gp1 = (p1 - ptrs) + bg + wxadd;
 								memset(gp1, 0, w);
 							}
 						}
@@ -6009,7 +6126,7 @@ static void draw_denise_line(int gfx_ypos, enum nln_how how, uae_u32 linecnt, in
 		}
 #endif
 
-		edgeblanking(hbstrt_offset, hbstop_offset, internal_pixel_start_cnt, denise_strlong_seen, lol, denise_lol_shift_prev);
+		edgeblanking(buf1t, buf2t, bufg, buf1, buf2, hbstrt_offset, hbstop_offset, internal_pixel_start_cnt, denise_strlong_seen, lol, denise_lol_shift_prev);
 
 		if (currprefs.display_calibration && xlinebuffer) {
 			emulate_black_level_calibration(buf1t, buf2t, bufdt, denise_endcycle, calib_start, calib_len);
@@ -6095,6 +6212,7 @@ static void draw_denise_line(int gfx_ypos, enum nln_how how, uae_u32 linecnt, in
 }
 
 // optimized drawing routines
+#include "linetoscr_simd.h"
 #include "linetoscr_common.cpp"
 #include "linetoscr_ocs_ecs.cpp"
 #include "linetoscr_ocs_ecs_genlock.cpp"
@@ -6116,6 +6234,223 @@ static void draw_denise_line(int gfx_ypos, enum nln_how how, uae_u32 linecnt, in
 #include "linetoscr_ecs_genlock_fast.cpp"
 #include "linetoscr_aga_genlock_fast.cpp"
 
+#if LTS_SIMD
+
+/* SIMD span self-check: every generated fast linetoscr function that can
+ * use spans (normal and dual playfield, no pixel skipping, not ECS shres)
+ * draws random lines twice, first with the scalar loop only and then with
+ * spans. Output pixels, collision bits and source position must match. */
+
+#define LTS_CHECK_LEN 1024
+#define LTS_CHECK_SRC (LTS_CHECK_LEN * 4 + 256)
+#define LTS_CHECK_GUARD 64
+
+static uae_u32 ltscheck_seed;
+
+static uae_u32 ltscheck_rand(void)
+{
+	ltscheck_seed = ltscheck_seed * 1103515245 + 12345;
+	return ltscheck_seed >> 8;
+}
+
+struct ltscheck_state
+{
+	uae_u8 *src;
+	uae_u32 *out1, *out2;
+	uae_u8 colors[256 * sizeof(uae_u32) * 2];
+	uae_u16 bplcoltable[256];
+	int dpf_lookup[256], dpf_lookup_no[256];
+	struct linestate ls;
+	struct fastline_state fs;
+	int hbstop_offset, hstrt_offset, hstop_offset, bpl1dat_trigger_offset;
+	int subpix;
+};
+
+static bool ltscheck_span_mode(bool aga, int idx)
+{
+	int mode = idx % 5;
+	int res = (idx / 5) % 3;
+	int hres = (idx / 15) % 3;
+	if (mode != CMODE_NORMAL && mode != CMODE_DUALPF) {
+		return false;
+	}
+	if (hres < res) {
+		return false;
+	}
+	if (res == RES_SUPERHIRES && !aga) {
+		return false;
+	}
+	return true;
+}
+
+// colors: 16 or 256 palette entries used
+static void ltscheck_random(struct ltscheck_state *st, bool aga, int colors)
+{
+	for (int i = 0; i < LTS_CHECK_SRC; i++) {
+		st->src[i] = (uae_u8)(ltscheck_rand() & (colors - 1));
+	}
+	for (int i = 0; i < sizeof(st->colors); i++) {
+		st->colors[i] = (uae_u8)ltscheck_rand();
+	}
+	// collision table entries are 0 or one common value
+	for (int i = 0; i < 256; i++) {
+		st->bplcoltable[i] = (ltscheck_rand() & 63) ? 0 : 1;
+		st->dpf_lookup[i] = ltscheck_rand() & (colors - 1);
+		st->dpf_lookup_no[i] = ltscheck_rand() & 1;
+	}
+	memset(&st->ls, 0, sizeof(st->ls));
+	st->ls.linecolorstate = st->colors;
+	st->ls.bplcon4 = aga && colors > 16 ? (uae_u16)(ltscheck_rand() & 0xff00) : 0;
+	st->hbstop_offset = ltscheck_rand() % 64;
+	st->hstrt_offset = ltscheck_rand() % 128;
+	st->bpl1dat_trigger_offset = ltscheck_rand() % 128;
+	st->hstop_offset = LTS_CHECK_LEN / 2 + ltscheck_rand() % (LTS_CHECK_LEN / 2);
+	st->subpix = ltscheck_rand() & 3;
+	memset(&st->fs, 0, sizeof(st->fs));
+	st->fs.bplcoltable = st->bplcoltable;
+	st->fs.dpf_lookup = st->dpf_lookup;
+	st->fs.dpf_lookup_no = st->dpf_lookup_no;
+	st->fs.bpldualpf2of = ltscheck_rand() & 7;
+}
+
+// draw one line like draw_bitplane_line_fast_state(), returns source end offset
+static int ltscheck_draw(struct ltscheck_state *st, LINETOSRC_FUNCF f, int idx)
+{
+	int res = (idx / 5) % 3;
+	int hres = (idx / 15) % 3;
+	bool b2 = idx >= 5 * 3 * 3;
+	int doubling = hres - res;
+	int bufadd = doubling > 0 ? (doubling > 1 ? 2 : 1) : 0;
+	int subpix = st->subpix;
+	int cpadds[4] = { 0, 0, 0, 0 };
+	uae_u8 *cp = st->src + 16;
+
+	if (doubling == 0) {
+		cpadds[0] = 1;
+		cp -= subpix >> (RES_MAX - hres);
+	} else {
+		int last = doubling == 1 ? 1 : 3;
+		if (subpix & 2) {
+			cp--;
+		}
+		cpadds[last] = 1;
+		if (subpix & 1) {
+			cpadds[last / 2] = 1;
+			cpadds[last] = 0;
+		}
+	}
+	uae_u8 *cp2 = cp;
+	memset(st->out1, 0x55, (LTS_CHECK_LEN + LTS_CHECK_GUARD) * sizeof(uae_u32));
+	memset(st->out2, 0x55, (LTS_CHECK_LEN + LTS_CHECK_GUARD) * sizeof(uae_u32));
+	st->fs.buf1 = st->out1;
+	st->fs.buf2 = b2 ? st->out2 : NULL;
+	st->fs.clxdat = 0;
+	f(0, LTS_CHECK_LEN, LTS_CHECK_LEN, st->hbstop_offset, st->hstrt_offset, st->hstop_offset, st->bpl1dat_trigger_offset,
+		6, 0x123456, &cp, &cp2, 1, cpadds, 1 << bufadd, &st->ls, &st->fs);
+	return addrdiff(cp, st->src);
+}
+
+static double ltscheck_time(struct ltscheck_state *st, LINETOSRC_FUNCF f, int idx, bool simd, int rounds)
+{
+	lts_simd_disable = !simd;
+	frame_time_t t1 = read_processor_time();
+	for (int i = 0; i < rounds; i++) {
+		ltscheck_draw(st, f, idx);
+	}
+	frame_time_t t2 = read_processor_time();
+	lts_simd_disable = false;
+	double secs = (double)(t2 - t1) / syncbase;
+	return secs > 0 ? (double)LTS_CHECK_LEN * rounds / secs / 1000000.0 : 0;
+}
+
+void linetoscr_simd_benchmark(int rounds)
+{
+	static const TCHAR *resnames[] = { _T("lores"), _T("hires"), _T("shres") };
+	struct ltscheck_state *st = xcalloc(struct ltscheck_state, 1);
+	uae_u32 *ref1 = xmalloc(uae_u32, LTS_CHECK_LEN + LTS_CHECK_GUARD);
+	uae_u32 *ref2 = xmalloc(uae_u32, LTS_CHECK_LEN + LTS_CHECK_GUARD);
+
+	if (rounds <= 0) {
+		rounds = 200;
+	}
+	st->src = xmalloc(uae_u8, LTS_CHECK_SRC);
+	st->out1 = xmalloc(uae_u32, LTS_CHECK_LEN + LTS_CHECK_GUARD);
+	st->out2 = xmalloc(uae_u32, LTS_CHECK_LEN + LTS_CHECK_GUARD);
+	ltscheck_seed = 0x12345678;
+
+	int tests = 0, errors = 0, modes = 0;
+	for (int chip = 0; chip < 2; chip++) {
+		bool aga = chip != 0;
+		LINETOSRC_FUNCF *funcs = aga ? linetoscr_aga_fast_funcs : linetoscr_ecs_fast_funcs;
+		for (int idx = 0; idx < 5 * 3 * 3 * 2; idx++) {
+			if (!funcs[idx] || !ltscheck_span_mode(aga, idx)) {
+				continue;
+			}
+			modes++;
+			for (int i = 0; i < 64; i++) {
+				ltscheck_random(st, aga, (i & 1) ? 16 : 256);
+				lts_simd_disable = true;
+				int srcend = ltscheck_draw(st, funcs[idx], idx);
+				int outend = addrdiff(st->fs.buf1, st->out1);
+				uae_u16 clx = st->fs.clxdat;
+				memcpy(ref1, st->out1, (LTS_CHECK_LEN + LTS_CHECK_GUARD) * sizeof(uae_u32));
+				memcpy(ref2, st->out2, (LTS_CHECK_LEN + LTS_CHECK_GUARD) * sizeof(uae_u32));
+				lts_simd_disable = false;
+				int srcend2 = ltscheck_draw(st, funcs[idx], idx);
+				tests++;
+				if (srcend != srcend2 || outend != addrdiff(st->fs.buf1, st->out1) || clx != st->fs.clxdat ||
+					memcmp(ref1, st->out1, (LTS_CHECK_LEN + LTS_CHECK_GUARD) * sizeof(uae_u32)) ||
+					memcmp(ref2, st->out2, (LTS_CHECK_LEN + LTS_CHECK_GUARD) * sizeof(uae_u32))) {
+					if (errors < 10) {
+						console_out_f(_T("Mismatch: %s mode %d res %d hres %d buf2 %d subpix %d DIW %d-%d\n"),
+							aga ? _T("AGA") : _T("ECS"), idx % 5, (idx / 5) % 3, (idx / 15) % 3, idx >= 45,
+							st->subpix, st->hstrt_offset, st->hstop_offset);
+					}
+					errors++;
+				}
+			}
+		}
+	}
+	console_out_f(_T("%d modes, %d tests, %d mismatches.\n"), modes, tests, errors);
+
+	// single buffer normal mode, Mpixels/s
+	console_out(_T("Chip Bitplane Output Colors  Scalar   SIMD\n"));
+	for (int chip = 0; chip < 2; chip++) {
+		bool aga = chip != 0;
+		LINETOSRC_FUNCF *funcs = aga ? linetoscr_aga_fast_funcs : linetoscr_ecs_fast_funcs;
+		for (int idx = 0; idx < 5 * 3 * 3; idx += 5) {
+			if (!funcs[idx] || !ltscheck_span_mode(aga, idx)) {
+				continue;
+			}
+			for (int colors = 16; colors <= 256; colors *= 16) {
+				ltscheck_random(st, aga, colors);
+				st->hbstop_offset = st->hstrt_offset = st->bpl1dat_trigger_offset = 0;
+				st->hstop_offset = LTS_CHECK_LEN;
+				double s = ltscheck_time(st, funcs[idx], idx, false, rounds * 10);
+				double v = ltscheck_time(st, funcs[idx], idx, true, rounds * 10);
+				console_out_f(_T("%s  %s    %s   %6d %7.1f %7.1f\n"), aga ? _T("AGA") : _T("ECS"),
+					resnames[(idx / 5) % 3], resnames[(idx / 15) % 3], colors, s, v);
+			}
+		}
+	}
+
+	xfree(st->out2);
+	xfree(st->out1);
+	xfree(st->src);
+	xfree(ref2);
+	xfree(ref1);
+	xfree(st);
+}
+
+#else
+
+void linetoscr_simd_benchmark(int rounds)
+{
+	console_out(_T("SIMD line output is not compiled in.\n"));
+}
+
+#endif
+
 // select linetoscr routine
 static void select_lts(void)
 {
@@ -6885,10 +7220,10 @@ static void pfield_doline_8(int planecnt, int wordcount, uae_u8 *datap, struct l
 	}
 }
 
-static void tvadjust(int *hbstrt_offset, int *hbstop_offset, struct linestate *ls)
+static void tvadjust(int *hbstrt_offset, int *hbstop_offset, bool strlong_seen)
 {
 	if (!programmedmode && currprefs.gfx_overscanmode < OVERSCANMODE_EXTREME) {
-		int right = denise_strlong_seen ? denise_hblank_extra_right - (1 << currprefs.gfx_resolution) : denise_hblank_extra_right;
+		int right = strlong_seen ? denise_hblank_extra_right - (1 << currprefs.gfx_resolution) : denise_hblank_extra_right;
 		int ww1 = denise_hblank_extra_left > visible_left_border ? (denise_hblank_extra_left - visible_left_border) << 0 : 0;
 		int ww2 = visible_right_border > right ? (visible_right_border - right) << 0 : 0;
 	
@@ -6918,102 +7253,98 @@ static int l_shift(int v, int shift)
 	}
 }
 
-static void draw_blank_start(int len)
+static void draw_blank_start(struct fastline_state *fs, int len)
 {
-	if (len > 0 && buf1 < (uae_u32*)xlinebuffer_start) {
-		int d = addrdiff((uae_u32*)xlinebuffer_start, buf1);
-		buf1 += d;
+	if (len > 0 && fs->buf1 < (uae_u32*)fs->xlinebuffer_start) {
+		int d = addrdiff((uae_u32*)fs->xlinebuffer_start, fs->buf1);
+		fs->buf1 += d;
 		len -= d;
 	}
-	if (buf1 + len > (uae_u32*)xlinebuffer_end) {
-		len = addrdiff((uae_u32*)xlinebuffer_end, buf1);
+	if (fs->buf1 + len > (uae_u32*)fs->xlinebuffer_end) {
+		len = addrdiff((uae_u32*)fs->xlinebuffer_end, fs->buf1);
 	}
 	if (len > 0) {
-		memset(buf1, 0, len * sizeof(uae_u32));
-		if (buf2) {
-			memset(buf2, 0, len * sizeof(uae_u32));
+		memset(fs->buf1, 0, len * sizeof(uae_u32));
+		if (fs->buf2) {
+			memset(fs->buf2, 0, len * sizeof(uae_u32));
 		}
 	}
 }
-static void draw_blank_end(void)
+static void draw_blank_end(struct fastline_state *fs)
 {
-	if (buf1 < (uae_u32*)xlinebuffer_start) {
-		buf1 = (uae_u32*)xlinebuffer_start;
+	if (fs->buf1 < (uae_u32*)fs->xlinebuffer_start) {
+		fs->buf1 = (uae_u32*)fs->xlinebuffer_start;
 	}
-	if (buf1 < (uae_u32*)xlinebuffer_end) {
-		int len = addrdiff((uae_u32*)xlinebuffer_end, buf1);
+	if (fs->buf1 < (uae_u32*)fs->xlinebuffer_end) {
+		int len = addrdiff((uae_u32*)fs->xlinebuffer_end, fs->buf1);
 		if (len > 0) {
-			memset(buf1, 0, len * sizeof(uae_u32));
-			if (buf2) {
-				memset(buf2, 0, len * sizeof(uae_u32));
+			memset(fs->buf1, 0, len * sizeof(uae_u32));
+			if (fs->buf2) {
+				memset(fs->buf2, 0, len * sizeof(uae_u32));
 			}
 		}
 	}
 }
 
-static void fill_border(int total, uae_u32 bgcol)
+static void fill_border(struct fastline_state *fs, int total, uae_u32 bgcol)
 {
-	if (buf2) {
+	if (fs->buf2) {
 		while (total >= 8) {
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-
-			*buf2++ = bgcol;
-			*buf2++ = bgcol;
-			*buf2++ = bgcol;
-			*buf2++ = bgcol;
-			*buf2++ = bgcol;
-			*buf2++ = bgcol;
-			*buf2++ = bgcol;
-			*buf2++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+
+			*fs->buf2++ = bgcol;
+			*fs->buf2++ = bgcol;
+			*fs->buf2++ = bgcol;
+			*fs->buf2++ = bgcol;
+			*fs->buf2++ = bgcol;
+			*fs->buf2++ = bgcol;
+			*fs->buf2++ = bgcol;
+			*fs->buf2++ = bgcol;
 
 			total -= 8;
 		}
 		while (total > 0) {
-			*buf1++ = bgcol;
-			*buf2++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf2++ = bgcol;
 			total--;
 		}
 	} else {
 		while (total >= 8) {
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
-			*buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
 			total -= 8;
 		}
 		while (total > 0) {
-			*buf1++ = bgcol;
+			*fs->buf1++ = bgcol;
 			total--;
 		}
 	}
 }
 
 // draw border from hb to hb
-void draw_denise_border_line_fast(int gfx_ypos, bool blank, enum nln_how how, struct linestate *ls)
+static void draw_border_line_fast_state(struct fastline_state *fs, int gfx_ypos, bool blank, enum nln_how how, struct linestate *ls)
 {
-	if (ls->strlong_seen) {
-		set_strlong();
-	}
-
-	get_line(0, gfx_ypos, how, ls->lol_shift_prev);
+	get_line_state(fs, 0, gfx_ypos, how, ls->lol_shift_prev);
 
-	if (!buf1 && !ls->blankedline && denise_planes > 0 && !blank) {
-		resolution_count[denise_res]++;
+	if (!fs->buf1 && !ls->blankedline && fs->planes > 0 && !blank) {
+		fs->resolution_count[fs->res]++;
 	}
-	lines_count++;
+	fs->lines_count++;
 
-	if (!buf1) {
+	if (!fs->buf1) {
 		return;
 	}
 
@@ -7021,9 +7352,9 @@ void draw_denise_border_line_fast(int gfx_ypos, bool blank, enum nln_how how, st
 		return;
 	}
 
-	uae_u32 *buf1p = buf1;
-	uae_u32 *buf2p = buf2 != buf1 ? buf2 : NULL;
-	uae_u8 *gbufp = gbuf;
+	uae_u32 *buf1p = fs->buf1;
+	uae_u32 *buf2p = fs->buf2 != fs->buf1 ? fs->buf2 : NULL;
+	uae_u8 *gbufp = fs->gbuf;
 
 	int rshift = hresolution_inv;
 
@@ -7035,34 +7366,34 @@ void draw_denise_border_line_fast(int gfx_ypos, bool blank, enum nln_how how, st
 	int hbstrt_offset = ls->hbstrt_offset >> rshift;
 	int hbstop_offset = ls->hbstop_offset >> rshift;
 
-	tvadjust(&hbstrt_offset, &hbstop_offset, ls);
+	tvadjust(&hbstrt_offset, &hbstop_offset, fs->strlong_seen);
 
 	int draw_end = ls->internal_pixel_cnt >> rshift;
 	int draw_startoffset = ls->internal_pixel_start_cnt >> rshift;
 
 	//write_log("%d %08x %03d %03d %03d %03d\n", vpos, ls->color0, hbstrt_offset, hbstop_offset, draw_startoffset, draw_end);
 
-	buf1 = buf1p;
-	buf2 = buf2p;
+	fs->buf1 = buf1p;
+	fs->buf2 = buf2p;
 
 	if (blank)  {
-		int len = addrdiff(xlinebuffer_end, (uae_u8*)buf1);
+		int len = addrdiff(fs->xlinebuffer_end, (uae_u8*)fs->buf1);
 		if (len > 0) {
-			memset(buf1, 0, len);
-			if (buf2) {
-				memset(buf2, 0, len);
+			memset(fs->buf1, 0, len);
+			if (fs->buf2) {
+				memset(fs->buf2, 0, len);
 			}
 		}
 	} else {
 		if (full_line_draw) {
-			draw_blank_start(hbstop_offset);
+			draw_blank_start(fs, hbstop_offset);
 		}
 		int start = draw_startoffset;
 		if (start < hbstop_offset) {
 			int diff = hbstop_offset - start;
-			buf1 += diff;
-			if (buf2) {
-				buf2 += diff;
+			fs->buf1 += diff;
+			if (fs->buf2) {
+				fs->buf2 += diff;
 			}
 			if (gbufp) {
 				gbufp += diff;
@@ -7072,13 +7403,13 @@ void draw_denise_border_line_fast(int gfx_ypos, bool blank, enum nln_how how, st
 		int end = draw_end > hbstrt_offset ? hbstrt_offset : draw_end;
 		int total = end - start;
 
-		fill_border(total, bgcol);
+		fill_border(fs, total, bgcol);
 		if (full_line_draw) {
-			draw_blank_end();
+			draw_blank_end(fs);
 		}
 
-		if (need_genlock_data && gbuf && total > 0) {
-			int max = addrdiff(xlinebuffer_genlock_end, gbufp);
+		if (need_genlock_data && fs->gbuf && total > 0) {
+			int max = addrdiff(fs->xlinebuffer_genlock_end, gbufp);
 			total += GENLOCK_EXTRA_CLEAR;
 			if (total > max) {
 				total = max;
@@ -7113,23 +7444,19 @@ static int ltsf_init(int draw_start, int draw_startoffset, int *draw_end, int hb
 	return cnt;
 }
 
-void draw_denise_bitplane_line_fast(int gfx_ypos, enum nln_how how, struct linestate *ls)
+static void draw_bitplane_line_fast_state(struct fastline_state *fs, int gfx_ypos, enum nln_how how, struct linestate *ls)
 {
-	if (ls->strlong_seen) {
-		set_strlong();
-	}
-
-	get_line(0, gfx_ypos, how, ls->lol_shift_prev);
+	get_line_state(fs, 0, gfx_ypos, how, ls->lol_shift_prev);
 	
 	//write_log("* %d %d\n", gfx_ypos, vpos);
 
-	if (!buf1 && !ls->blankedline && denise_planes > 0) {
-		resolution_count[denise_res]++;
+	if (!fs->buf1 && !ls->blankedline && fs->planes > 0) {
+		fs->resolution_count[fs->res]++;
 	}
-	lines_count++;
+	fs->lines_count++;
 
 
-	if (!buf1) {
+	if (!fs->buf1) {
 		return;
 	}
 
@@ -7137,10 +7464,11 @@ void draw_denise_bitplane_line_fast(int gfx_ypos, enum nln_how how, struct lines
 		return;
 	}
 
-	uae_u32 *buf1p = buf1;
-	uae_u32 *buf2p = buf2 != buf1 ? buf2 : NULL;
-	buf1t = buf1;
-	buf2t = buf2;
+	uae_u32 *buf1p = fs->buf1;
+	uae_u32 *buf2p = fs->buf2 != fs->buf1 ? fs->buf2 : NULL;
+	fs->buf1t = fs->buf1;
+	fs->buf2t = fs->buf2;
+	fs->gbuft = fs->gbuf;
 
 	int planecnt = GET_PLANES(ls->bplcon0);
 	int res = GET_RES_DENISE(ls->bplcon0);
@@ -7191,15 +7519,15 @@ void draw_denise_bitplane_line_fast(int gfx_ypos, enum nln_how how, struct lines
 		}
 	}
 
-	uae_u32 *cstart = chunky_out + 1024;
+	uae_u32 *cstart = fs->chunky_out + 1024;
 	int len = (ls->bpllen + 3) / 4;
 	int byteoutlen = len * 8 * 4;
 	pfield_doline_8(planecnt, len, (uae_u8*)cstart, ls);
 	// if previous line was longer: clear the unused part
-	if (chunky_out_prev_len > byteoutlen) {
-		memset((uae_u8*)cstart + byteoutlen, 0, chunky_out_prev_len - byteoutlen);
+	if (fs->chunky_out_prev_len > byteoutlen) {
+		memset((uae_u8*)cstart + byteoutlen, 0, fs->chunky_out_prev_len - byteoutlen);
 	}
-	chunky_out_prev_len = byteoutlen;
+	fs->chunky_out_prev_len = byteoutlen;
 
 	bool ecsena = ecs_denise && (ls->bplcon0 & 1) != 0;
 	bool brdblank = (ls->bplcon3 & 0x20) && ecsena;
@@ -7266,7 +7594,7 @@ void draw_denise_bitplane_line_fast(int gfx_ypos, enum nln_how how, struct lines
 		cp2 -= byteshift2;
 		// different bitplane delay in DPF? Merge them.
 		if (cp != cp2) {
-			uae_u8 *dpout = (uae_u8*)(dpf_chunky_out + 1024);
+			uae_u8 *dpout = (uae_u8*)(fs->dpf_chunky_out + 1024);
 			for (int i = 0; i < len * 8 + 7; i++) {
 				uae_u32 pix0 = ((uae_u32*)cp)[i];
 				uae_u32 pix1 = ((uae_u32*)cp2)[i];
@@ -7284,7 +7612,7 @@ void draw_denise_bitplane_line_fast(int gfx_ypos, enum nln_how how, struct lines
 	}
 
 	// if HAM: need to clear left hblank after line has been drawn
-	tvadjust(&hbstrt_offset, ham ? NULL : &hbstop_offset, ls);
+	tvadjust(&hbstrt_offset, ham ? NULL : &hbstop_offset, fs->strlong_seen);
 
 	// negative checks are needed to handle always-on HDIW
 	int hstop_offset_adjusted = ls->hstop_offset;
@@ -7347,36 +7675,36 @@ void draw_denise_bitplane_line_fast(int gfx_ypos, enum nln_how how, struct lines
 
 #if 1
 	
-	buf1 = buf1p;
-	buf2 = buf2p;
+	fs->buf1 = buf1p;
+	fs->buf2 = buf2p;
 
 	// if horizontal shift is large enough to skip part of hdiw or bitplane, draw them to temp buffer.
 	if (draw_startoffset > bpl1dat_trigger_offset || draw_startoffset > hbstop_offset || draw_startoffset > hstrt_offset) {
-		buf1 = (uae_u32*)row_tmp8;
-		buf2 = (uae_u32*)row_tmp8;
+		fs->buf1 = (uae_u32*)fs->row_tmp8;
+		fs->buf2 = (uae_u32*)fs->row_tmp8;
 		int end = draw_startoffset;
-		int cnt = ltsf_init(draw_start, draw_startoffset, &end, hbstrt_offset, hbstop_offset, bpl1dat_trigger_offset, row_tmp8 + sizeof(row_tmp8), buf1);
+		int cnt = ltsf_init(draw_start, draw_startoffset, &end, hbstrt_offset, hbstop_offset, bpl1dat_trigger_offset, fs->row_tmp8 + fs->row_tmp8_size, fs->buf1);
 		ltsf(cnt, end, hbstrt_offset, hbstop_offset, hstrt_offset, hstop_offset, bpl1dat_trigger_offset,
-			planecnt, bgcol, &cp, &cp2, 1 << cpadd, cpadds, 1 << bufadd, ls);
+			planecnt, bgcol, &cp, &cp2, 1 << cpadd, cpadds, 1 << bufadd, ls, fs);
 		draw_start = draw_startoffset;
-		buf1 = buf1p;
-		buf2 = buf2p;
+		fs->buf1 = buf1p;
+		fs->buf2 = buf2p;
 	}
 	if (full_line_draw) {
-		draw_blank_start(hbstop_offset);
+		draw_blank_start(fs, hbstop_offset);
 	}
-	int cnt = ltsf_init(draw_start, draw_startoffset, &draw_end, hbstrt_offset, hbstop_offset, bpl1dat_trigger_offset, xlinebuffer_end, buf1);
+	int cnt = ltsf_init(draw_start, draw_startoffset, &draw_end, hbstrt_offset, hbstop_offset, bpl1dat_trigger_offset, fs->xlinebuffer_end, fs->buf1);
 	ltsf(cnt, draw_end, hbstrt_offset, hbstop_offset, hstrt_offset, hstop_offset, bpl1dat_trigger_offset,
-		planecnt, bgcol, &cp, &cp2, 1 << cpadd, cpadds, 1 << bufadd, ls);
+		planecnt, bgcol, &cp, &cp2, 1 << cpadd, cpadds, 1 << bufadd, ls, fs);
 
 #if 0
-	*buf1++ = 0;
-	*buf1++ = 0;
-	*buf2++ = 0;
-	*buf2++ = 0;
+	*fs->buf1++ = 0;
+	*fs->buf1++ = 0;
+	*fs->buf2++ = 0;
+	*fs->buf2++ = 0;
 #endif
 
-	edgeblanking(ls->hbstrt_offset, ls->hbstop_offset, ls->internal_pixel_start_cnt, ls->strlong_seen, ls->lol, ls->lol_shift_prev);
+	edgeblanking(fs->buf1t, fs->buf2t, fs->gbuft, fs->buf1, fs->buf2, ls->hbstrt_offset, ls->hbstop_offset, ls->internal_pixel_start_cnt, ls->strlong_seen, ls->lol, ls->lol_shift_prev);
 
 	if (!programmedmode && ham) {
 		int ww1 = visible_left_start > visible_left_border ? (visible_left_start - visible_left_border) << 0 : 0;
@@ -7393,24 +7721,24 @@ void draw_denise_bitplane_line_fast(int gfx_ypos, enum nln_how how, struct lines
 	}
 
 	if (full_line_draw) {
-		draw_blank_end();
+		draw_blank_end(fs);
 	}
 
 	// clear some more bytes to clear possible lightpen cursor graphics
-	if (need_genlock_data && gbuf) {
-		int max = addrdiff(xlinebuffer_genlock_end, gbuf);
+	if (need_genlock_data && fs->gbuf) {
+		int max = addrdiff(fs->xlinebuffer_genlock_end, fs->gbuf);
 		int total = GENLOCK_EXTRA_CLEAR;
 		if (total > max) {
 			total = max;
 		}
-		memset(gbuf, 0, total);
+		memset(fs->gbuf, 0, total);
 	}
 
-	if (ls->hstop_offset > diwlastword_total && ls->bpl1dat_trigger_offset >= 0) {
-		diwlastword_total = ls->hstop_offset;
+	if (ls->hstop_offset > fs->diwlastword && ls->bpl1dat_trigger_offset >= 0) {
+		fs->diwlastword = ls->hstop_offset;
 	}
-	if (ls->hstrt_offset < diwfirstword_total && ls->bpl1dat_trigger_offset >= 0) {
-		diwfirstword_total = ls->hstrt_offset;
+	if (ls->hstrt_offset < fs->diwfirstword && ls->bpl1dat_trigger_offset >= 0) {
+		fs->diwfirstword = ls->hstrt_offset;
 	}
 
 #else
@@ -7453,6 +7781,328 @@ void draw_denise_bitplane_line_fast(int gfx_ypos, enum nln_how how, struct lines
 
 }
 
+static void fastline_reset_results(struct fastline_state *fs)
+{
+	fs->clxdat = 0;
+	for (int i = 0; i <= RES_MAX; i++) {
+		fs->resolution_count[i] = 0;
+	}
+	fs->lines_count = 0;
+	fs->diwfirstword = 0x7fffffff;
+	fs->diwlastword = -0x7fffffff;
+	fs->y_end = -1;
+}
+
+static void fastline_init(struct fastline_state *fs, uae_u32 *chunky, uae_u32 *dpf_chunky, uae_u8 *tmprow, int tmprow_size, uae_u32 *debugbuf)
+{
+	fs->chunky_out = chunky;
+	fs->dpf_chunky_out = dpf_chunky;
+	fs->chunky_out_prev_len = 0;
+	fs->row_tmp8 = tmprow;
+	fs->row_tmp8_size = tmprow_size;
+	fs->debug_buf = debugbuf;
+	fastline_reset_results(fs);
+}
+
+// current Denise state, used when line is drawn immediately
+static void fastline_snapshot(struct fastline_state *fs)
+{
+	fs->bplcoltable = bplcoltable;
+	fs->dpf_lookup = dpf_lookup;
+	fs->dpf_lookup_no = dpf_lookup_no;
+	fs->bpldualpf2of = bpldualpf2of;
+	fs->bplehb_mask = bplehb_mask;
+	fs->strlong_seen = denise_strlong_seen;
+	fs->planes = denise_planes;
+	fs->res = denise_res;
+}
+
+static void fastline_merge(struct fastline_state *fs)
+{
+	clxdat |= fs->clxdat;
+	for (int i = 0; i <= RES_MAX; i++) {
+		resolution_count[i] += fs->resolution_count[i];
+	}
+	lines_count += fs->lines_count;
+	if (fs->diwlastword > diwlastword_total) {
+		diwlastword_total = fs->diwlastword;
+	}
+	if (fs->diwfirstword < diwfirstword_total) {
+		diwfirstword_total = fs->diwfirstword;
+	}
+	if (fs->y_end > denise_y_end) {
+		denise_y_end = fs->y_end;
+	}
+	fastline_reset_results(fs);
+}
+
+void draw_denise_border_line_fast(int gfx_ypos, bool blank, enum nln_how how, struct linestate *ls)
+{
+	struct fastline_state *fs = &fastline_main;
+
+	if (ls->strlong_seen) {
+		set_strlong();
+	}
+	fastline_snapshot(fs);
+	draw_border_line_fast_state(fs, gfx_ypos, blank, how, ls);
+	fastline_merge(fs);
+}
+
+void draw_denise_bitplane_line_fast(int gfx_ypos, enum nln_how how, struct linestate *ls)
+{
+	struct fastline_state *fs = &fastline_main;
+
+	if (ls->strlong_seen) {
+		set_strlong();
+	}
+	fastline_snapshot(fs);
+	draw_bitplane_line_fast_state(fs, gfx_ypos, how, ls);
+	fastline_merge(fs);
+}
+
+/*
+* Line worker threads
+*
+* Fast (linestate) lines are independent of each other: denise thread
+* snapshots the Denise register state the line needs and hands the line
+* to a worker, horizontal slices of DENISE_LINE_SLICE lines go to the same
+* worker. Anything that needs full Denise state (cycle exact lines, vsync,
+* register store/restore, HAM/genlock/ECS superhires lines) waits until
+* all workers have finished first.
+*/
+
+#define DENISE_LINE_WORKERS_MAX 8
+#define DENISE_LINE_JOBS 64
+#define DENISE_LINE_JOBS_MASK (DENISE_LINE_JOBS - 1)
+#define DENISE_LINE_SLICE_SHIFT 3
+
+struct denise_line_job
+{
+	int type;
+	int gfx_ypos;
+	nln_how how;
+	bool blanked;
+	struct linestate *ls;
+	int *dpf_lookup, *dpf_lookup_no;
+	int bpldualpf2of;
+	uae_u8 bplehb_mask;
+	bool strlong_seen;
+	int planes, res;
+	uae_u16 bplcoltable[256];
+};
+
+struct denise_line_worker
+{
+	struct denise_line_job jobs[DENISE_LINE_JOBS];
+	volatile uae_atomic job_read, job_write;
+	uae_sem_t job_sem, done_sem;
+	volatile int state;
+	struct fastline_state fs;
+};
+
+static struct denise_line_worker *denise_line_workers[DENISE_LINE_WORKERS_MAX];
+static int denise_line_workers_started, denise_line_workers_num;
+
+static void denise_line_worker_thread(void *v)
+{
+	struct denise_line_worker *w = (struct denise_line_worker*)v;
+	struct fastline_state *fs = &w->fs;
+
+	for (;;) {
+		while (w->job_read == w->job_write && w->state > 0) {
+			uae_sem_wait(&w->job_sem);
+		}
+		if (w->job_read == w->job_write) {
+			break;
+		}
+		struct denise_line_job *j = &w->jobs[w->job_read & DENISE_LINE_JOBS_MASK];
+		fs->bplcoltable = j->bplcoltable;
+		fs->dpf_lookup = j->dpf_lookup;
+		fs->dpf_lookup_no = j->dpf_lookup_no;
+		fs->bpldualpf2of = j->bpldualpf2of;
+		fs->bplehb_mask = j->bplehb_mask;
+		fs->strlong_seen = j->strlong_seen;
+		fs->planes = j->planes;
+		fs->res = j->res;
+		if (j->type == 1) {
+			draw_bitplane_line_fast_state(fs, j->gfx_ypos, j->how, j->ls);
+		} else {
+			draw_border_line_fast_state(fs, j->gfx_ypos, j->blanked, j->how, j->ls);
+		}
+		atomic_inc(&w->job_read);
+		uae_sem_post(&w->done_sem);
+	}
+	w->state = -1;
+}
+
+static bool denise_line_worker_start(void)
+{
+	struct denise_line_worker *w = xcalloc(struct denise_line_worker, 1);
+	if (!w) {
+		return false;
+	}
+	uae_u32 *chunky = xcalloc(uae_u32, sizeof(chunky_out) / sizeof(uae_u32));
+	uae_u32 *dpf_chunky = xcalloc(uae_u32, sizeof(dpf_chunky_out) / sizeof(uae_u32));
+	uae_u8 *tmprow = xcalloc(uae_u8, sizeof(row_tmp8));
+	uae_u32 *debugbuf = xcalloc(uae_u32, sizeof(debug_bufx) / sizeof(uae_u32));
+	if (!chunky || !dpf_chunky || !tmprow || !debugbuf) {
+		xfree(chunky);
+		xfree(dpf_chunky);
+		xfree(tmprow);
+		xfree(debugbuf);
+		xfree(w);
+		return false;
+	}
+	fastline_init(&w->fs, chunky, dpf_chunky, tmprow, sizeof(row_tmp8), debugbuf);
+	uae_sem_init(&w->job_sem, 0, 0);
+	uae_sem_init(&w->done_sem, 0, 0);
+	w->state = 1;
+	if (!uae_start_thread(_T("denise line"), denise_line_worker_thread, w, NULL)) {
+		write_log(_T("Denise line worker %d failed to start\n"), denise_line_workers_started);
+		uae_sem_destroy(&w->job_sem);
+		uae_sem_destroy(&w->done_sem);
+		xfree(chunky);
+		xfree(dpf_chunky);
+		xfree(tmprow);
+		xfree(debugbuf);
+		xfree(w);
+		return false;
+	}
+	denise_line_workers[denise_line_workers_started++] = w;
+	return true;
+}
+
+// wait until all workers are idle and merge their results
+static void denise_line_workers_sync(void)
+{
+	for (int i = 0; i < denise_line_workers_num; i++) {
+		struct denise_line_worker *w = denise_line_workers[i];
+		while (w->job_read != w->job_write) {
+			uae_sem_trywait_delay(&w->done_sem, 500);
+		}
+		fastline_merge(&w->fs);
+	}
+}
+
+// finish queued lines, stop and free all workers
+static void denise_line_workers_stop(void)
+{
+	denise_line_workers_sync();
+	for (int i = 0; i < denise_line_workers_started; i++) {
+		struct denise_line_worker *w = denise_line_workers[i];
+		w->state = 0;
+		uae_sem_post(&w->job_sem);
+		while (w->state >= 0) {
+			sleep_millis(1);
+		}
+		uae_sem_destroy(&w->job_sem);
+		uae_sem_destroy(&w->done_sem);
+		xfree(w->fs.chunky_out);
+		xfree(w->fs.dpf_chunky_out);
+		xfree(w->fs.row_tmp8);
+		xfree(w->fs.debug_buf);
+		xfree(w);
+		denise_line_workers[i] = NULL;
+	}
+	denise_line_workers_started = 0;
+	denise_line_workers_num = 0;
+}
+
+static void denise_line_workers_reset(void)
+{
+	for (int i = 0; i < denise_line_workers_started; i++) {
+		struct fastline_state *fs = &denise_line_workers[i]->fs;
+		memset(fs->chunky_out, 0, sizeof(chunky_out));
+		memset(fs->dpf_chunky_out, 0, sizeof(dpf_chunky_out));
+		fastline_reset_results(fs);
+	}
+}
+
+static void denise_line_workers_config(void)
+{
+	int num = currprefs.gfx_denise_threads;
+	if (num > DENISE_LINE_WORKERS_MAX) {
+		num = DENISE_LINE_WORKERS_MAX;
+	}
+	if (num < 0) {
+		num = 0;
+	}
+	if (num == denise_line_workers_num) {
+		return;
+	}
+	denise_line_workers_sync();
+	while (denise_line_workers_started < num) {
+		if (!denise_line_worker_start()) {
+			break;
+		}
+	}
+	if (num > denise_line_workers_started) {
+		num = denise_line_workers_started;
+	}
+	if (num != denise_line_workers_num) {
+		write_log(_T("Denise line workers: %d\n"), num);
+	}
+	denise_line_workers_num = num;
+}
+
+// can line be drawn without Denise state that changes during the line
+static bool denise_line_parallel(struct denise_rga_queue *q)
+{
+	// line also clears the whole display
+	if (erase_next_draw) {
+		return false;
+	}
+	if (need_genlock_data) {
+		return false;
+	}
+	if (q->type == 1) {
+		uae_u16 bplcon0 = q->ls->bplcon0;
+		// HAM decoder and ECS superhires colors use global state
+		if (bplcon0 & 0x800) {
+			return false;
+		}
+		if (!aga_mode && GET_RES_DENISE(bplcon0) == RES_SUPERHIRES) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool denise_line_dispatch(struct denise_rga_queue *q)
+{
+	denise_line_workers_config();
+	if (!denise_line_workers_num || !denise_line_parallel(q)) {
+		return false;
+	}
+
+	struct linestate *ls = q->ls;
+	if (ls->strlong_seen) {
+		set_strlong();
+	}
+
+	struct denise_line_worker *w = denise_line_workers[(q->gfx_ypos >> DENISE_LINE_SLICE_SHIFT) % denise_line_workers_num];
+	while (((w->job_write + 1) & DENISE_LINE_JOBS_MASK) == (w->job_read & DENISE_LINE_JOBS_MASK)) {
+		uae_sem_trywait_delay(&w->done_sem, 500);
+	}
+	struct denise_line_job *j = &w->jobs[w->job_write & DENISE_LINE_JOBS_MASK];
+	j->type = q->type;
+	j->gfx_ypos = q->gfx_ypos;
+	j->how = q->how;
+	j->blanked = q->blanked;
+	j->ls = ls;
+	j->dpf_lookup = dpf_lookup;
+	j->dpf_lookup_no = dpf_lookup_no;
+	j->bpldualpf2of = bpldualpf2of;
+	j->bplehb_mask = bplehb_mask;
+	j->strlong_seen = denise_strlong_seen;
+	j->planes = denise_planes;
+	j->res = denise_res;
+	memcpy(j->bplcoltable, bplcoltable, sizeof(bplcoltable));
+	atomic_inc(&w->job_write);
+	uae_sem_post(&w->job_sem);
+	return true;
+}
+
 #define RB restore_u8()
 #define SRB restore_s8()
 #define RW restore_u16()
@@ -7612,6 +8262,9 @@ static void addtowritequeue(void)
 
 void draw_denise_border_line_fast_queue(int gfx_ypos, bool blank, enum nln_how how, struct linestate *ls)
 {
+	if (currprefs.nodisplay) {
+		return;
+	}
 	if (MULTITHREADED_DENISE) {
 		
 		if (!waitqueue(2)) {
@@ -7639,6 +8292,9 @@ void draw_denise_border_line_fast_queue(int gfx_ypos, bool blank, enum nln_how h
 
 void draw_denise_bitplane_line_fast_queue(int gfx_ypos, enum nln_how how, struct linestate *ls)
 {
+	if (currprefs.nodisplay) {
+		return;
+	}
 	if (MULTITHREADED_DENISE) {
 		
 		if (!waitqueue(1)) {
@@ -7718,6 +8374,10 @@ void denise_handle_quick_strobe_queue(uae_u16 strobe, int strobe_pos, int endpos
 
 void draw_denise_line_queue(int gfx_ypos, nln_how how, uae_u32 linecnt, int startpos, int endpos, int startcycle, int endcycle, int skip, int skip2, int dtotal, int calib_start, int calib_len, bool lof, bool lol, int hdelay, bool blanked, bool finalseg, struct linestate *ls)
 {
+	// no display: Agnus side still runs, Denise never generates pixels
+	if (currprefs.nodisplay) {
+		return;
+	}
 	if (MULTITHREADED_DENISE) {
 
 		if (!waitqueue(0)) {
@@ -7762,6 +8422,9 @@ void draw_denise_line_queue(int gfx_ypos, nln_how how, uae_u32 linecnt, int star
 
 void draw_denise_vsync_queue(int erase)
 {
+	if (currprefs.nodisplay) {
+		return;
+	}
 	if (MULTITHREADED_DENISE) {
 
 		if (!waitqueue_nolock()) {
@@ -7841,10 +8504,12 @@ void draw_denise_line_queue_flush(void)
 
 		for (;;) {
 			if (rga_queue_read == rga_queue_write) {
-				return;
+				break;
 			}
 			uae_sem_trywait_delay(&read_sem, 500);
 		}
+		// denise thread is idle, finish lines still drawn by workers
+		denise_line_workers_sync();
 
 	}
 }
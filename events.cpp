@@ -40,6 +40,8 @@ frame_time_t vsyncmintime, vsyncmintimepre;
 frame_time_t vsyncmaxtime, vsyncwaittime;
 frame_time_t vsynctimebase, cputimebase;
 
+static uae_u64 ev_dispatched[ev_max];
+
 static void events_fast(void)
 {
 	cycles_do_special();
@@ -271,6 +273,7 @@ void do_cycles_normal(int cycles_to_add)
 					gui_message(_T("eventtab[%d].handler is null!\n"), i);
 					eventtab[i].active = 0;
 				} else {
+					ev_dispatched[i]++;
 					(*eventtab[i].handler)();
 				}
 			}
@@ -336,48 +339,318 @@ void do_cycles_slow(int cycles_to_add)
 	cycles_to_add_remain += remain;
 }
 
-static int event2idx;
-static int event2cnt;
-static int event2restart;
+/*
+ * Misc (event2) events are kept in a 4-ary min-heap ordered by evtime,
+ * equal times are dispatched in insertion order. Slots are handles
+ * into eventtab2 which grows on demand. Active slots are also linked
+ * per handler so that handler based lookups only visit its own events.
+ */
+
+struct ev2handler
+{
+	evfunc2 func;
+	int head;
+	int active;
+	uae_u64 dispatched;
+};
+
+static struct ev2 eventtab2_initial[ev2_initial];
+static int ev2heap_initial[ev2_initial];
+struct ev2 *eventtab2 = eventtab2_initial;
+int ev2_max = ev2_initial;
+static int *ev2heap = ev2heap_initial;
+static int ev2heapcnt, ev2heappeak;
+static int ev2freehead;
+static bool ev2tableinit;
+static uae_u32 ev2seq;
+static int ev2grows;
+
+static struct ev2handler *ev2handlers;
+static int ev2handlercnt, ev2handlermax;
+static int *ev2handlerhash;
+static int ev2handlerhashsize;
+
+static void event2_table_init(void)
+{
+	ev2heapcnt = 0;
+	ev2freehead = -1;
+	for (int i = ev2_max - 1; i >= 0; i--) {
+		struct ev2 *e = &eventtab2[i];
+		e->active = false;
+		e->heapidx = -1;
+		e->hnext = e->hprev = -1;
+		if (i >= ev2_misc) {
+			e->hnext = ev2freehead;
+			ev2freehead = i;
+		}
+	}
+	for (int i = 0; i < ev2handlercnt; i++) {
+		ev2handlers[i].head = -1;
+		ev2handlers[i].active = 0;
+	}
+	ev2tableinit = true;
+}
+
+static void event2_grow(void)
+{
+	int oldmax = ev2_max;
+	int newmax = oldmax * 2;
+	struct ev2 *tab;
+	int *heap;
+
+	if (eventtab2 == eventtab2_initial) {
+		tab = xmalloc(struct ev2, newmax);
+		memcpy(tab, eventtab2, oldmax * sizeof(struct ev2));
+		heap = xmalloc(int, newmax);
+		memcpy(heap, ev2heap, oldmax * sizeof(int));
+	} else {
+		tab = xrealloc(struct ev2, eventtab2, newmax);
+		heap = xrealloc(int, ev2heap, newmax);
+	}
+	eventtab2 = tab;
+	ev2heap = heap;
+	ev2_max = newmax;
+	for (int i = newmax - 1; i >= oldmax; i--) {
+		struct ev2 *e = &eventtab2[i];
+		memset(e, 0, sizeof(struct ev2));
+		e->heapidx = -1;
+		e->hprev = -1;
+		e->hnext = ev2freehead;
+		ev2freehead = i;
+	}
+	ev2grows++;
+}
+
+static uae_u32 event2_handler_hash(evfunc2 func)
+{
+	uintptr_t v = (uintptr_t)func;
+	return (uae_u32)((v >> 4) ^ (v >> 20)) * 0x9e3779b1;
+}
+
+static int event2_handler_find(evfunc2 func)
+{
+	if (!ev2handlerhashsize) {
+		return -1;
+	}
+	uae_u32 mask = ev2handlerhashsize - 1;
+	uae_u32 h = event2_handler_hash(func) & mask;
+	for (;;) {
+		int idx = ev2handlerhash[h];
+		if (idx < 0) {
+			return -1;
+		}
+		if (ev2handlers[idx].func == func) {
+			return idx;
+		}
+		h = (h + 1) & mask;
+	}
+}
+
+static void event2_handler_rehash(int size)
+{
+	xfree(ev2handlerhash);
+	ev2handlerhash = xmalloc(int, size);
+	ev2handlerhashsize = size;
+	for (int i = 0; i < size; i++) {
+		ev2handlerhash[i] = -1;
+	}
+	for (int i = 0; i < ev2handlercnt; i++) {
+		uae_u32 h = event2_handler_hash(ev2handlers[i].func) & (size - 1);
+		while (ev2handlerhash[h] >= 0) {
+			h = (h + 1) & (size - 1);
+		}
+		ev2handlerhash[h] = i;
+	}
+}
+
+static int event2_handler_get(evfunc2 func)
+{
+	int idx = event2_handler_find(func);
+	if (idx >= 0) {
+		return idx;
+	}
+	if (ev2handlercnt >= ev2handlermax) {
+		ev2handlermax = ev2handlermax ? ev2handlermax * 2 : 32;
+		ev2handlers = xrealloc(struct ev2handler, ev2handlers, ev2handlermax);
+	}
+	idx = ev2handlercnt++;
+	struct ev2handler *h = &ev2handlers[idx];
+	h->func = func;
+	h->head = -1;
+	h->active = 0;
+	h->dispatched = 0;
+	// keep hash table at most half full
+	if (ev2handlercnt * 2 > ev2handlerhashsize) {
+		event2_handler_rehash(ev2handlerhashsize ? ev2handlerhashsize * 2 : 64);
+	} else {
+		uae_u32 mask = ev2handlerhashsize - 1;
+		uae_u32 hv = event2_handler_hash(func) & mask;
+		while (ev2handlerhash[hv] >= 0) {
+			hv = (hv + 1) & mask;
+		}
+		ev2handlerhash[hv] = idx;
+	}
+	return idx;
+}
+
+STATIC_INLINE bool event2_before(const struct ev2 *a, const struct ev2 *b)
+{
+	if (a->evtime != b->evtime) {
+		return a->evtime < b->evtime;
+	}
+	return (uae_s32)(a->seq - b->seq) < 0;
+}
+
+static void event2_heap_up(int pos)
+{
+	int no = ev2heap[pos];
+	struct ev2 *e = &eventtab2[no];
+	while (pos > 0) {
+		int parent = (pos - 1) >> 2;
+		int pno = ev2heap[parent];
+		if (!event2_before(e, &eventtab2[pno])) {
+			break;
+		}
+		ev2heap[pos] = pno;
+		eventtab2[pno].heapidx = pos;
+		pos = parent;
+	}
+	ev2heap[pos] = no;
+	e->heapidx = pos;
+}
+
+static void event2_heap_down(int pos)
+{
+	int no = ev2heap[pos];
+	struct ev2 *e = &eventtab2[no];
+	for (;;) {
+		int child = pos * 4 + 1;
+		if (child >= ev2heapcnt) {
+			break;
+		}
+		int end = child + 4;
+		if (end > ev2heapcnt) {
+			end = ev2heapcnt;
+		}
+		int best = child;
+		for (int c = child + 1; c < end; c++) {
+			if (event2_before(&eventtab2[ev2heap[c]], &eventtab2[ev2heap[best]])) {
+				best = c;
+			}
+		}
+		if (!event2_before(&eventtab2[ev2heap[best]], e)) {
+			break;
+		}
+		ev2heap[pos] = ev2heap[best];
+		eventtab2[ev2heap[pos]].heapidx = pos;
+		pos = best;
+	}
+	ev2heap[pos] = no;
+	e->heapidx = pos;
+}
+
+static void event2_heap_remove(int no)
+{
+	int pos = eventtab2[no].heapidx;
+	eventtab2[no].heapidx = -1;
+	ev2heapcnt--;
+	if (pos == ev2heapcnt) {
+		return;
+	}
+	int last = ev2heap[ev2heapcnt];
+	ev2heap[pos] = last;
+	event2_heap_up(pos);
+	event2_heap_down(eventtab2[last].heapidx);
+}
+
+static void event2_deactivate(int no)
+{
+	struct ev2 *e = &eventtab2[no];
+	if (!e->active) {
+		return;
+	}
+	e->active = false;
+	event2_heap_remove(no);
+	struct ev2handler *h = &ev2handlers[e->hidx];
+	if (e->hprev >= 0) {
+		eventtab2[e->hprev].hnext = e->hnext;
+	} else {
+		h->head = e->hnext;
+	}
+	if (e->hnext >= 0) {
+		eventtab2[e->hnext].hprev = e->hprev;
+	}
+	h->active--;
+	e->hprev = -1;
+	e->hnext = -1;
+	if (no >= ev2_misc) {
+		e->hnext = ev2freehead;
+		ev2freehead = no;
+	}
+}
+
+static void event2_activate(int no, evt_t et, uae_u32 data, evfunc2 func)
+{
+	struct ev2 *e = &eventtab2[no];
+	int hidx = event2_handler_get(func);
+	struct ev2handler *h = &ev2handlers[hidx];
+
+	e->active = true;
+	e->evtime = et;
+	e->data = data;
+	e->handler = func;
+	e->seq = ev2seq++;
+	e->hidx = hidx;
+	e->hprev = -1;
+	e->hnext = h->head;
+	if (h->head >= 0) {
+		eventtab2[h->head].hprev = no;
+	}
+	h->head = no;
+	h->active++;
+
+	ev2heap[ev2heapcnt] = no;
+	ev2heapcnt++;
+	if (ev2heapcnt > ev2heappeak) {
+		ev2heappeak = ev2heapcnt;
+	}
+	event2_heap_up(ev2heapcnt - 1);
+}
+
+static int event2_alloc(void)
+{
+	if (ev2freehead < 0) {
+		event2_grow();
+	}
+	int no = ev2freehead;
+	ev2freehead = eventtab2[no].hnext;
+	eventtab2[no].hnext = -1;
+	return no;
+}
 
 void MISC_handler(void)
 {
-	evt_t mintime;
 	evt_t ct = get_cycles();
 
-	if (event2cnt) {
-		event2restart++;
-	}
 	eventtab[ev_misc].active = 0;
-	mintime = EVT_MAX;
-	int idx2 = event2idx;
-	for (int i = 0; i < ev2_max; i++) {
-		int idx = (idx2 + i) & (ev2_max - 1);
-		ev2 *e = &eventtab2[idx];
-		if (e->active) {
-			if (e->evtime == ct) {
-				e->active = false;
-				event2cnt++;
-				e->handler(e->data);
-				event2cnt--;
-				if (event2restart > 0) {
-					event2restart--;
-					mintime = EVT_MAX;
-					i = 0;
-				}
-			} else {
-				evt_t eventtime = e->evtime - ct;
-				if (eventtime < mintime) {
-					mintime = eventtime;
-				}
-			}
+	while (ev2heapcnt > 0) {
+		int no = ev2heap[0];
+		struct ev2 *e = &eventtab2[no];
+		if (e->evtime > ct) {
+			break;
 		}
+		// handler can add new events and reallocate eventtab2
+		evfunc2 func = e->handler;
+		uae_u32 data = e->data;
+		ev2handlers[e->hidx].dispatched++;
+		event2_deactivate(no);
+		func(data);
 	}
-	if (mintime < EVT_MAX) {
+	if (ev2heapcnt > 0) {
 		ev *e = &eventtab[ev_misc];
 		e->active = true;
 		e->oldcycles = ct;
-		e->evtime = ct + mintime;
+		e->evtime = eventtab2[ev2heap[0]].evtime;
 		events_schedule();
 	}
 }
@@ -393,95 +666,73 @@ void event2_newevent_xx_ce(evt_t t, uae_u32 data, evfunc2 func)
 
 void event2_newevent_xx(int no, evt_t t, uae_u32 data, evfunc2 func)
 {
-	evt_t et;
-	static int next = ev2_misc;
+	evt_t et = t + get_cycles();
 
-	et = t + get_cycles();
+	if (!ev2tableinit) {
+		event2_table_init();
+	}
 	if (no < 0) {
-		no = next;
-		for (;;) {
-			if (!eventtab2[no].active) {
-				break;
-			}
-			if (eventtab2[no].evtime == et && eventtab2[no].handler == func && eventtab2[no].data == data)
-				break;
-			no++;
-			if (no == ev2_max) {
-				no = ev2_misc;
-			}
-			if (no == next) {
-				// we may have multiple interrupts queued, merge if possible
-				for (int i = 0; i < ev2_max; i++) {
-					auto ev2 = &eventtab2[i];
-					if (ev2->active && ev2->handler == func && ev2->evtime == et && func == event_doint_delay_do_ext) {
-						ev2->data |= data;
-						return;
-					}
-				}
-				write_log(_T("out of event2's!\n"));
-				// execute most recent event immediately
-				evt_t mintime = EVT_MAX;
-				int minevent = -1;
-				evt_t ct = get_cycles();
-				for (int i = 0; i < ev2_max; i++) {
-					if (eventtab2[i].active) {
-						evt_t eventtime = eventtab2[i].evtime - ct;
-						if (eventtime < mintime) {
-							mintime = eventtime;
-							minevent = i;
-						}
-					}
-				}
-				if (minevent >= 0) {
-					eventtab2[minevent].active = false;
-					eventtab2[minevent].handler(eventtab2[minevent].data);
+		// identical event already queued?
+		int hidx = event2_handler_find(func);
+		if (hidx >= 0) {
+			for (int i = ev2handlers[hidx].head; i >= 0; i = eventtab2[i].hnext) {
+				if (eventtab2[i].evtime == et && eventtab2[i].data == data) {
+					MISC_handler();
+					return;
 				}
-				continue;
 			}
 		}
-		next = no;
+		no = event2_alloc();
+	} else {
+		event2_deactivate(no);
 	}
-	ev2 *e = &eventtab2[no];
-	e->active = true;
-	e->evtime = et;
-	e->handler = func;
-	e->data = data;
-	event2idx = addrdiff(e, eventtab2) + 1;
+	event2_activate(no, et, data, func);
 	MISC_handler();
 }
 
+void event2_remevent(int no)
+{
+	if (ev2tableinit) {
+		event2_deactivate(no);
+	}
+}
+
 void event2_newevent_x_replace_exists(evt_t t, uae_u32 data, evfunc2 func)
 {
-	for (int i = 0; i < ev2_max; i++) {
-		if (eventtab2[i].active && eventtab2[i].handler == func) {
-			eventtab2[i].active = false;
-			if (t <= 0) {
-				func(data);
-				return;
-			}
-			event2_newevent_xx(-1, t * CYCLE_UNIT, data, func);
-			return;
+	int hidx = event2_handler_find(func);
+	if (hidx < 0 || !ev2handlers[hidx].active) {
+		return;
+	}
+	// replace the earliest pending event of this handler
+	int first = ev2handlers[hidx].head;
+	for (int i = eventtab2[first].hnext; i >= 0; i = eventtab2[i].hnext) {
+		if (event2_before(&eventtab2[i], &eventtab2[first])) {
+			first = i;
 		}
 	}
+	event2_deactivate(first);
+	if (t <= 0) {
+		func(data);
+		return;
+	}
+	event2_newevent_xx(-1, t * CYCLE_UNIT, data, func);
 }
 
 void event2_newevent_x_remove(evfunc2 func)
 {
-	for (int i = 0; i < ev2_max; i++) {
-		if (eventtab2[i].active && eventtab2[i].handler == func) {
-			eventtab2[i].active = false;
-		}
+	int hidx = event2_handler_find(func);
+	if (hidx < 0) {
+		return;
+	}
+	while (ev2handlers[hidx].head >= 0) {
+		event2_deactivate(ev2handlers[hidx].head);
 	}
 }
 
 bool event2_newevent_x_exists(evfunc2 func)
 {
-	for (int i = 0; i < ev2_max; i++) {
-		if (eventtab2[i].active && eventtab2[i].handler == func) {
-			return true;
-		}
-	}
-	return false;
+	int hidx = event2_handler_find(func);
+	return hidx >= 0 && ev2handlers[hidx].active > 0;
 }
 
 void event2_newevent_x_replace(evt_t t, uae_u32 data, evfunc2 func)
@@ -506,6 +757,20 @@ void event2_newevent_x_add_not_exists(evt_t t, uae_u32 data, evfunc2 func)
 	event2_newevent_xx(-1, t * CYCLE_UNIT, data, func);
 }
 
+void events_dump_stats(void)
+{
+	static const TCHAR *evnames[] = { _T("sync"), _T("cia"), _T("misc"), _T("audio") };
+
+	for (int i = 0; i < ev_max; i++) {
+		console_out_f(_T("%-6s %c %12llu\n"), evnames[i], eventtab[i].active ? '*' : ' ', ev_dispatched[i]);
+	}
+	console_out_f(_T("event2: %d queued, %d peak, %d slots, %d grows\n"), ev2heapcnt, ev2heappeak, ev2_max, ev2grows);
+	for (int i = 0; i < ev2handlercnt; i++) {
+		struct ev2handler *h = &ev2handlers[i];
+		console_out_f(_T("%p %3d %12llu\n"), (void*)h->func, h->active, h->dispatched);
+	}
+}
+
 void event_init(void)
 {
 }
@@ -517,7 +782,5 @@ void clear_events(void)
 		eventtab[i].active = 0;
 		eventtab[i].oldcycles = get_cycles();
 	}
-	for (int i = 0; i < ev2_max; i++) {
-		eventtab2[i].active = 0;
-	}
+	event2_table_init();
 }
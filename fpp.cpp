@@ -3638,14 +3638,14 @@ void fpu_modechange(void)
 #ifdef WITH_SOFTFLOAT
 		fp_init_softfloat(currprefs.fpu_model);
 #endif
-#ifdef MSVC_LONG_DOUBLE
+#if defined(MSVC_LONG_DOUBLE) || defined(X87_LONG_DOUBLE)
 		use_long_double = false;
 	} else if (currprefs.fpu_mode < 0) {
 		use_long_double = true;
 		fp_init_native_80();
 #endif
 	} else {
-#ifdef MSVC_LONG_DOUBLE
+#if defined(MSVC_LONG_DOUBLE) || defined(X87_LONG_DOUBLE)
 		use_long_double = false;
 #endif
 		fp_init_native();
@@ -3682,7 +3682,7 @@ void fpu_reset (void)
 #ifdef WITH_SOFTFLOAT
 		fp_init_softfloat(currprefs.fpu_model);
 #endif
-#ifdef MSVC_LONG_DOUBLE
+#if defined(MSVC_LONG_DOUBLE) || defined(X87_LONG_DOUBLE)
 		use_long_double = false;
 	} else if (currprefs.fpu_mode < 0) {
 		use_long_double = true;
@@ -3692,7 +3692,7 @@ void fpu_reset (void)
 		}
 #endif
 	} else {
-#ifdef MSVC_LONG_DOUBLE
+#if defined(MSVC_LONG_DOUBLE) || defined(X87_LONG_DOUBLE)
 		use_long_double = false;
 #endif
 		fp_init_native();
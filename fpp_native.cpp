@@ -17,6 +17,10 @@
 #include "sysconfig.h"
 #include "sysdeps.h"
 
+#ifdef CPU_x86_64
+#include <xmmintrin.h>
+#endif
+
 #define USE_HOST_ROUNDING 1
 #define SOFTFLOAT_CONVERSIONS 1
 
@@ -155,12 +159,26 @@ static void set_fpucw_x87(uae_u32 m68k_cw)
 
 #endif /* defined(CPU_i386) || defined(CPU_x86_64) */
 
+#ifdef CPU_x86_64
+/* JIT SSE2 FPU code (comp_fpu_sse2) rounds with MXCSR.RC, not with the x87
+ * control word, so set it explicitly instead of relying on the C library. */
+static void set_mxcsr_round(uae_u32 m68k_cw)
+{
+	// RN, RZ, RM, RP
+	static const unsigned int mxcsr_round[4] = { 0x0000, 0x6000, 0x2000, 0x4000 };
+	_mm_setcsr((_mm_getcsr() & ~0x6000) | mxcsr_round[(m68k_cw >> 4) & 3]);
+}
+#endif
+
 static void native_set_fpucw(uae_u32 m68k_cw)
 {
 #ifndef __MACH__
 #if defined(CPU_i386) || defined(CPU_x86_64)
 	set_fpucw_x87(m68k_cw);
 #endif
+#ifdef CPU_x86_64
+	set_mxcsr_round(m68k_cw);
+#endif
 #endif
 }
 
@@ -0,0 +1,1136 @@
+/*
+* UAE - The Un*x Amiga Emulator
+*
+* MC68881/68882/68040/68060 FPU emulation
+*
+* Native FPU, GCC/Clang x87 80-bit long double
+*
+* Same register layout and behaviour as od-win32/fpp_native_msvc_80bit.cpp,
+* the x87 operations are done with inline assembly instead of external
+* assembly modules.
+*/
+
+#include "sysconfig.h"
+#include "sysdeps.h"
+
+#include "options.h"
+
+#ifdef X87_LONG_DOUBLE
+
+#include <math.h>
+
+#include "memory.h"
+#include "newcpu.h"
+#include "fpp.h"
+#include "uae/attributes.h"
+#include "softfloat/softfloat.h"
+
+typedef long double xfptype;
+
+/* All x87 operations are volatile asm so that they can't be moved across
+ * control word changes. Values stay in x87 registers or are spilled as
+ * 80-bit, so nothing is rounded between the steps. */
+
+static inline void xfp_fldcw(const uae_u16 *cw)
+{
+	__asm__ volatile ("fldcw %0" : : "m" (*cw));
+}
+static inline uae_u16 xfp_get_status(void)
+{
+	uae_u16 sw;
+	__asm__ volatile ("fnstsw %0" : "=a" (sw));
+	return sw;
+}
+static inline void xfp_clear_status(void)
+{
+	__asm__ volatile ("fnclex");
+}
+
+static inline xfptype xfp_load(const fprawtype *p)
+{
+	xfptype v;
+	__asm__ volatile ("fldt %1" : "=t" (v) : "m" (*p));
+	return v;
+}
+static inline void xfp_store(fprawtype *p, xfptype v)
+{
+	__asm__ volatile ("fstpt %0" : "=m" (*p) : "t" (v) : "st");
+}
+
+#define X87_CONST(name, insn) \
+static inline xfptype name(void) \
+{ \
+	xfptype r; \
+	__asm__ volatile (insn : "=t" (r)); \
+	return r; \
+}
+X87_CONST(x87_one, "fld1")
+X87_CONST(x87_l2e, "fldl2e")
+X87_CONST(x87_l2t, "fldl2t")
+X87_CONST(x87_lg2, "fldlg2")
+X87_CONST(x87_ln2, "fldln2")
+
+#define X87_OP1(name, insn) \
+static inline xfptype name(xfptype a) \
+{ \
+	xfptype r; \
+	__asm__ volatile (insn : "=t" (r) : "0" (a)); \
+	return r; \
+}
+X87_OP1(x87_rndint, "frndint")
+X87_OP1(x87_sqrt, "fsqrt")
+X87_OP1(x87_abs, "fabs")
+X87_OP1(x87_chs, "fchs")
+X87_OP1(x87_sin, "fsin")
+X87_OP1(x87_cos, "fcos")
+X87_OP1(x87_f2xm1, "f2xm1")
+X87_OP1(x87_tan, "fptan\n\tfstp %%st(0)")
+X87_OP1(x87_getexp, "fxtract\n\tfstp %%st(0)")
+X87_OP1(x87_getman, "fxtract\n\tfstp %%st(1)")
+
+// a is st(0), b is st(1). Only st(0) destination forms are used to stay
+// clear of the reversed AT&T fsubp/fdivp mnemonics.
+#define X87_OP2(name, insn) \
+static inline xfptype name(xfptype a, xfptype b) \
+{ \
+	xfptype r; \
+	__asm__ volatile (insn : "=t" (r) : "0" (a), "u" (b)); \
+	return r; \
+}
+X87_OP2(x87_add, "fadd %%st(1), %%st")
+X87_OP2(x87_sub, "fsub %%st(1), %%st")
+X87_OP2(x87_mul, "fmul %%st(1), %%st")
+X87_OP2(x87_div, "fdiv %%st(1), %%st")
+X87_OP2(x87_scale, "fscale")
+
+// popping forms: result = b * log2(a), atan(b / a)
+#define X87_OP2P(name, insn) \
+static inline xfptype name(xfptype a, xfptype b) \
+{ \
+	xfptype r; \
+	__asm__ volatile (insn : "=t" (r) : "0" (a), "u" (b) : "st(1)"); \
+	return r; \
+}
+X87_OP2P(x87_yl2x, "fyl2x")
+X87_OP2P(x87_yl2xp1, "fyl2xp1")
+X87_OP2P(x87_patan, "fpatan")
+
+// FPREM/FPREM1 only do partial reduction, repeat until C2 is clear
+#define X87_PREM(name, insn) \
+static inline xfptype name(xfptype a, xfptype b) \
+{ \
+	xfptype r; \
+	uae_u16 sw; \
+	__asm__ volatile ("1:\n\t" insn "\n\tfnstsw %%ax\n\ttestw $0x400, %%ax\n\tjnz 1b" : "=t" (r), "=a" (sw) : "0" (a), "u" (b)); \
+	return r; \
+}
+X87_PREM(x87_prem, "fprem")
+X87_PREM(x87_prem1, "fprem1")
+
+static inline double x87_to_double(xfptype v)
+{
+	double d;
+	__asm__ volatile ("fstpl %0" : "=m" (d) : "t" (v) : "st");
+	return d;
+}
+static inline xfptype x87_from_double(const double *d)
+{
+	xfptype v;
+	__asm__ volatile ("fldl %1" : "=t" (v) : "m" (*d));
+	return v;
+}
+static inline uae_u32 x87_to_single(xfptype v)
+{
+	uae_u32 f;
+	__asm__ volatile ("fstps %0" : "=m" (f) : "t" (v) : "st");
+	return f;
+}
+static inline xfptype x87_from_single(const uae_u32 *f)
+{
+	xfptype v;
+	__asm__ volatile ("flds %1" : "=t" (v) : "m" (*f));
+	return v;
+}
+static inline uae_s64 x87_to_int(xfptype v)
+{
+	uae_s64 i;
+	__asm__ volatile ("fistpll %0" : "=m" (i) : "t" (v) : "st");
+	return i;
+}
+static inline xfptype x87_from_int(const uae_s32 *i)
+{
+	xfptype v;
+	__asm__ volatile ("fildl %1" : "=t" (v) : "m" (*i));
+	return v;
+}
+
+// 2^x: split into integer and fraction, F2XM1 only accepts -1..1
+static xfptype x87_pow2(xfptype x)
+{
+	xfptype i = x87_rndint(x);
+	xfptype f = x87_add(x87_f2xm1(x87_sub(x, i)), x87_one());
+	return x87_scale(f, i);
+}
+
+static const fprawtype xfp_pihalf = { 0xc90fdaa22168c235ULL, 0x3fff, 0 };
+static const uae_u16 x87_cw_normal = 0x037f;
+
+static uae_u16 fpx_mode = 0x107f;
+
+#define	FPCR_ROUNDING_MODE	0x00000030
+#define	FPCR_ROUND_NEAR		0x00000000
+#define	FPCR_ROUND_ZERO		0x00000010
+#define	FPCR_ROUND_MINF		0x00000020
+#define	FPCR_ROUND_PINF		0x00000030
+
+#define	FPCR_ROUNDING_PRECISION	0x000000c0
+#define	FPCR_PRECISION_SINGLE	0x00000040
+#define	FPCR_PRECISION_DOUBLE	0x00000080
+#define FPCR_PRECISION_EXTENDED	0x00000000
+
+static struct float_status fs;
+static uae_u16 fp_status;
+
+static void fp_set_mode(uae_u32 m68k_cw)
+{
+	// RN, RZ, RD, RU
+	static const uae_u16 fp87_round[4] = { 0 << 10, 3 << 10, 1 << 10, 2 << 10 };
+	static const uae_u16 sw_round[4] = { float_round_nearest_even, float_round_to_zero, float_round_down, float_round_up };
+	// Extend X, Single S, Double D, Undefined (Double)
+	static const uae_u16 fp87_prec[4] = { 3 << 8, 0 << 8, 2 << 8, 2 << 8 };
+	static const uae_u16 sw_prec[4] = { 80, 32, 64, 64 };
+
+	int round = (m68k_cw >> 4) & 3;
+	int prec = (m68k_cw >> 6) & 3;
+
+	fpx_mode = fp87_round[round] | fp87_prec[prec] | 0x107f;
+	xfp_fldcw(&fpx_mode);
+	set_float_rounding_mode(sw_round[round], &fs);
+	set_floatx80_rounding_precision(sw_prec[prec], &fs);
+}
+
+static void fp_get_status(uae_u32 *status)
+{
+	uae_u16 st = xfp_get_status();
+
+	if (st & (1 << 5)) // P
+		*status |= FPSR_INEX2;
+	if (st & (1 << 4)) // U
+		*status |= FPSR_UNFL;
+	if (st & (1 << 3)) // O
+		*status |= FPSR_OVFL;
+	if (st & (1 << 2)) // Z
+		*status |= FPSR_DZ;
+	if (st & (1 << 0)) // I
+		*status |= FPSR_OPERR;
+	*status |= fp_status;
+}
+
+static void fp_clear_status(void)
+{
+	xfp_clear_status();
+	fp_status = 0;
+}
+
+static void xfp_to_softfloat(fpdata *fpd)
+{
+	fpd->fpx.high = fpd->rfp.e;
+	fpd->fpx.low = fpd->rfp.m;
+}
+static void xfp_from_softfloat(fpdata *fpd)
+{
+	fpd->rfp.e = fpd->fpx.high;
+	fpd->rfp.m = fpd->fpx.low;
+}
+
+// C library calls (printf/scanf) expect the default control word
+static void fp_normal_prec(void)
+{
+	if (fpx_mode != x87_cw_normal)
+		xfp_fldcw(&x87_cw_normal);
+}
+
+static void fp_reset_normal_prec(void)
+{
+	if (fpx_mode != x87_cw_normal)
+		xfp_fldcw(&fpx_mode);
+}
+
+/* Functions for rounding */
+
+// round to float with extended precision exponent
+static void fp_round32(fpdata *fpd)
+{
+	xfp_to_softfloat(fpd);
+	fpd->fpx = floatx80_round32(fpd->fpx, &fs);
+	xfp_from_softfloat(fpd);
+}
+
+// round to double with extended precision exponent
+static void fp_round64(fpdata *fpd)
+{
+	xfp_to_softfloat(fpd);
+	fpd->fpx = floatx80_round64(fpd->fpx, &fs);
+	xfp_from_softfloat(fpd);
+}
+
+// round to float
+static void fp_round_single(fpdata *fpd)
+{
+	uae_u32 v = x87_to_single(xfp_load(&fpd->rfp));
+	xfp_store(&fpd->rfp, x87_from_single(&v));
+}
+
+// round to double
+static void fp_round_double(fpdata *fpd)
+{
+	double v = x87_to_double(xfp_load(&fpd->rfp));
+	xfp_store(&fpd->rfp, x87_from_double(&v));
+}
+
+static bool xfp_changed;
+static uint8_t xfp_swprec;
+
+static void xfp_resetprec(void)
+{
+	if (xfp_changed) {
+		xfp_fldcw(&fpx_mode);
+		set_floatx80_rounding_precision(xfp_swprec, &fs);
+		xfp_changed = false;
+	}
+}
+
+static void xfp_setprec(int prec)
+{
+	// normal, float, double, extended
+	static const uae_u16 prectable[] = { 0, 0 << 8, 2 << 8, 3 << 8 };
+	static const uint8_t sfprectable[] = { 0, 32, 64, 80 };
+	if (prec == PREC_NORMAL) {
+		xfp_changed = false;
+		return;
+	}
+	uae_u16 v = fpx_mode;
+	// clear precision fields
+	v &= ~(3 << 8);
+	v |= prectable[prec];
+	if (v != fpx_mode) {
+		xfp_fldcw(&v);
+		xfp_swprec = fs.floatx80_rounding_precision;
+		set_floatx80_rounding_precision(sfprectable[prec], &fs);
+		xfp_changed = true;
+	} else {
+		xfp_changed = false;
+	}
+}
+
+// Transcendental functions are calculated in extended precision, round to
+// nearest and then rounded to the selected precision if strict mode.
+static void xfp_setnormal(void)
+{
+	uae_u16 v = fpx_mode;
+	v |= 3 << 8; // extended
+	v &= ~(3 << 10); // round nearest
+	if (v != fpx_mode) {
+		xfp_fldcw(&v);
+		xfp_swprec = fs.floatx80_rounding_precision;
+		set_floatx80_rounding_precision(80, &fs);
+		xfp_changed = true;
+	} else {
+		xfp_changed = false;
+	}
+}
+
+static void xfp_resetnormal(fpdata *fp)
+{
+	if (xfp_changed) {
+		xfp_fldcw(&fpx_mode);
+		set_floatx80_rounding_precision(xfp_swprec, &fs);
+		xfp_changed = false;
+	}
+	xfp_clear_status();
+	if (!currprefs.fpu_strict)
+		return;
+	if (fs.floatx80_rounding_precision == 32)
+		fp_round_single(fp);
+	else if (fs.floatx80_rounding_precision == 64)
+		fp_round_double(fp);
+}
+
+static uae_u32 fp_get_support_flags(void)
+{
+	return FPU_FEATURE_EXCEPTIONS;
+}
+
+/* Functions for detecting float type */
+static bool fp_is_init(fpdata *fpd)
+{
+	xfp_to_softfloat(fpd);
+	return 0;
+}
+static bool fp_is_snan(fpdata *fpd)
+{
+	// quiet bit clear
+	return floatx80_is_any_nan(fpd->fpx) && !(fpd->fpx.low & LIT64(0x4000000000000000));
+}
+static bool fp_unset_snan(fpdata *fpd)
+{
+	fpd->rfp.m |= LIT64(0x4000000000000000);
+	return 0;
+}
+static bool fp_is_nan(fpdata *fpd)
+{
+	return floatx80_is_any_nan(fpd->fpx) != 0;
+}
+static bool fp_is_infinity(fpdata *fpd)
+{
+	return (fpd->fpx.high & 0x7fff) == 0x7fff && (uae_u64)(fpd->fpx.low << 1) == 0;
+}
+static bool fp_is_zero(fpdata *fpd)
+{
+	return (fpd->fpx.high & 0x7fff) < 0x7fff && fpd->fpx.low == 0;
+}
+static bool fp_is_neg(fpdata *fpd)
+{
+	return (fpd->fpx.high & 0x8000) != 0;
+}
+static bool fp_is_denormal(fpdata *fpd)
+{
+	return (fpd->fpx.high & 0x7fff) == 0 && !(fpd->fpx.low & LIT64(0x8000000000000000)) && (uae_u64)(fpd->fpx.low << 1);
+}
+static bool fp_is_unnormal(fpdata *fpd)
+{
+	uae_u16 exp = fpd->fpx.high & 0x7fff;
+	return exp > 0 && exp < 0x7fff && !(fpd->fpx.low & LIT64(0x8000000000000000));
+}
+
+/* Functions for converting between float formats */
+
+static void fp_to_native(fptype *fp, fpdata *fpd)
+{
+	*fp = x87_to_double(xfp_load(&fpd->rfp));
+}
+static void fp_from_native(fptype fp, fpdata *fpd)
+{
+	xfp_store(&fpd->rfp, x87_from_double(&fp));
+	fp_clear_status();
+}
+
+static void fp_to_single(fpdata *fpd, uae_u32 wrd1)
+{
+	xfp_store(&fpd->rfp, x87_from_single(&wrd1));
+}
+static uae_u32 fp_from_single(fpdata *fpd)
+{
+	return x87_to_single(xfp_load(&fpd->rfp));
+}
+
+static void fp_to_double(fpdata *fpd, uae_u32 wrd1, uae_u32 wrd2)
+{
+	union {
+		double d;
+		uae_u64 v;
+	} u;
+	u.v = ((uae_u64)wrd1 << 32) | wrd2;
+	xfp_store(&fpd->rfp, x87_from_double(&u.d));
+}
+static void fp_from_double(fpdata *fpd, uae_u32 *wrd1, uae_u32 *wrd2)
+{
+	union {
+		double d;
+		uae_u64 v;
+	} u;
+	u.d = x87_to_double(xfp_load(&fpd->rfp));
+	*wrd1 = u.v >> 32;
+	*wrd2 = (uae_u32)u.v;
+}
+static void fp_to_exten(fpdata *fpd, uae_u32 wrd1, uae_u32 wrd2, uae_u32 wrd3)
+{
+	fpd->rfp.m = ((uae_u64)wrd2 << 32) | wrd3;
+	fpd->rfp.e = wrd1 >> 16;
+}
+static void fp_from_exten(fpdata *fpd, uae_u32 *wrd1, uae_u32 *wrd2, uae_u32 *wrd3)
+{
+	*wrd3 = (uae_u32)fpd->rfp.m;
+	*wrd2 = fpd->rfp.m >> 32;
+	*wrd1 = (uae_u32)fpd->rfp.e << 16;
+}
+
+static uae_s64 fp_to_int(fpdata *src, int size)
+{
+	static const fptype fxsizes1[6] =
+	{
+		-128.0, 127.0,
+		-32768.0, 32767.0,
+		-2147483648.0, 2147483647.0
+	};
+	static const uae_s64 fxsizes2[6] =
+	{
+		-128, 127,
+		-32768, 32767,
+		-2147483648LL, 2147483647
+	};
+	// x87 returns the integer indefinite value if conversion is out
+	// of range so convert to double first, then do range check
+	fptype d = x87_to_double(xfp_load(&src->rfp));
+	if (d < fxsizes1[size * 2 + 0]) {
+		return fxsizes2[size * 2 + 0];
+	} if (d > fxsizes1[size * 2 + 1]) {
+		return fxsizes2[size * 2 + 1];
+	}
+	return x87_to_int(xfp_load(&src->rfp));
+}
+static void fp_from_int(fpdata *fpd, uae_s32 src)
+{
+	xfp_store(&fpd->rfp, x87_from_int(&src));
+}
+
+static const TCHAR *fp_print(fpdata *fpd, int mode)
+{
+	static TCHAR fsout[32];
+	bool n;
+	xfptype fp;
+
+	if (mode < 0) {
+		uae_u32 w1, w2, w3;
+		fp_from_exten(fpd, &w1, &w2, &w3);
+		_stprintf(fsout, _T("%04X-%08X-%08X"), w1 >> 16, w2, w3);
+		return fsout;
+	}
+	fp = xfp_load(&fpd->rfp);
+	fp_normal_prec();
+
+	n = signbit(fp) ? 1 : 0;
+
+	if(isinf(fp)) {
+		_stprintf(fsout, _T("%c%s"), n ? '-' : '+', _T("inf"));
+	} else if(isnan(fp)) {
+		_stprintf(fsout, _T("%c%s"), n ? '-' : '+', _T("nan"));
+	} else {
+		_stprintf(fsout, _T("#%Le"), fp);
+	}
+	fp_reset_normal_prec();
+	if (mode <= 0 || (size_t)mode > _tcslen(fsout))
+		return fsout;
+	fsout[mode] = 0;
+	return fsout;
+}
+
+/* Arithmetic functions */
+
+static void fp_move(fpdata *a, fpdata *b, int prec)
+{
+	xfp_setprec(prec);
+	xfp_store(&a->rfp, xfp_load(&b->rfp));
+	xfp_resetprec();
+}
+
+static void fp_int(fpdata *a, fpdata *b)
+{
+	xfp_store(&a->rfp, x87_rndint(xfp_load(&b->rfp)));
+}
+
+static void fp_intrz(fpdata *a, fpdata *b)
+{
+	if ((fpx_mode & (3 << 10)) == (3 << 10)) {
+		fp_int(a, b);
+	} else {
+		uae_u16 s = fpx_mode | (3 << 10);
+		xfp_fldcw(&s);
+		fp_int(a, b);
+		xfp_fldcw(&fpx_mode);
+	}
+}
+
+static void fp_getexp(fpdata *a, fpdata *b)
+{
+	xfp_store(&a->rfp, x87_getexp(xfp_load(&b->rfp)));
+}
+static void fp_getman(fpdata *a, fpdata *b)
+{
+	xfp_store(&a->rfp, x87_getman(xfp_load(&b->rfp)));
+}
+
+static void fp_div(fpdata *a, fpdata *b, int prec)
+{
+	xfp_setprec(prec);
+	xfp_store(&a->rfp, x87_div(xfp_load(&a->rfp), xfp_load(&b->rfp)));
+	xfp_resetprec();
+}
+
+static void fp_quotient(xfptype quot, uae_u64 *q, uae_u8 *s)
+{
+	if (signbit(quot)) {
+		*s = 1;
+		quot = -quot;
+	} else {
+		*s = 0;
+	}
+	// only the low 7 bits end up in FPSR
+	*q = isfinite(quot) ? (uae_u64)fmodl(quot, 128.0L) : 0;
+}
+
+static void fp_mod(fpdata *a, fpdata *b, uae_u64 *q, uae_u8 *s)
+{
+	xfptype x = xfp_load(&a->rfp);
+	xfptype y = xfp_load(&b->rfp);
+	xfptype r = x87_prem(x, y);
+	fp_quotient(truncl(x87_div(x87_sub(x, r), y)), q, s);
+	xfp_store(&a->rfp, r);
+}
+
+static void fp_rem(fpdata *a, fpdata *b, uae_u64 *q, uae_u8 *s)
+{
+	xfptype x = xfp_load(&a->rfp);
+	xfptype y = xfp_load(&b->rfp);
+	xfptype r = x87_prem1(x, y);
+	fp_quotient(roundl(x87_div(x87_sub(x, r), y)), q, s);
+	xfp_store(&a->rfp, r);
+}
+
+static void fp_scale(fpdata *a, fpdata *b)
+{
+	xfp_store(&a->rfp, x87_scale(xfp_load(&a->rfp), xfp_load(&b->rfp)));
+}
+
+static void fp_sinh(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfptype t = x87_mul(xfp_load(&b->rfp), x87_l2e());
+	xfptype v = x87_sub(x87_pow2(t), x87_pow2(x87_chs(t)));
+	xfp_store(&a->rfp, x87_scale(v, x87_chs(x87_one())));
+	xfp_resetnormal(a);
+}
+static void fp_cosh(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfptype t = x87_mul(xfp_load(&b->rfp), x87_l2e());
+	xfptype v = x87_add(x87_pow2(t), x87_pow2(x87_chs(t)));
+	xfp_store(&a->rfp, x87_scale(v, x87_chs(x87_one())));
+	xfp_resetnormal(a);
+}
+static void fp_tanh(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfptype t = x87_mul(xfp_load(&b->rfp), x87_l2e());
+	xfptype p = x87_pow2(t);
+	xfptype m = x87_pow2(x87_chs(t));
+	xfp_store(&a->rfp, x87_div(x87_sub(p, m), x87_add(p, m)));
+	xfp_resetnormal(a);
+}
+static void fp_etox(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfp_store(&a->rfp, x87_pow2(x87_mul(xfp_load(&b->rfp), x87_l2e())));
+	xfp_resetnormal(a);
+}
+static void fp_etoxm1(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfptype v = x87_pow2(x87_mul(xfp_load(&b->rfp), x87_l2e()));
+	xfp_store(&a->rfp, x87_sub(v, x87_one()));
+	xfp_resetnormal(a);
+}
+static void fp_twotox(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfp_store(&a->rfp, x87_pow2(xfp_load(&b->rfp)));
+	xfp_resetnormal(a);
+}
+static void fp_tentox(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfp_store(&a->rfp, x87_pow2(x87_mul(xfp_load(&b->rfp), x87_l2t())));
+	xfp_resetnormal(a);
+}
+static void fp_logn(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfp_store(&a->rfp, x87_yl2x(xfp_load(&b->rfp), x87_ln2()));
+	xfp_resetnormal(a);
+}
+static void fp_lognp1(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfp_store(&a->rfp, x87_yl2xp1(xfp_load(&b->rfp), x87_ln2()));
+	xfp_resetnormal(a);
+}
+static void fp_log10(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfp_store(&a->rfp, x87_yl2x(xfp_load(&b->rfp), x87_lg2()));
+	xfp_resetnormal(a);
+}
+static void fp_log2(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfp_store(&a->rfp, x87_yl2x(xfp_load(&b->rfp), x87_one()));
+	xfp_resetnormal(a);
+}
+// asin(x) = atan(x / sqrt(1 - x * x))
+static void fp_asin(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfptype x = xfp_load(&b->rfp);
+	xfptype d = x87_sqrt(x87_sub(x87_one(), x87_mul(x, x)));
+	xfp_store(&a->rfp, x87_patan(d, x));
+	xfp_resetnormal(a);
+}
+static void fp_acos(fpdata *a, fpdata *b)
+{
+	xfp_setnormal();
+	xfptype x = xfp_load(&b->rfp);
+	xfptype d = x87_sqrt(x87_sub(x87_one(), x87_mul(x, x)));
+	xfp_store(&a->rfp, x87_sub(xfp_load(&xfp_pihalf), x87_patan(d, x)));
+	xfp_resetnormal(a);
+}
+static void fp_atanh(fpdata *a, fpdata *b)
+{
+	xfp_to_softfloat(b);
+	a->fpx = floatx80_atanh(b->fpx, &fs);
+	xfp_from_softfloat(a);
+}
+static void fp_sincos(fpdata *a, fpdata *b, fpdata *c)
+{
+	xfp_setnormal();
+	xfptype x = xfp_load(&b->rfp);
+	xfp_store(&c->rfp, x87_cos(x));
+	xfp_store(&a->rfp, x87_sin(x));
+	xfp_resetnormal(a);
+	xfp_resetnormal(c);
+}
+
+static void fp_sqrt(fpdata *a, fpdata *b, int prec)
+{
+	xfp_setprec(prec);
+	xfp_store(&a->rfp, x87_sqrt(xfp_load(&b->rfp)));
+	xfp_resetprec();
+}
+static void fp_atan(fpdata *a, fpdata *b)
+{
+	xfp_store(&a->rfp, x87_patan(x87_one(), xfp_load(&b->rfp)));
+}
+static void fp_sin(fpdata *a, fpdata *b)
+{
+	xfp_store(&a->rfp, x87_sin(xfp_load(&b->rfp)));
+}
+static void fp_cos(fpdata *a, fpdata *b)
+{
+	xfp_store(&a->rfp, x87_cos(xfp_load(&b->rfp)));
+}
+static void fp_tan(fpdata *a, fpdata *b)
+{
+	xfp_store(&a->rfp, x87_tan(xfp_load(&b->rfp)));
+}
+
+static void fp_abs(fpdata *a, fpdata *b, int prec)
+{
+	xfp_setprec(prec);
+	xfp_store(&a->rfp, x87_abs(xfp_load(&b->rfp)));
+	xfp_resetprec();
+}
+static void fp_neg(fpdata *a, fpdata *b, int prec)
+{
+	xfp_setprec(prec);
+	xfp_store(&a->rfp, x87_chs(xfp_load(&b->rfp)));
+	xfp_resetprec();
+}
+static void fp_sub(fpdata *a, fpdata *b, int prec)
+{
+	xfp_setprec(prec);
+	xfp_store(&a->rfp, x87_sub(xfp_load(&a->rfp), xfp_load(&b->rfp)));
+	xfp_resetprec();
+}
+static void fp_add(fpdata *a, fpdata *b, int prec)
+{
+	xfp_setprec(prec);
+	xfp_store(&a->rfp, x87_add(xfp_load(&a->rfp), xfp_load(&b->rfp)));
+	xfp_resetprec();
+}
+static void fp_mul(fpdata *a, fpdata *b, int prec)
+{
+	xfp_setprec(prec);
+	xfp_store(&a->rfp, x87_mul(xfp_load(&a->rfp), xfp_load(&b->rfp)));
+	xfp_resetprec();
+}
+static void fp_sglmul(fpdata *a, fpdata *b)
+{
+	xfp_setprec(PREC_EXTENDED);
+	a->rfp.m &= 0xFFFFFF0000000000;
+	b->rfp.m &= 0xFFFFFF0000000000;
+	xfp_store(&a->rfp, x87_mul(xfp_load(&a->rfp), xfp_load(&b->rfp)));
+	fpdata fpx = *a;
+	xfp_resetprec();
+	fp_round32(a);
+	if (fpx.rfp.m != a->rfp.m)
+		fp_status |= FPSR_INEX2;
+}
+static void fp_sgldiv(fpdata *a, fpdata *b)
+{
+	xfp_setprec(PREC_FLOAT);
+	xfp_store(&a->rfp, x87_div(xfp_load(&a->rfp), xfp_load(&b->rfp)));
+	xfp_resetprec();
+}
+
+static void fp_normalize(fpdata *a)
+{
+}
+
+static void fp_cmp(fpdata *a, fpdata *b)
+{
+	// subtraction would return NaN for equal infinities
+	xfp_to_softfloat(a);
+	xfp_to_softfloat(b);
+	a->fpx = floatx80_cmp(a->fpx, b->fpx, &fs);
+	xfp_from_softfloat(a);
+	fp_clear_status();
+}
+
+static void fp_tst(fpdata *a, fpdata *b)
+{
+	a->rfp.m = b->rfp.m;
+	a->rfp.e = b->rfp.e;
+}
+
+/* Functions for returning exception state data */
+
+static void fp_get_internal_overflow(fpdata *fpd)
+{
+	fpd->rfp.m = 0;
+	fpd->rfp.e = 0;
+}
+static void fp_get_internal_underflow(fpdata *fpd)
+{
+	fpd->rfp.m = 0;
+	fpd->rfp.e = 0;
+}
+static void fp_get_internal_round_all(fpdata *fpd)
+{
+	fpd->rfp.m = 0;
+	fpd->rfp.e = 0;
+}
+static void fp_get_internal_round(fpdata *fpd)
+{
+	fpd->rfp.m = 0;
+	fpd->rfp.e = 0;
+}
+static void fp_get_internal_round_exten(fpdata *fpd)
+{
+	fpd->rfp.m = 0;
+	fpd->rfp.e = 0;
+}
+static void fp_get_internal(fpdata *fpd)
+{
+	fpd->rfp.m = 0;
+	fpd->rfp.e = 0;
+}
+static uae_u32 fp_get_internal_grs(void)
+{
+	return 0;
+}
+
+/* Function for denormalizing */
+static void fp_denormalize(fpdata *fpd, int esign)
+{
+}
+
+static void fp_from_pack (fpdata *src, uae_u32 *wrd, int kfactor)
+{
+	int i, j, t;
+	int exp;
+	int ndigits;
+	char *cp, *strp;
+	char str[100];
+	fptype fp;
+
+	fp_is_init(src);
+	if (fp_is_nan(src)) {
+		// copy bit by bit, handle signaling nan
+		fpp_from_exten(src, &wrd[0], &wrd[1], &wrd[2]);
+		return;
+	}
+	if (fp_is_infinity(src)) {
+		// extended exponent and all 0 packed fraction
+		fpp_from_exten(src, &wrd[0], &wrd[1], &wrd[2]);
+		wrd[1] = wrd[2] = 0;
+		return;
+	}
+
+	wrd[0] = wrd[1] = wrd[2] = 0;
+
+	fp_to_native(&fp, src);
+	fp_normal_prec();
+
+	sprintf (str, "%#.17e", fp);
+
+	// get exponent
+	cp = str;
+	while (*cp != 'e') {
+		if (*cp == 0)
+			return;
+		cp++;
+	}
+	cp++;
+	if (*cp == '+')
+		cp++;
+	exp = atoi (cp);
+
+	// remove trailing zeros
+	cp = str;
+	while (*cp != 'e') {
+		cp++;
+	}
+	cp[0] = 0;
+	cp--;
+	while (cp > str && *cp == '0') {
+		*cp = 0;
+		cp--;
+	}
+
+	cp = str;
+	// get sign
+	if (*cp == '-') {
+		cp++;
+		wrd[0] = 0x80000000;
+	} else if (*cp == '+') {
+		cp++;
+	}
+	strp = cp;
+
+	if (kfactor <= 0) {
+		ndigits = abs (exp) + (-kfactor) + 1;
+	} else {
+		if (kfactor > 17) {
+			kfactor = 17;
+			fpsr_set_exception(FPSR_OPERR);
+		}
+		ndigits = kfactor;
+	}
+
+	if (ndigits < 0)
+		ndigits = 0;
+	if (ndigits > 16)
+		ndigits = 16;
+
+	// remove decimal point
+	strp[1] = strp[0];
+	strp++;
+	// add trailing zeros
+	i = uaestrlen(strp);
+	cp = strp + i;
+	while (i < ndigits) {
+		*cp++ = '0';
+		i++;
+	}
+	i = ndigits + 1;
+	while (i < 17) {
+		strp[i] = 0;
+		i++;
+	}
+	*cp = 0;
+	i = ndigits - 1;
+	// need to round?
+	if (i >= 0 && strp[i + 1] >= '5') {
+		while (i >= 0) {
+			strp[i]++;
+			if (strp[i] <= '9')
+				break;
+			if (i == 0) {
+				strp[i] = '1';
+				exp++;
+			} else {
+				strp[i] = '0';
+			}
+			i--;
+		}
+	}
+	strp[ndigits] = 0;
+
+	// store first digit of mantissa
+	cp = strp;
+	wrd[0] |= *cp++ - '0';
+
+	// store rest of mantissa
+	for (j = 1; j < 3; j++) {
+		for (i = 0; i < 8; i++) {
+			wrd[j] <<= 4;
+			if (*cp >= '0' && *cp <= '9')
+				wrd[j] |= *cp++ - '0';
+		}
+	}
+
+	// exponent
+	if (exp < 0) {
+		wrd[0] |= 0x40000000;
+		exp = -exp;
+	}
+	if (exp > 9999) // ??
+		exp = 9999;
+	if (exp > 999) {
+		int d = exp / 1000;
+		wrd[0] |= d << 12;
+		exp -= d * 1000;
+		fpsr_set_exception(FPSR_OPERR);
+	}
+	i = 100;
+	t = 0;
+	while (i >= 1) {
+		int d = exp / i;
+		t <<= 4;
+		t |= d;
+		exp -= d * i;
+		i /= 10;
+	}
+	wrd[0] |= t << 16;
+	fp_reset_normal_prec();
+}
+
+static void fp_to_pack (fpdata *fpd, uae_u32 *wrd, int dummy)
+{
+	fptype d;
+	char *cp;
+	char str[100];
+
+	if (((wrd[0] >> 16) & 0x7fff) == 0x7fff) {
+		// infinity has extended exponent and all 0 packed fraction
+		// nans are copies bit by bit
+		fpp_to_exten(fpd, wrd[0], wrd[1], wrd[2]);
+		return;
+	}
+	if (!(wrd[0] & 0xf) && !wrd[1] && !wrd[2]) {
+		// exponent is not cared about, if mantissa is zero
+		wrd[0] &= 0x80000000;
+		fpp_to_exten(fpd, wrd[0], wrd[1], wrd[2]);
+		return;
+	}
+
+	fp_normal_prec();
+	cp = str;
+	if (wrd[0] & 0x80000000)
+		*cp++ = '-';
+	*cp++ = (wrd[0] & 0xf) + '0';
+	*cp++ = '.';
+	*cp++ = ((wrd[1] >> 28) & 0xf) + '0';
+	*cp++ = ((wrd[1] >> 24) & 0xf) + '0';
+	*cp++ = ((wrd[1] >> 20) & 0xf) + '0';
+	*cp++ = ((wrd[1] >> 16) & 0xf) + '0';
+	*cp++ = ((wrd[1] >> 12) & 0xf) + '0';
+	*cp++ = ((wrd[1] >> 8) & 0xf) + '0';
+	*cp++ = ((wrd[1] >> 4) & 0xf) + '0';
+	*cp++ = ((wrd[1] >> 0) & 0xf) + '0';
+	*cp++ = ((wrd[2] >> 28) & 0xf) + '0';
+	*cp++ = ((wrd[2] >> 24) & 0xf) + '0';
+	*cp++ = ((wrd[2] >> 20) & 0xf) + '0';
+	*cp++ = ((wrd[2] >> 16) & 0xf) + '0';
+	*cp++ = ((wrd[2] >> 12) & 0xf) + '0';
+	*cp++ = ((wrd[2] >> 8) & 0xf) + '0';
+	*cp++ = ((wrd[2] >> 4) & 0xf) + '0';
+	*cp++ = ((wrd[2] >> 0) & 0xf) + '0';
+	*cp++ = 'E';
+	if (wrd[0] & 0x40000000)
+		*cp++ = '-';
+	*cp++ = ((wrd[0] >> 24) & 0xf) + '0';
+	*cp++ = ((wrd[0] >> 20) & 0xf) + '0';
+	*cp++ = ((wrd[0] >> 16) & 0xf) + '0';
+	*cp = 0;
+	sscanf (str, "%le", &d);
+	fp_reset_normal_prec();
+	fp_from_native(d, fpd);
+}
+
+
+bool fp_init_native_80(void)
+{
+	set_floatx80_rounding_precision(80, &fs);
+	set_float_rounding_mode(float_round_to_zero, &fs);
+
+	fpp_print = fp_print;
+	fpp_unset_snan = fp_unset_snan;
+
+	fpp_is_init = fp_is_init;
+	fpp_is_snan = fp_is_snan;
+	fpp_is_nan = fp_is_nan;
+	fpp_is_infinity = fp_is_infinity;
+	fpp_is_zero = fp_is_zero;
+	fpp_is_neg = fp_is_neg;
+	fpp_is_denormal = fp_is_denormal;
+	fpp_is_unnormal = fp_is_unnormal;
+	fpp_fix_infinity = NULL;
+
+	fpp_get_status = fp_get_status;
+	fpp_clear_status = fp_clear_status;
+	fpp_set_mode = fp_set_mode;
+	fpp_get_support_flags = fp_get_support_flags;
+
+	fpp_to_int = fp_to_int;
+	fpp_from_int = fp_from_int;
+
+	fpp_to_pack = fp_to_pack;
+	fpp_from_pack = fp_from_pack;
+
+	fpp_to_single = fp_to_single;
+	fpp_from_single = fp_from_single;
+	fpp_to_double = fp_to_double;
+	fpp_from_double = fp_from_double;
+	fpp_to_exten = fp_to_exten;
+	fpp_from_exten = fp_from_exten;
+	fpp_to_exten_fmovem = fp_to_exten;
+	fpp_from_exten_fmovem = fp_from_exten;
+
+	fpp_round_single = fp_round_single;
+	fpp_round_double = fp_round_double;
+	fpp_round32 = fp_round32;
+	fpp_round64 = fp_round64;
+
+	fpp_normalize = fp_normalize;
+	fpp_denormalize = fp_denormalize;
+	fpp_get_internal_overflow = fp_get_internal_overflow;
+	fpp_get_internal_underflow = fp_get_internal_underflow;
+	fpp_get_internal_round_all = fp_get_internal_round_all;
+	fpp_get_internal_round = fp_get_internal_round;
+	fpp_get_internal_round_exten = fp_get_internal_round_exten;
+	fpp_get_internal = fp_get_internal;
+	fpp_get_internal_grs = fp_get_internal_grs;
+
+	fpp_int = fp_int;
+	fpp_sinh = fp_sinh;
+	fpp_intrz = fp_intrz;
+	fpp_sqrt = fp_sqrt;
+	fpp_lognp1 = fp_lognp1;
+	fpp_etoxm1 = fp_etoxm1;
+	fpp_tanh = fp_tanh;
+	fpp_atan = fp_atan;
+	fpp_atanh = fp_atanh;
+	fpp_sin = fp_sin;
+	fpp_asin = fp_asin;
+	fpp_tan = fp_tan;
+	fpp_etox = fp_etox;
+	fpp_twotox = fp_twotox;
+	fpp_tentox = fp_tentox;
+	fpp_logn = fp_logn;
+	fpp_log10 = fp_log10;
+	fpp_log2 = fp_log2;
+	fpp_abs = fp_abs;
+	fpp_cosh = fp_cosh;
+	fpp_neg = fp_neg;
+	fpp_acos = fp_acos;
+	fpp_cos = fp_cos;
+	fpp_sincos = fp_sincos;
+	fpp_getexp = fp_getexp;
+	fpp_getman = fp_getman;
+	fpp_div = fp_div;
+	fpp_mod = fp_mod;
+	fpp_add = fp_add;
+	fpp_mul = fp_mul;
+	fpp_rem = fp_rem;
+	fpp_scale = fp_scale;
+	fpp_sub = fp_sub;
+	fpp_sgldiv = fp_sgldiv;
+	fpp_sglmul = fp_sglmul;
+	fpp_cmp = fp_cmp;
+	fpp_tst = fp_tst;
+	fpp_move = fp_move;
+
+	return true;
+}
+
+#endif /* X87_LONG_DOUBLE */
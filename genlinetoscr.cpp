@@ -1022,7 +1022,7 @@ static bool gen_fasthead(void)
 	}
 
 	outf("static void %s(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,"
-		"int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)", funcname);
+		"int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)", funcname);
 	outf("{");
 
 	// shres on lores is useless
@@ -1180,13 +1180,86 @@ static void gen_fastdraw_mode(int off, int total)
 	}
 }
 
+// can bitplane spans use vectorized output (linetoscr_simd.h)?
+static bool gen_fastdraw_span_ok(void)
+{
+	int doubling = outres - res;
+
+	if (genlock || filtered || doubling < 0) {
+		return false;
+	}
+	if (modes != CMODE_NORMAL && modes != CMODE_DUALPF) {
+		return false;
+	}
+	// ECS shres has its own pixel decoding
+	if (res == 2 && !aga) {
+		return false;
+	}
+	return true;
+}
+
+static void gen_fastdraw_span(void)
+{
+	int doubling = outres - res;
+	const char *remap = "NULL", *remap_no = "NULL", *ofs = "0";
+
+	if (modes == CMODE_DUALPF) {
+		remap = "dpf_lookup";
+		if (aga) {
+			remap_no = "dpf_lookup_no";
+			ofs = "dblpfofs[bpldualpf2of]";
+		}
+	}
+	outf("#if LTS_SIMD");
+	outf("{");
+	outf("int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);");
+	outf("if (n >= LTS_SIMD_MIN && !lts_simd_disable) {");
+	outf("clxdat |= lts_span(cp, n, %d, spanphase, acolors, %s, %s, %s, %s, bplcoltable, buf1, %s);",
+		doubling, remap, remap_no, ofs, aga ? "bxor" : "0", isbuf2 ? "buf2" : "NULL");
+	outf("cp += n;");
+	outf("buf1 += n << %d;", doubling);
+	if (isbuf2) {
+		outf("buf2 += n << %d;", doubling);
+	}
+	outf("cnt += n * bufaddv;");
+	outf("continue;");
+	outf("}");
+	outf("}");
+	outf("#endif");
+}
+
 static void gen_fastdraw(void)
 {
 	int doubling = outres - res;
+	bool span = gen_fastdraw_span_ok();
 
 	outf("uae_u8 *cp = *cpp;");
 	outf("uae_u8 *cp2 = *cp2p;");
 
+	// output buffers and register state come from the caller's fastline_state,
+	// the same function can run in several line worker threads at once.
+	outf("uae_u32 *buf1 = fs->buf1;");
+	if (isbuf2) {
+		outf("uae_u32 *buf2 = fs->buf2;");
+	}
+	if (genlock) {
+		outf("uae_u8 *gbuf = fs->gbuf;");
+	}
+	outf("uae_u16 clxdat = 0;");
+	if (res < 2 || aga) {
+		outf("uae_u16 *bplcoltable = fs->bplcoltable;");
+	}
+	if (modes == CMODE_DUALPF) {
+		outf("int *dpf_lookup = fs->dpf_lookup;");
+		if (aga) {
+			outf("int *dpf_lookup_no = fs->dpf_lookup_no;");
+			outf("int bpldualpf2of = fs->bpldualpf2of;");
+		}
+	}
+	if (modes == CMODE_EXTRAHB && !aga) {
+		outf("uae_u8 bplehb_mask = fs->bplehb_mask;");
+	}
+
 	outf("uae_u32 *acolors = (uae_u32*)ls->linecolorstate;");
 	if (aga) {
 		outf("uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));");
@@ -1199,6 +1272,16 @@ static void gen_fastdraw(void)
 	if (genlock) {
 		outf("uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);");
 	}
+	if (span) {
+		// ECS doubling ignores subpixel offsets
+		outf("#if LTS_SIMD");
+		if (aga) {
+			outf("int spanphase = lts_span_phase(cpadds, %d);", doubling);
+		} else {
+			outf("int spanphase = 0;");
+		}
+		outf("#endif");
+	}
 
 	outf("while (cnt < draw_end) {");
 	outf("	bool bpl = false;");
@@ -1270,6 +1353,9 @@ static void gen_fastdraw(void)
 	outf("	}");
 	outf("} else {");
 	outf("bpl = true;");
+	if (span) {
+		gen_fastdraw_span();
+	}
 	if (res < 2 || aga) {
 		outf("uae_u8 c;");
 		outf("uae_u32 col;");
@@ -1294,6 +1380,14 @@ static void gen_fastdraw(void)
 
 	outf("*cpp = cp;");
 	outf("*cp2p = cp2;");
+	outf("fs->buf1 = buf1;");
+	if (isbuf2) {
+		outf("fs->buf2 = buf2;");
+	}
+	if (genlock) {
+		outf("fs->gbuf = gbuf;");
+	}
+	outf("fs->clxdat |= clxdat;");
 }
 
 static void gen_null(void)
@@ -27,6 +27,7 @@
 #include "zfile.h"
 #include "ide.h"
 #include "debug.h"
+#include "events.h"
 #include "ini.h"
 #include "rommgr.h"
 
@@ -382,6 +383,10 @@ static uae_u32 get_filesys_version(uae_u8 *fs, int size)
 	return (ver << 16) | rev;
 }
 
+static void hdf_invalidate_cache(struct hardfiledata *hfd);
+static void hdf_cache_lock(struct hardfiledata *hfd);
+static void hdf_cache_unlock(struct hardfiledata *hfd);
+
 // hardware block size is always 256 or 512
 // filesystem block size can be 256, 512 or larger
 static void create_virtual_rdb (struct hardfiledata *hfd)
@@ -390,6 +395,12 @@ static void create_virtual_rdb (struct hardfiledata *hfd)
 	int fsblocksize = hfd->ci.blocksize;
 	int hardblocksize = fsblocksize >= 512 ? 512 : 256;
 	int cyl = hfd->ci.surfaces * hfd->ci.sectors;
+
+	// all offsets move by virtual RDB size
+	hdf_flush_cache(hfd);
+	hdf_cache_lock(hfd);
+	hdf_invalidate_cache(hfd);
+	hdf_cache_unlock(hfd);
 	int cyls = (262144 + (cyl * fsblocksize) - 1) / (cyl * fsblocksize);
 	int size = cyl * cyls * fsblocksize;
 	int idx = 0;
@@ -612,21 +623,455 @@ static uae_u32 vhd_checksum (uae_u8 *p, int offset)
 static int hdf_write2(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error);
 static int hdf_read2(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error);
 
+/* Block cache between hdf_read/hdf_write and the image backends.
+ * Blocks are HDF_CACHE_BLOCKSIZE bytes, replaced in LRU order.
+ * Sequential reads load HDF_CACHE_READAHEAD blocks with one backend read.
+ * Writes stay dirty in cache until flush which writes adjacent dirty blocks
+ * with single backend write: CMD_UPDATE, SCSI SYNCHRONIZE CACHE, IDE FLUSH
+ * CACHE, close, half of cache dirty or dirty data older than HDF_CACHE_DIRTYSECS
+ * (checked by next access and once per second from hardfile_vsync()).
+ * Blocks that fail to write stay dirty and the error is returned by the flush.
+ *
+ * Each cached unit has a lock because uaehf.device and IDE requests run in
+ * their own threads while hardfile_vsync() runs in the emulation thread.
+ */
+
+#define HDF_CACHE_READAHEAD 8
+#define HDF_CACHE_DIRTYSECS 2
+#define HDF_CACHE_UNITS 32
+
+struct hdf_cache_unit
+{
+	struct hardfiledata *hfd;
+	uae_sem_t sem;
+	bool seminit;
+};
+static struct hdf_cache_unit hdf_cache_units[HDF_CACHE_UNITS];
+static uae_sem_t hdf_cache_units_sem;
+static bool hdf_cache_units_init;
+
+static void hdf_cache_lock(struct hardfiledata *hfd)
+{
+	if (hfd->bcache_unit)
+		uae_sem_wait(&hdf_cache_units[hfd->bcache_unit - 1].sem);
+}
+
+static void hdf_cache_unlock(struct hardfiledata *hfd)
+{
+	if (hfd->bcache_unit)
+		uae_sem_post(&hdf_cache_units[hfd->bcache_unit - 1].sem);
+}
+
+static bool hdf_cache_register(struct hardfiledata *hfd)
+{
+	bool ok = false;
+	if (!hdf_cache_units_init) {
+		uae_sem_init(&hdf_cache_units_sem, 0, 1);
+		hdf_cache_units_init = true;
+	}
+	uae_sem_wait(&hdf_cache_units_sem);
+	for (int i = 0; i < HDF_CACHE_UNITS; i++) {
+		struct hdf_cache_unit *u = &hdf_cache_units[i];
+		if (!u->hfd) {
+			if (!u->seminit) {
+				uae_sem_init(&u->sem, 0, 1);
+				u->seminit = true;
+			}
+			u->hfd = hfd;
+			hfd->bcache_unit = i + 1;
+			ok = true;
+			break;
+		}
+	}
+	uae_sem_post(&hdf_cache_units_sem);
+	return ok;
+}
+
+static void hdf_cache_unregister(struct hardfiledata *hfd)
+{
+	if (!hfd->bcache_unit)
+		return;
+	uae_sem_wait(&hdf_cache_units_sem);
+	hdf_cache_units[hfd->bcache_unit - 1].hfd = NULL;
+	hfd->bcache_unit = 0;
+	uae_sem_post(&hdf_cache_units_sem);
+}
+
+static void hdf_free_cache(struct hardfiledata *hfd)
+{
+	hdf_cache_unregister(hfd);
+	for (int i = 0; i < MAX_HDF_CACHE_BLOCKS; i++) {
+		struct hdf_cache *c = &hfd->bcache[i];
+		xfree(c->data);
+		c->data = NULL;
+		c->valid = false;
+		c->dirty = false;
+	}
+	hfd->bcache_blocks = 0;
+	hfd->bcache_dirty = 0;
+}
+
+static void hdf_invalidate_cache(struct hardfiledata *hfd)
+{
+	for (int i = 0; i < hfd->bcache_blocks; i++) {
+		struct hdf_cache *c = &hfd->bcache[i];
+		c->valid = false;
+		c->dirty = false;
+	}
+	hfd->bcache_dirty = 0;
+	hfd->bcache_seqnext = ~0;
+}
+
 static void hdf_init_cache(struct hardfiledata *hfd)
 {
+	hdf_free_cache(hfd);
+	hfd->bcache_hits = hfd->bcache_misses = hfd->bcache_readahead = 0;
+	hfd->bcache_writes = hfd->bcache_flushes = 0;
+	hfd->bcache_tick = 0;
+	hfd->bcache_seqnext = ~0;
+	// memory mapped image is already its own cache
+	if (hdf_mapped_target(hfd))
+		return;
+	int blocks = currprefs.hardfile_cache * 1024 / HDF_CACHE_BLOCKSIZE;
+	if (blocks > MAX_HDF_CACHE_BLOCKS)
+		blocks = MAX_HDF_CACHE_BLOCKS;
+	if (blocks < HDF_CACHE_READAHEAD * 2)
+		return;
+	if (!hdf_cache_register(hfd)) {
+		write_log(_T("HDF cache %d: too many cached units, cache disabled\n"), hfd->unitnum);
+		return;
+	}
+	for (int i = 0; i < blocks; i++) {
+		struct hdf_cache *c = &hfd->bcache[i];
+		c->data = xmalloc(uae_u8, HDF_CACHE_BLOCKSIZE);
+		c->valid = false;
+		c->dirty = false;
+		c->readcount = c->writecount = 0;
+		c->lastaccess = 0;
+	}
+	hfd->bcache_blocks = blocks;
 }
-static void hdf_flush_cache(struct hardfiledata *hdf)
+
+static void hdf_cache_stats(struct hardfiledata *hfd)
 {
+	uae_u32 total = hfd->bcache_hits + hfd->bcache_misses;
+	if (!hfd->bcache_blocks || !total)
+		return;
+	write_log(_T("HDF cache %d: %dK, %u hits %u misses (%u%%), %u readahead, %u block writes, %u flush writes\n"),
+		hfd->unitnum, hfd->bcache_blocks * HDF_CACHE_BLOCKSIZE / 1024,
+		hfd->bcache_hits, hfd->bcache_misses, (uae_u32)((uae_u64)hfd->bcache_hits * 100 / total),
+		hfd->bcache_readahead, hfd->bcache_writes, hfd->bcache_flushes);
+}
+
+static struct hdf_cache *hdf_cache_find(struct hardfiledata *hfd, uae_u64 block)
+{
+	for (int i = 0; i < hfd->bcache_blocks; i++) {
+		struct hdf_cache *c = &hfd->bcache[i];
+		if (c->valid && c->block == block)
+			return c;
+	}
+	return NULL;
+}
+
+static void hdf_cache_touch(struct hardfiledata *hfd, struct hdf_cache *c)
+{
+	c->lastaccess = ++hfd->bcache_tick;
+}
+
+// returns first write error, failed blocks stay dirty
+static uae_u32 hdf_cache_writeback(struct hardfiledata *hfd)
+{
+	struct hdf_cache *list[MAX_HDF_CACHE_BLOCKS];
+	int cnt = 0;
+	uae_u32 ret = 0;
+
+	if (!hfd->bcache_dirty)
+		return 0;
+	for (int i = 0; i < hfd->bcache_blocks; i++) {
+		struct hdf_cache *c = &hfd->bcache[i];
+		if (c->valid && c->dirty) {
+			// insertion sort by block number
+			int j = cnt++;
+			while (j > 0 && list[j - 1]->block > c->block) {
+				list[j] = list[j - 1];
+				j--;
+			}
+			list[j] = c;
+		}
+	}
+	uae_u8 *tmp = NULL;
+	for (int i = 0; i < cnt;) {
+		int n = 1;
+		while (i + n < cnt && list[i + n]->block == list[i]->block + n && list[i + n - 1]->len == HDF_CACHE_BLOCKSIZE)
+			n++;
+		uae_u64 offset = list[i]->block * HDF_CACHE_BLOCKSIZE;
+		int len = (n - 1) * HDF_CACHE_BLOCKSIZE + list[i + n - 1]->len;
+		uae_u8 *p = list[i]->data;
+		if (n > 1) {
+			if (!tmp)
+				tmp = xmalloc(uae_u8, cnt * HDF_CACHE_BLOCKSIZE);
+			for (int j = 0; j < n; j++)
+				memcpy(tmp + j * HDF_CACHE_BLOCKSIZE, list[i + j]->data, list[i + j]->len);
+			p = tmp;
+		}
+		uae_u32 error = 0;
+		hfd->bcache_flushes++;
+		if (hdf_write2(hfd, p, offset, len, &error) != len) {
+			if (!error)
+				error = 45; // HFERR_BadStatus
+			write_log(_T("HDF cache %d: flush write %llx %d failed, error %d\n"), hfd->unitnum, offset, len, error);
+			if (!ret)
+				ret = error;
+		} else {
+			for (int j = 0; j < n; j++) {
+				list[i + j]->dirty = false;
+				hfd->bcache_dirty--;
+			}
+		}
+		i += n;
+	}
+	xfree(tmp);
+	// retry failed blocks after next HDF_CACHE_DIRTYSECS
+	if (hfd->bcache_dirty)
+		hfd->bcache_dirtytime = time(NULL);
+	return ret;
+}
+
+// write dirty blocks and make sure the backend has them on disk, returns io_Error style error
+uae_u32 hdf_flush_cache(struct hardfiledata *hfd)
+{
+	hdf_cache_lock(hfd);
+	uae_u32 error = hdf_cache_writeback(hfd);
+	hdf_cache_unlock(hfd);
+	hdf_flush_target(hfd);
+	return error;
+}
+
+static struct hdf_cache *hdf_cache_victim(struct hardfiledata *hfd)
+{
+	struct hdf_cache *v = NULL;
+	for (int pass = 0; pass < 2; pass++) {
+		for (int i = 0; i < hfd->bcache_blocks; i++) {
+			struct hdf_cache *c = &hfd->bcache[i];
+			if (!c->valid)
+				return c;
+			if (c->dirty)
+				continue;
+			if (!v || (uae_s32)(c->lastaccess - v->lastaccess) < 0)
+				v = c;
+		}
+		if (v)
+			break;
+		hdf_cache_writeback(hfd);
+	}
+	// everything dirty and write back failed
+	if (!v)
+		return NULL;
+	v->valid = false;
+	return v;
+}
+
+// load count blocks starting from block, already cached blocks are kept
+static bool hdf_cache_load(struct hardfiledata *hfd, uae_u64 block, int count, uae_u32 *error)
+{
+	uae_u64 offset = block * HDF_CACHE_BLOCKSIZE;
+	if (offset >= hfd->virtsize)
+		return false;
+	uae_u64 len = (uae_u64)count * HDF_CACHE_BLOCKSIZE;
+	if (offset + len > hfd->virtsize)
+		len = hfd->virtsize - offset;
+	uae_u8 *tmp = xmalloc(uae_u8, (int)len);
+	if (hdf_read2(hfd, tmp, offset, (int)len, error) != (int)len) {
+		xfree(tmp);
+		return false;
+	}
+	for (int i = 0; i < count && (uae_u64)i * HDF_CACHE_BLOCKSIZE < len; i++) {
+		if (hdf_cache_find(hfd, block + i))
+			continue;
+		struct hdf_cache *c = hdf_cache_victim(hfd);
+		if (!c) {
+			xfree(tmp);
+			return false;
+		}
+		int blen = (int)(len - (uae_u64)i * HDF_CACHE_BLOCKSIZE);
+		if (blen > HDF_CACHE_BLOCKSIZE)
+			blen = HDF_CACHE_BLOCKSIZE;
+		memcpy(c->data, tmp + i * HDF_CACHE_BLOCKSIZE, blen);
+		c->block = block + i;
+		c->len = blen;
+		c->valid = true;
+		c->dirty = false;
+		c->readcount = c->writecount = 0;
+		hdf_cache_touch(hfd, c);
+		if (i > 0)
+			hfd->bcache_readahead++;
+	}
+	xfree(tmp);
+	return true;
+}
+
+// unaligned or large requests go directly to backend
+static bool hdf_cache_bypass(struct hardfiledata *hfd, uae_u64 offset, int len)
+{
+	if (!hfd->bcache_blocks)
+		return true;
+	if ((offset | len) & 511)
+		return true;
+	if (len > hfd->bcache_blocks * HDF_CACHE_BLOCKSIZE / 4)
+		return true;
+	return false;
+}
+
+static void hdf_cache_age(struct hardfiledata *hfd)
+{
+	if (hfd->bcache_dirty && (hfd->bcache_dirty >= hfd->bcache_blocks / 2 || time(NULL) - hfd->bcache_dirtytime >= HDF_CACHE_DIRTYSECS))
+		hdf_cache_writeback(hfd);
+}
+
+// write back old dirty data of idle units
+void hardfile_vsync(void)
+{
+	static int cnt;
+
+	if (!hdf_cache_units_init)
+		return;
+	if (++cnt < 50)
+		return;
+	cnt = 0;
+	// busy units are checked again next time
+	if (uae_sem_trywait(&hdf_cache_units_sem))
+		return;
+	for (int i = 0; i < HDF_CACHE_UNITS; i++) {
+		struct hdf_cache_unit *u = &hdf_cache_units[i];
+		if (!u->hfd || !u->hfd->bcache_dirty)
+			continue;
+		if (!uae_sem_trywait(&u->sem)) {
+			hdf_cache_age(u->hfd);
+			uae_sem_post(&u->sem);
+		}
+	}
+	uae_sem_post(&hdf_cache_units_sem);
 }
 
 static int hdf_cache_read(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error)
 {
-	return hdf_read2(hfd, buffer, offset, len, error);
+	if (hdf_cache_bypass(hfd, offset, len)) {
+		hdf_cache_writeback(hfd);
+		return hdf_read2(hfd, buffer, offset, len, error);
+	}
+	hdf_cache_age(hfd);
+
+	bool seq = offset == hfd->bcache_seqnext;
+	hfd->bcache_seqnext = offset + len;
+	uae_u8 *p = (uae_u8*)buffer;
+	uae_u64 o = offset;
+	int left = len;
+	while (left > 0) {
+		uae_u64 block = o / HDF_CACHE_BLOCKSIZE;
+		int bofs = (int)(o % HDF_CACHE_BLOCKSIZE);
+		int n = HDF_CACHE_BLOCKSIZE - bofs;
+		if (n > left)
+			n = left;
+		struct hdf_cache *c = hdf_cache_find(hfd, block);
+		if (c) {
+			hfd->bcache_hits++;
+		} else {
+			hfd->bcache_misses++;
+			int count = (bofs + left + HDF_CACHE_BLOCKSIZE - 1) / HDF_CACHE_BLOCKSIZE;
+			if (seq && count < HDF_CACHE_READAHEAD)
+				count = HDF_CACHE_READAHEAD;
+			if (!hdf_cache_load(hfd, block, count, error))
+				break;
+			c = hdf_cache_find(hfd, block);
+		}
+		if (bofs + n > c->len)
+			break;
+		memcpy(p, c->data + bofs, n);
+		c->readcount++;
+		hdf_cache_touch(hfd, c);
+		p += n;
+		o += n;
+		left -= n;
+	}
+	if (left > 0) {
+		// end of image or read error: let backend handle and report it
+		hdf_cache_writeback(hfd);
+		*error = 0;
+		return hdf_read2(hfd, buffer, offset, len, error);
+	}
+	return len;
 }
 
 static int hdf_cache_write(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error)
 {
-	return hdf_write2(hfd, buffer, offset, len, error);
+	// read only and unsafe drives must return error immediately
+	if (hdf_cache_bypass(hfd, offset, len) || hfd->ci.readonly || hfd->dangerous) {
+		if (hfd->bcache_blocks) {
+			hdf_cache_writeback(hfd);
+			for (uae_u64 b = offset / HDF_CACHE_BLOCKSIZE; b * HDF_CACHE_BLOCKSIZE < offset + len; b++) {
+				struct hdf_cache *c = hdf_cache_find(hfd, b);
+				if (c) {
+					// failed write back data is overwritten anyway
+					if (c->dirty) {
+						c->dirty = false;
+						hfd->bcache_dirty--;
+					}
+					c->valid = false;
+				}
+			}
+		}
+		return hdf_write2(hfd, buffer, offset, len, error);
+	}
+
+	uae_u8 *p = (uae_u8*)buffer;
+	uae_u64 o = offset;
+	int left = len;
+	while (left > 0) {
+		uae_u64 block = o / HDF_CACHE_BLOCKSIZE;
+		int bofs = (int)(o % HDF_CACHE_BLOCKSIZE);
+		int n = HDF_CACHE_BLOCKSIZE - bofs;
+		if (n > left)
+			n = left;
+		struct hdf_cache *c = hdf_cache_find(hfd, block);
+		if (!c) {
+			if (n == HDF_CACHE_BLOCKSIZE && (block + 1) * HDF_CACHE_BLOCKSIZE <= hfd->virtsize) {
+				// whole block overwritten, no need to read it first
+				c = hdf_cache_victim(hfd);
+				if (!c)
+					break;
+				c->block = block;
+				c->len = HDF_CACHE_BLOCKSIZE;
+				c->valid = true;
+				c->dirty = false;
+				c->readcount = c->writecount = 0;
+			} else if (hdf_cache_load(hfd, block, 1, error)) {
+				c = hdf_cache_find(hfd, block);
+			}
+			if (!c || bofs + n > c->len)
+				break;
+		}
+		memcpy(c->data + bofs, p, n);
+		if (!c->dirty) {
+			if (!hfd->bcache_dirty)
+				hfd->bcache_dirtytime = time(NULL);
+			c->dirty = true;
+			hfd->bcache_dirty++;
+		}
+		c->writecount++;
+		hfd->bcache_writes++;
+		hdf_cache_touch(hfd, c);
+		p += n;
+		o += n;
+		left -= n;
+	}
+	if (left > 0) {
+		// already cached part is also written directly, keep backend errors visible
+		hdf_cache_writeback(hfd);
+		*error = 0;
+		return hdf_write2(hfd, buffer, offset, len, error);
+	}
+	hdf_cache_age(hfd);
+	return len;
 }
 
 int hdf_open (struct hardfiledata *hfd, const TCHAR *pname)
@@ -750,6 +1195,7 @@ int hdf_open (struct hardfiledata *hfd, const TCHAR *pname)
 	return 1;
 nonvhd:
 	hfd->hfd_type = 0;
+	hdf_init_cache (hfd);
 	return 1;
 end:
 	hdf_close_target (hfd);
@@ -768,6 +1214,8 @@ int hdf_open (struct hardfiledata *hfd)
 void hdf_close (struct hardfiledata *hfd)
 {
 	hdf_flush_cache (hfd);
+	hdf_cache_stats (hfd);
+	hdf_free_cache (hfd);
 	hdf_close_target (hfd);
 #ifdef WITH_CHD
 	if (hfd->hfd_type == HFD_CHD_OTHER) {
@@ -1275,6 +1723,7 @@ int hdf_read(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, ua
 	hf_log3(_T("cmd_read: %p %04x-%08x (%d) %08x (%d)\n"),
 		buffer, (uae_u32)(offset >> 32), (uae_u32)offset, (uae_u32)(offset / hfd->ci.blocksize), (uae_u32)len, (uae_u32)(len / hfd->ci.blocksize));
 
+	hdf_cache_lock(hfd);
 	if (!hfd->adide) {
 		v = hdf_cache_read(hfd, buffer, offset, len, error);
 	} else {
@@ -1282,11 +1731,79 @@ int hdf_read(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, ua
 		v = hdf_cache_read(hfd, buffer, offset, len, error);
 		adide_decode(buffer, len);
 	}
+	hdf_cache_unlock(hfd);
 	if (hfd->byteswap)
 		hdf_byteswap(buffer, len);
 	return v;
 }
 
+// sequential hdf_read_target() throughput, direct to destination or
+// through 16K bounce buffer from the file handle (bypassing the mapping)
+static double hardfile_benchmark_read(struct hardfiledata *hfd, uae_u8 *dst, uae_u8 *bounce, int size, uae_u64 total, bool direct, uae_u32 *error)
+{
+	uae_u64 span = hfd->virtsize / size * size;
+	uae_u64 offset = 0;
+	hdf_map_bypass_target(hfd, !direct);
+	frame_time_t t1 = read_processor_time();
+	for (uae_u64 done = 0; done < total; done += size) {
+		if (direct) {
+			if (hdf_read_target(hfd, dst, offset, size, error) != size)
+				return -1;
+		} else {
+			for (int i = 0; i < size; i += 16384) {
+				if (hdf_read_target(hfd, bounce, offset + i, 16384, error) != 16384) {
+					hdf_map_bypass_target(hfd, false);
+					return -1;
+				}
+				memcpy(dst + i, bounce, 16384);
+			}
+		}
+		offset += size;
+		if (offset >= span)
+			offset = 0;
+	}
+	frame_time_t t2 = read_processor_time();
+	hdf_map_bypass_target(hfd, false);
+	double secs = (double)(t2 - t1) / syncbase;
+	return secs > 0 ? (double)total / secs / (1024 * 1024) : 0;
+}
+
+void hardfile_benchmark(int unit, int mb)
+{
+	struct hardfiledata *hfd = get_hardfile_data(unit);
+	const int maxsize = 1024 * 1024;
+
+	if (!hfd || hfd->drive_empty || hfd->virtsize < maxsize) {
+		console_out_f(_T("Hardfile unit %d not available or smaller than 1M.\n"), unit);
+		return;
+	}
+	if (mb <= 0)
+		mb = 256;
+	uae_u64 total = (uae_u64)mb * 1024 * 1024;
+	uae_u8 *dst = xmalloc(uae_u8, maxsize);
+	uae_u8 *bounce = xmalloc(uae_u8, 16384);
+	uae_u32 error = 0;
+
+	console_out_f(_T("Unit %d: %lluM image, %s, %dM per test\n"), unit, hfd->virtsize >> 20,
+		hdf_mapped_target(hfd) ? _T("memory mapped") : _T("file"), mb);
+	hdf_cache_lock(hfd);
+	// first pass brings image to OS cache
+	hardfile_benchmark_read(hfd, dst, bounce, maxsize, total, true, &error);
+	console_out(_T("Size  16K bounce MB/s  Direct MB/s\n"));
+	for (int size = 65536; size <= maxsize; size *= 2) {
+		double b = hardfile_benchmark_read(hfd, dst, bounce, size, total, false, &error);
+		double d = hardfile_benchmark_read(hfd, dst, bounce, size, total, true, &error);
+		if (b < 0 || d < 0) {
+			console_out_f(_T("Read error %d.\n"), error);
+			break;
+		}
+		console_out_f(_T("%4dK %16.0f %12.0f\n"), size / 1024, b, d);
+	}
+	hdf_cache_unlock(hfd);
+	xfree(bounce);
+	xfree(dst);
+}
+
 int hdf_write(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error)
 {
 	int v;
@@ -1304,6 +1821,7 @@ int hdf_write(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, u
 
 	if (hfd->byteswap)
 		hdf_byteswap(buffer, len);
+	hdf_cache_lock(hfd);
 	if (!hfd->adide) {
 		v = hdf_cache_write(hfd, buffer, offset, len, error);
 	} else {
@@ -1312,6 +1830,7 @@ int hdf_write(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, u
 		v = hdf_cache_write(hfd, buffer, offset, len, error);
 		adide_decode(buffer, len);
 	}
+	hdf_cache_unlock(hfd);
 	if (hfd->byteswap)
 		hdf_byteswap(buffer, len);
 	return v;
@@ -2139,6 +2658,10 @@ int scsi_hd_emulate (struct hardfiledata *hfd, struct hd_hardfiledata *hdhfd, ua
 		if (nodisk (hfd))
 			goto nodisk;
 		scsi_len = 0;
+		if (hdf_flush_cache (hfd)) {
+			chkerr = 2;
+			goto checkfail;
+		}
 		break;
 	case 0xa8: /* READ (12) */
 		if (nodisk (hfd))
@@ -2857,8 +3380,11 @@ static uae_u32 hardfile_do_io (TrapContext *ctx, struct hardfiledata *hfd, struc
 		actual = hfd->drive_empty ? 1 :0;
 		break;
 
-		/* Some commands that just do nothing and return zero */
 	case CMD_UPDATE:
+		error = hdf_flush_cache (hfd);
+		break;
+
+		/* Some commands that just do nothing and return zero */
 	case CMD_CLEAR:
 	case CMD_MOTOR:
 	case CMD_SEEK:
@@ -1244,7 +1244,10 @@ static void ide_do_command (struct ide_hdf *ide, uae_u8 cmd)
 			if (ide->ata_level < 0) {
 				ide_fail(ide);
 			} else {
-				ide_interrupt(ide);
+				if (hdf_flush_cache(&ide->hdhfd.hfd))
+					ide_fail_err(ide, IDE_ERR_ABRT);
+				else
+					ide_interrupt(ide);
 			}
 		} else if (cmd == 0xe5) { /* check power mode */
 			ide->regs.ide_nsector = 0xff;
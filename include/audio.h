@@ -40,6 +40,7 @@ int audio_activate (void);
 void audio_deactivate (void);
 void audio_vsync (void);
 void audio_sampleripper(int);
+void audio_benchmark(int rounds);
 void write_wavheader (struct zfile *wavfile, size_t size, uae_u32 freq);
 
 int audio_is_pull(void);
@@ -52,6 +52,7 @@ extern void blitter_check_start(void);
 extern void blitter_reset(void);
 extern void blitter_debugdump(void);
 extern void restore_blitter_start(void);
+extern void blitter_benchmark(int rounds);
 
 void blitter_loadbdat(uae_u16 v);
 void blitter_loadcdat(uae_u16 v);
@@ -67,4 +68,10 @@ extern blitter_func *const blitfunc_dofast[256];
 extern blitter_func *const blitfunc_dofast_desc[256];
 extern uae_u32 blit_masktable[BLITTER_MAX_WORDS];
 
+struct bltfill {
+	const uae_u8 (*table)[4][2];
+	int ifemode, fc;
+};
+extern bool blitter_generic(uaecptr, uaecptr, uaecptr, uaecptr, struct bltinfo *, struct bltfill *, bool desc);
+
 #endif /* UAE_BLITTER_H */
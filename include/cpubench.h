@@ -0,0 +1,11 @@
+#ifndef UAE_CPUBENCH_H
+#define UAE_CPUBENCH_H
+
+#include "uae/types.h"
+
+extern TCHAR *cpubench_file;
+extern uae_s64 cpubench_instructions;
+
+extern bool cpubench_run(void);
+
+#endif /* UAE_CPUBENCH_H */
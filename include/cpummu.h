@@ -237,21 +237,31 @@ extern void mmu_put_move16(uaecptr addr, uae_u32 *val, bool data, int size);
 extern uaecptr debug_mmu_translate(uaecptr addr, uae_u32 val, bool super, bool data, bool write, int size, struct mmu_debug_data **mdd);
 extern void debug_mmu_translate_end(void);
 
-#if MMU_IPAGECACHE
-extern uae_u32 atc_last_ins_laddr, atc_last_ins_paddr;
-extern uae_u8 atc_last_ins_cache;
-#endif
-
-#if MMU_DPAGECACHE
-#define MMUFASTCACHE_ENTRIES 256
+#if MMU_IPAGECACHE || MMU_DPAGECACHE
+/*
+ * Software TLB in front of the ATC, 2-way set associative. Entries are
+ * tagged with page, S bit and generation: flushing everything only bumps
+ * mmu_fastcache_gen. Entries are dropped when the ATC line they came from
+ * is flushed or replaced, so this never holds more than the ATC.
+ */
+#define MMUFASTCACHE_SETS 512
+#define MMUFASTCACHE_WAYS 2
 struct mmufastcache
 {
 	uae_u32 log;
+	uae_u32 gen;
 	uae_u32 phys;
 	uae_u8 cache_state;
 };
-extern struct mmufastcache atc_data_cache_read[MMUFASTCACHE_ENTRIES];
-extern struct mmufastcache atc_data_cache_write[MMUFASTCACHE_ENTRIES];
+extern uae_u32 mmu_fastcache_gen;
+extern int mmu_fastcache_flush_all, mmu_fastcache_flush_page;
+#endif
+#if MMU_IPAGECACHE
+extern struct mmufastcache atc_ins_cache[MMUFASTCACHE_SETS][MMUFASTCACHE_WAYS];
+#endif
+#if MMU_DPAGECACHE
+extern struct mmufastcache atc_data_cache_read[MMUFASTCACHE_SETS][MMUFASTCACHE_WAYS];
+extern struct mmufastcache atc_data_cache_write[MMUFASTCACHE_SETS][MMUFASTCACHE_WAYS];
 #endif
 
 #if CACHE_HIT_COUNT
@@ -260,17 +270,31 @@ extern int mmu_data_read_hit, mmu_data_read_miss;
 extern int mmu_data_write_hit, mmu_data_write_miss;
 #endif
 
+#if MMU_IPAGECACHE || MMU_DPAGECACHE
+static ALWAYS_INLINE bool mmu_fastcache_lookup(struct mmufastcache (*c)[MMUFASTCACHE_WAYS], uaecptr *addr, uae_u32 super)
+{
+	uae_u32 idx1 = ((*addr & mmu_pagemaski) >> mmu_pageshift1m) | super;
+	struct mmufastcache *e = c[idx1 & (MMUFASTCACHE_SETS - 1)];
+	for (int i = 0; i < MMUFASTCACHE_WAYS; i++, e++) {
+		if (e->log == idx1 && e->gen == mmu_fastcache_gen) {
+			*addr = e->phys | (*addr & mmu_pagemask);
+			mmu_cache_state = e->cache_state;
+			return true;
+		}
+	}
+	return false;
+}
+#endif
+
 static ALWAYS_INLINE uae_u32 mmu_get_ilong(uaecptr addr, int size)
 {
 	mmu_cache_state = cache_default_ins;
 	if ((!mmu_ttr_enabled_ins || mmu_match_ttr_ins(addr,regs.s!=0) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_IPAGECACHE
-		if (((addr & mmu_pagemaski) | regs.s) == atc_last_ins_laddr) {
+		if (mmu_fastcache_lookup(atc_ins_cache, &addr, regs.s)) {
 #if CACHE_HIT_COUNT
 			mmu_ins_hit++;
 #endif
-			addr = atc_last_ins_paddr | (addr & mmu_pagemask);
-			mmu_cache_state = atc_last_ins_cache;
 		} else {
 #if CACHE_HIT_COUNT
 			mmu_ins_miss++;
@@ -289,12 +313,10 @@ static ALWAYS_INLINE uae_u16 mmu_get_iword(uaecptr addr, int size)
 	mmu_cache_state = cache_default_ins;
 	if ((!mmu_ttr_enabled_ins || mmu_match_ttr_ins(addr,regs.s!=0) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_IPAGECACHE
-		if (((addr & mmu_pagemaski) | regs.s) == atc_last_ins_laddr) {
+		if (mmu_fastcache_lookup(atc_ins_cache, &addr, regs.s)) {
 #if CACHE_HIT_COUNT
 			mmu_ins_hit++;
 #endif
-			addr = atc_last_ins_paddr | (addr & mmu_pagemask);
-			mmu_cache_state = atc_last_ins_cache;
 		} else {
 #if CACHE_HIT_COUNT
 			mmu_ins_miss++;
@@ -314,11 +336,7 @@ static ALWAYS_INLINE uae_u32 mmu_get_long(uaecptr addr, bool data, int size)
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr(addr,regs.s!=0,data) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | regs.s;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_read[idx2].log == idx1) {
-			addr = atc_data_cache_read[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_read, &addr, regs.s)) {
 #if CACHE_HIT_COUNT
 			mmu_data_read_hit++;
 #endif
@@ -340,11 +358,7 @@ static ALWAYS_INLINE uae_u16 mmu_get_word(uaecptr addr, bool data, int size)
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr(addr,regs.s!=0,data) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | regs.s;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_read[idx2].log == idx1) {
-			addr = atc_data_cache_read[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_read, &addr, regs.s)) {
 #if CACHE_HIT_COUNT
 			mmu_data_read_hit++;
 #endif
@@ -366,11 +380,7 @@ static ALWAYS_INLINE uae_u8 mmu_get_byte(uaecptr addr, bool data, int size)
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr(addr,regs.s!=0,data) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | regs.s;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_read[idx2].log == idx1) {
-			addr = atc_data_cache_read[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_read, &addr, regs.s)) {
 #if CACHE_HIT_COUNT
 			mmu_data_read_hit++;
 #endif
@@ -392,11 +402,7 @@ static ALWAYS_INLINE void mmu_put_long(uaecptr addr, uae_u32 val, bool data, int
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr_write(addr,regs.s!=0,data,val,size) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | regs.s;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_write[idx2].log == idx1) {
-			addr = atc_data_cache_write[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_write, &addr, regs.s)) {
 #if CACHE_HIT_COUNT
 			mmu_data_write_hit++;
 #endif
@@ -418,11 +424,7 @@ static ALWAYS_INLINE void mmu_put_word(uaecptr addr, uae_u16 val, bool data, int
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr_write(addr,regs.s!=0,data,val,size) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | regs.s;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_write[idx2].log == idx1) {
-			addr = atc_data_cache_write[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_write, &addr, regs.s)) {
 #if CACHE_HIT_COUNT
 			mmu_data_write_hit++;
 #endif
@@ -444,11 +446,7 @@ static ALWAYS_INLINE void mmu_put_byte(uaecptr addr, uae_u8 val, bool data, int
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr_write(addr,regs.s!=0,data,val,size) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | regs.s;
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_write[idx2].log == idx1) {
-			addr = atc_data_cache_write[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_write, &addr, regs.s)) {
 #if CACHE_HIT_COUNT
 			mmu_data_write_hit++;
 #endif
@@ -470,11 +468,7 @@ static ALWAYS_INLINE uae_u32 mmu_get_user_long(uaecptr addr, bool super, bool wr
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr_maybe_write(addr,super,true,size,write) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_read[idx2].log == idx1) {
-			addr = atc_data_cache_read[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_read, &addr, super ? 1 : 0)) {
 #if CACHE_HIT_COUNT
 			mmu_data_read_hit++;
 #endif
@@ -498,11 +492,7 @@ static ALWAYS_INLINE uae_u16 mmu_get_user_word(uaecptr addr, bool super, bool wr
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr_maybe_write(addr,super,true,size,write) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_read[idx2].log == idx1) {
-			addr = atc_data_cache_read[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_read, &addr, super ? 1 : 0)) {
 #if CACHE_HIT_COUNT
 			mmu_data_read_hit++;
 #endif
@@ -526,11 +516,7 @@ static ALWAYS_INLINE uae_u8 mmu_get_user_byte(uaecptr addr, bool super, bool wri
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr_maybe_write(addr,super,true,size,write) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_read[idx2].log == idx1) {
-			addr = atc_data_cache_read[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_read, &addr, super ? 1 : 0)) {
 #if CACHE_HIT_COUNT
 			mmu_data_read_hit++;
 #endif
@@ -554,11 +540,7 @@ static ALWAYS_INLINE void mmu_put_user_long(uaecptr addr, uae_u32 val, bool supe
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr_write(addr,super,true,val,size) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_write[idx2].log == idx1) {
-			addr = atc_data_cache_write[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_write, &addr, super ? 1 : 0)) {
 #if CACHE_HIT_COUNT
 			mmu_data_write_hit++;
 #endif
@@ -582,11 +564,7 @@ static ALWAYS_INLINE void mmu_put_user_word(uaecptr addr, uae_u16 val, bool supe
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr_write(addr,super,true,val,size) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_write[idx2].log == idx1) {
-			addr = atc_data_cache_write[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_write, &addr, super ? 1 : 0)) {
 #if CACHE_HIT_COUNT
 			mmu_data_write_hit++;
 #endif
@@ -610,11 +588,7 @@ static ALWAYS_INLINE void mmu_put_user_byte(uaecptr addr, uae_u8 val, bool super
 	mmu_cache_state = cache_default_data;
 	if ((!mmu_ttr_enabled || mmu_match_ttr_write(addr,super,true,val,size) == TTR_NO_MATCH) && regs.mmu_enabled) {
 #if MMU_DPAGECACHE
-		uae_u32 idx1 = ((addr & mmu_pagemaski) >> mmu_pageshift1m) | (super ? 1 : 0);
-		uae_u32 idx2 = idx1 & (MMUFASTCACHE_ENTRIES - 1);
-		if (atc_data_cache_write[idx2].log == idx1) {
-			addr = atc_data_cache_write[idx2].phys | (addr & mmu_pagemask);
-			mmu_cache_state = atc_data_cache_read[idx2].cache_state;
+		if (mmu_fastcache_lookup(atc_data_cache_write, &addr, super ? 1 : 0)) {
 #if CACHE_HIT_COUNT
 			mmu_data_write_hit++;
 #endif
@@ -9,6 +9,8 @@
 
 #define MMU_DPAGECACHE030 1
 #define MMU_IPAGECACHE030 1
+/* Verify every data shortcut cache hit against TTx/ATC, log mismatches */
+#define MMU030_FASTCACHE_CHECK 0
 
 extern uae_u64 srp_030, crp_030;
 extern uae_u32 tt0_030, tt1_030, tc_030;
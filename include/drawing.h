@@ -115,6 +115,8 @@ extern void vsync_handle_redraw(int long_field, uae_u16, uae_u16, bool drawlines
 extern bool vsync_handle_check(void);
 extern void reset_drawing(void);
 extern void drawing_init(void);
+extern void drawing_free(void);
+extern void linetoscr_simd_benchmark(int rounds);
 extern bool frame_drawn(int monid);
 extern void redraw_frame(void);
 extern void full_redraw_all(void);
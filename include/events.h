@@ -62,7 +62,10 @@ struct ev2
 	evt_t evtime;
 	uae_u32 data;
 	evfunc2 handler;
-	ev2 *next;
+	uae_u32 seq;
+	int heapidx;
+	int hidx;
+	int hnext, hprev;
 };
 
 // hsync handlers must have priority over misc
@@ -76,7 +79,7 @@ enum {
 
 enum {
 	ev2_blitter, ev2_misc,
-	ev2_max = 16
+	ev2_initial = 16
 };
 
 extern int pissoff_value;
@@ -89,7 +92,8 @@ extern int do_cycles_cck(int);
 #define do_cycles do_cycles_slow
 
 extern struct ev eventtab[ev_max];
-extern struct ev2 eventtab2[ev2_max];
+extern struct ev2 *eventtab2;
+extern int ev2_max;
 
 extern int maxhpos;
 extern int custom_fastmode;
@@ -157,6 +161,8 @@ extern void event2_newevent_x_add_not_exists(evt_t t, uae_u32 data, evfunc2 func
 extern void event2_newevent_x_remove(evfunc2 func);
 extern void event2_newevent_xx_ce(evt_t t, uae_u32 data, evfunc2 func);
 bool event2_newevent_x_exists(evfunc2 func);
+extern void event2_remevent(int no);
+extern void events_dump_stats(void);
 
 STATIC_INLINE void event2_newevent_x(int no, evt_t t, uae_u32 data, evfunc2 func)
 {
@@ -176,11 +182,6 @@ STATIC_INLINE void event2_newevent2(evt_t t, uae_u32 data, evfunc2 func)
 	event2_newevent_x(-1, t, data, func);
 }
 
-STATIC_INLINE void event2_remevent(int no)
-{
-	eventtab2[no].active = 0;
-}
-
 void event_audxdat_func(uae_u32);
 void event_setdsr(uae_u32);
 void event_CIA_synced_interrupt(uae_u32);
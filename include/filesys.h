@@ -14,17 +14,19 @@
 
 struct hardfilehandle;
 
-#define MAX_HDF_CACHE_BLOCKS 128
+#define MAX_HDF_CACHE_BLOCKS 256
+#define HDF_CACHE_BLOCKSIZE 4096
 #define MAX_SCSI_SENSE 36
 struct hdf_cache
 {
 	bool valid;
 	uae_u8 *data;
 	uae_u64 block;
+	int len;
 	bool dirty;
 	int readcount;
 	int writecount;
-	time_t lastaccess;
+	uae_u32 lastaccess;
 };
 
 struct hardfiledata {
@@ -68,6 +70,13 @@ struct hardfiledata {
     TCHAR *emptyname;
 
 	struct hdf_cache bcache[MAX_HDF_CACHE_BLOCKS];
+	int bcache_blocks;
+	int bcache_dirty;
+	time_t bcache_dirtytime;
+	int bcache_unit; // lock slot + 1, 0 = no cache
+	uae_u64 bcache_seqnext;
+	uae_u32 bcache_tick;
+	uae_u32 bcache_hits, bcache_misses, bcache_readahead, bcache_writes, bcache_flushes;
 	uae_u8 scsi_sense[MAX_SCSI_SENSE];
 	uae_u8 sector_buffer[512];
 	uae_u8 identity[512];
@@ -133,6 +142,9 @@ extern void hdf_close (struct hardfiledata *hfd);
 extern int hdf_read_rdb (struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error);
 extern int hdf_read(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error);
 extern int hdf_write(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error);
+extern uae_u32 hdf_flush_cache(struct hardfiledata *hfd);
+extern void hardfile_vsync(void);
+extern void hardfile_benchmark(int unit, int mb);
 extern int hdf_getnumharddrives (void);
 extern TCHAR *hdf_getnameharddrive (int index, int flags, int *sectorsize, int *dangerousdrive, uae_u32 *outflags);
 extern int get_native_path(TrapContext *ctx, uae_u32 lock, TCHAR *out);
@@ -153,6 +165,9 @@ extern void hdf_close_target (struct hardfiledata *hfd);
 extern int hdf_read_target (struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error);
 extern int hdf_write_target (struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error);
 extern int hdf_resize_target (struct hardfiledata *hfd, uae_u64 newsize);
+extern bool hdf_mapped_target (struct hardfiledata *hfd);
+extern void hdf_map_bypass_target (struct hardfiledata *hfd, bool bypass);
+extern void hdf_flush_target (struct hardfiledata *hfd);
 
 extern void getchsgeometry (uae_u64 size, int *pcyl, int *phead, int *psectorspertrack);
 extern void getchsgeometry_hdf (struct hardfiledata *hfd, uae_u64 size, int *pcyl, int *phead, int *psectorspertrack);
@@ -17,7 +17,7 @@
 #define FPSR_INEX1      0x00000100
 
 extern void fp_init_native(void);
-#ifdef MSVC_LONG_DOUBLE
+#if defined(MSVC_LONG_DOUBLE) || defined(X87_LONG_DOUBLE)
 extern bool fp_init_native_80(void);
 #endif
 extern void fp_init_softfloat(int);
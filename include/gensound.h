@@ -30,4 +30,31 @@ extern void sample16s_handler (void);
 extern void sample16ss_handler (void);
 extern void sample8s_handler (void);
 
+/* Single producer, single consumer lock-free ring buffer (sndring.cpp).
+ * Sizes are in frames, framesize is bytes per frame. sound_ring_read()
+ * fills missing frames with silence and counts an underrun.
+ * sound_ring_skip() discards all buffered frames from the consumer side,
+ * sound_ring_reset() may only be used while the consumer is not running.
+ * sound_ring_adjust() is called by the producer after each write and
+ * returns a sound_setadjust() value that keeps the fill level at the
+ * adaptive latency target. */
+struct sound_ring;
+extern struct sound_ring *sound_ring_alloc(int frames, int framesize);
+extern void sound_ring_free(struct sound_ring*);
+extern void sound_ring_reset(struct sound_ring*);
+extern void sound_ring_clear(struct sound_ring*);
+extern int sound_ring_size(struct sound_ring*);
+extern int sound_ring_avail(struct sound_ring*);
+extern int sound_ring_write(struct sound_ring*, const void *data, int frames);
+extern int sound_ring_read(struct sound_ring*, void *data, int frames);
+extern int sound_ring_skip(struct sound_ring*);
+extern float sound_ring_adjust(struct sound_ring*, int *fillpermille);
+extern void sound_ring_stats(struct sound_ring*, int *target, uae_u32 *underruns, uae_u32 *overruns);
+
+/* Null/file sound sink (-soundsink[=file.wav]). Returned ring is drained at
+ * real time rate, empty path discards samples, otherwise 16-bit WAV is written. */
+extern TCHAR *sound_sink_path;
+extern struct sound_ring *sound_sink_open(const TCHAR *path, int freq, int channels, int bufframes);
+extern void sound_sink_close(void);
+
 #endif /* UAE_GENSOUND_H */
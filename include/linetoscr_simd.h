@@ -0,0 +1,350 @@
+/*
+* UAE - The Un*x Amiga Emulator
+*
+* Vectorized bitplane span output for the generated fast linetoscr functions.
+*
+* A span is a run of fast linetoscr loop iterations that are all inside
+* the bitplane area (no blanking or DIW edges). Only non-HAM, non-genlock
+* modes with pixel doubling or 1:1 output are handled, everything else
+* uses the generated scalar code.
+*
+* Chunks that only use colors 0-15 are looked up with byte shuffles from
+* a pre-split 16 entry palette when SSSE3 is available at compile time.
+* Other chunks use AVX2 gather or, with SSE2/NEON only, scalar palette
+* loads and vector stores.
+*/
+
+#ifndef UAE_LINETOSCR_SIMD_H
+#define UAE_LINETOSCR_SIMD_H
+
+#if defined(__AVX2__)
+#define LTS_SIMD_AVX2 1
+#define LTS_SIMD_PSHUFB 1
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LTS_SIMD_SSE2 1
+#include <emmintrin.h>
+#if defined(__SSSE3__) || defined(__AVX__)
+#define LTS_SIMD_PSHUFB 1
+#include <tmmintrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define LTS_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(LTS_SIMD_AVX2) || defined(LTS_SIMD_SSE2) || defined(LTS_SIMD_NEON)
+#define LTS_SIMD 1
+#else
+#define LTS_SIMD 0
+#endif
+
+// compare each span against scalar output and log mismatches
+#define LTS_SIMD_CHECK 0
+
+// shorter spans are left to the scalar loop
+#define LTS_SIMD_MIN 16
+
+#define LTS_SIMD_CHUNK 64
+
+#if LTS_SIMD
+
+// scalar loop only, set by linetoscr_simd_benchmark()
+static bool lts_simd_disable;
+
+// Palette index of source pixels, same as generated gen_fastdraw_drawmode code.
+// remap: dual playfield lookup (optional), remap_no: second playfield flag (AGA only).
+// Returns all indexes ORed together.
+STATIC_INLINE uae_u8 lts_span_index(uae_u8 *dst, const uae_u8 *cp, int cnt, const int *remap, const int *remap_no, int ofs, uae_u8 bxor)
+{
+	uae_u8 any = 0;
+	int i = 0;
+	if (!remap) {
+#if defined(LTS_SIMD_AVX2) || defined(LTS_SIMD_SSE2)
+		const __m128i x = _mm_set1_epi8((char)bxor);
+		__m128i o = _mm_setzero_si128();
+		for (; i + 16 <= cnt; i += 16) {
+			__m128i v = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(cp + i)), x);
+			_mm_storeu_si128((__m128i*)(dst + i), v);
+			o = _mm_or_si128(o, v);
+		}
+		o = _mm_or_si128(o, _mm_srli_si128(o, 8));
+		o = _mm_or_si128(o, _mm_srli_si128(o, 4));
+		o = _mm_or_si128(o, _mm_srli_si128(o, 2));
+		o = _mm_or_si128(o, _mm_srli_si128(o, 1));
+		any = (uae_u8)_mm_cvtsi128_si32(o);
+#elif defined(LTS_SIMD_NEON)
+		const uint8x16_t x = vdupq_n_u8(bxor);
+		uint8x16_t o = vdupq_n_u8(0);
+		for (; i + 16 <= cnt; i += 16) {
+			uint8x16_t v = veorq_u8(vld1q_u8(cp + i), x);
+			vst1q_u8(dst + i, v);
+			o = vorrq_u8(o, v);
+		}
+		uint8x8_t o8 = vorr_u8(vget_low_u8(o), vget_high_u8(o));
+		o8 = vorr_u8(o8, vreinterpret_u8_u64(vshr_n_u64(vreinterpret_u64_u8(o8), 32)));
+		o8 = vorr_u8(o8, vreinterpret_u8_u64(vshr_n_u64(vreinterpret_u64_u8(o8), 16)));
+		o8 = vorr_u8(o8, vreinterpret_u8_u64(vshr_n_u64(vreinterpret_u64_u8(o8), 8)));
+		any = vget_lane_u8(o8, 0);
+#endif
+		for (; i < cnt; i++) {
+			dst[i] = cp[i] ^ bxor;
+			any |= dst[i];
+		}
+	} else if (!remap_no) {
+		for (; i < cnt; i++) {
+			dst[i] = (uae_u8)remap[cp[i]] ^ bxor;
+			any |= dst[i];
+		}
+	} else {
+		for (; i < cnt; i++) {
+			uae_u8 c = cp[i];
+			uae_u8 v = (uae_u8)remap[c];
+			if (remap_no[c]) {
+				v += ofs;
+			}
+			dst[i] = v ^ bxor;
+			any |= dst[i];
+		}
+	}
+	return any;
+}
+
+#ifdef LTS_SIMD_PSHUFB
+// Colors 0-15 split to byte planes: b[n] byte k = byte n of acolors[k].
+struct lts_pal16
+{
+	__m128i b[4];
+};
+
+STATIC_INLINE void lts_pal16_init(struct lts_pal16 *p, const uae_u32 *acolors)
+{
+	const __m128i m = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+	__m128i s0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(acolors + 0)), m);
+	__m128i s1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(acolors + 4)), m);
+	__m128i s2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(acolors + 8)), m);
+	__m128i s3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(acolors + 12)), m);
+	__m128i t0 = _mm_unpacklo_epi32(s0, s1);
+	__m128i t1 = _mm_unpacklo_epi32(s2, s3);
+	__m128i t2 = _mm_unpackhi_epi32(s0, s1);
+	__m128i t3 = _mm_unpackhi_epi32(s2, s3);
+	p->b[0] = _mm_unpacklo_epi64(t0, t1);
+	p->b[1] = _mm_unpackhi_epi64(t0, t1);
+	p->b[2] = _mm_unpacklo_epi64(t2, t3);
+	p->b[3] = _mm_unpackhi_epi64(t2, t3);
+}
+#else
+struct lts_pal16;
+#endif
+
+#if defined(LTS_SIMD_AVX2) || defined(LTS_SIMD_SSE2)
+// Store 4 colors, each repeated 1 << d times.
+STATIC_INLINE uae_u32 *lts_store4(uae_u32 *out, __m128i c, int d)
+{
+	if (d == 0) {
+		_mm_storeu_si128((__m128i*)out, c);
+		return out + 4;
+	} else if (d == 1) {
+		_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi32(c, c));
+		_mm_storeu_si128((__m128i*)(out + 4), _mm_unpackhi_epi32(c, c));
+		return out + 8;
+	}
+	_mm_storeu_si128((__m128i*)out, _mm_shuffle_epi32(c, 0x00));
+	_mm_storeu_si128((__m128i*)(out + 4), _mm_shuffle_epi32(c, 0x55));
+	_mm_storeu_si128((__m128i*)(out + 8), _mm_shuffle_epi32(c, 0xaa));
+	_mm_storeu_si128((__m128i*)(out + 12), _mm_shuffle_epi32(c, 0xff));
+	return out + 16;
+}
+#endif
+
+// Write cnt palette colors, each repeated 1 << d times.
+// pal: split palette if all indexes are below 16, otherwise NULL.
+static void lts_span_colors(const uae_u8 *idx, int cnt, int d, const uae_u32 *acolors, const struct lts_pal16 *pal, uae_u32 *out)
+{
+	int i = 0;
+#ifdef LTS_SIMD_PSHUFB
+	if (pal) {
+		for (; i + 16 <= cnt; i += 16) {
+			__m128i ix = _mm_loadu_si128((const __m128i*)(idx + i));
+			__m128i b0 = _mm_shuffle_epi8(pal->b[0], ix);
+			__m128i b1 = _mm_shuffle_epi8(pal->b[1], ix);
+			__m128i b2 = _mm_shuffle_epi8(pal->b[2], ix);
+			__m128i b3 = _mm_shuffle_epi8(pal->b[3], ix);
+			__m128i lo01 = _mm_unpacklo_epi8(b0, b1);
+			__m128i hi01 = _mm_unpackhi_epi8(b0, b1);
+			__m128i lo23 = _mm_unpacklo_epi8(b2, b3);
+			__m128i hi23 = _mm_unpackhi_epi8(b2, b3);
+			out = lts_store4(out, _mm_unpacklo_epi16(lo01, lo23), d);
+			out = lts_store4(out, _mm_unpackhi_epi16(lo01, lo23), d);
+			out = lts_store4(out, _mm_unpacklo_epi16(hi01, hi23), d);
+			out = lts_store4(out, _mm_unpackhi_epi16(hi01, hi23), d);
+		}
+	}
+#endif
+#if defined(LTS_SIMD_AVX2)
+	const __m256i dbl0 = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+	const __m256i dbl1 = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+	for (; i + 8 <= cnt; i += 8) {
+		__m256i ix = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(idx + i)));
+		__m256i c = _mm256_i32gather_epi32((const int*)acolors, ix, 4);
+		if (d == 0) {
+			_mm256_storeu_si256((__m256i*)out, c);
+			out += 8;
+		} else if (d == 1) {
+			_mm256_storeu_si256((__m256i*)out, _mm256_permutevar8x32_epi32(c, dbl0));
+			_mm256_storeu_si256((__m256i*)(out + 8), _mm256_permutevar8x32_epi32(c, dbl1));
+			out += 16;
+		} else {
+			for (int j = 0; j < 8; j += 2) {
+				__m256i p = _mm256_permutevar8x32_epi32(c, _mm256_setr_epi32(j, j, j, j, j + 1, j + 1, j + 1, j + 1));
+				_mm256_storeu_si256((__m256i*)out, p);
+				out += 8;
+			}
+		}
+	}
+#elif defined(LTS_SIMD_SSE2)
+	// no byte shuffle in SSE2: scalar palette loads
+	for (; i + 4 <= cnt; i += 4) {
+		__m128i c = _mm_setr_epi32(acolors[idx[i + 0]], acolors[idx[i + 1]], acolors[idx[i + 2]], acolors[idx[i + 3]]);
+		out = lts_store4(out, c, d);
+	}
+#elif defined(LTS_SIMD_NEON)
+	for (; i + 4 <= cnt; i += 4) {
+		uae_u32 t[4] = { acolors[idx[i + 0]], acolors[idx[i + 1]], acolors[idx[i + 2]], acolors[idx[i + 3]] };
+		uint32x4_t c = vld1q_u32(t);
+		if (d == 0) {
+			vst1q_u32(out, c);
+			out += 4;
+		} else {
+			uint32x4x2_t z = vzipq_u32(c, c);
+			if (d == 1) {
+				vst1q_u32(out, z.val[0]);
+				vst1q_u32(out + 4, z.val[1]);
+				out += 8;
+			} else {
+				uint32x4x2_t z0 = vzipq_u32(z.val[0], z.val[0]);
+				uint32x4x2_t z1 = vzipq_u32(z.val[1], z.val[1]);
+				vst1q_u32(out, z0.val[0]);
+				vst1q_u32(out + 4, z0.val[1]);
+				vst1q_u32(out + 8, z1.val[0]);
+				vst1q_u32(out + 12, z1.val[1]);
+				out += 16;
+			}
+		}
+	}
+#endif
+	for (; i < cnt; i++) {
+		uae_u32 c = acolors[idx[i]];
+		for (int j = 0; j < (1 << d); j++) {
+			*out++ = c;
+		}
+	}
+}
+
+// Subpixel phase of doubled output: output pixel j uses source pixel (j + phase) >> d.
+STATIC_INLINE int lts_span_phase(const int *cpadds, int d)
+{
+	int k = 1 << d;
+	for (int i = 0; i < k; i++) {
+		if (cpadds[i]) {
+			return k - 1 - i;
+		}
+	}
+	return 0;
+}
+
+// Number of loop iterations left inside the bitplane area.
+STATIC_INLINE int lts_span_len(int cnt, int draw_end, int hstop_offset, int bufaddv)
+{
+	int end = draw_end < hstop_offset ? draw_end : hstop_offset;
+	return (end - cnt + bufaddv - 1) / bufaddv;
+}
+
+// Draw n loop iterations (n << d output pixels) to buf1 and optional buf2.
+// Returns the collision bits of all source pixels read.
+static uae_u16 lts_span(const uae_u8 *cp, int n, int d, int phase, const uae_u32 *acolors,
+	const int *remap, const int *remap_no, int ofs, uae_u8 bxor, const uae_u16 *clxtab,
+	uae_u32 *buf1, uae_u32 *buf2)
+{
+	uae_u8 idx[LTS_SIMD_CHUNK];
+#ifdef LTS_SIMD_PSHUFB
+	struct lts_pal16 pal16;
+	bool pal16init = false;
+#endif
+	int k = 1 << d;
+	int outcnt = n << d;
+	uae_u32 *out = buf1;
+	int src = 0;
+	int left = outcnt;
+
+	// partial first pixel
+	if (phase) {
+		int lead = k - phase;
+		lts_span_index(idx, cp, 1, remap, remap_no, ofs, bxor);
+		for (int j = 0; j < lead; j++) {
+			*out++ = acolors[idx[0]];
+		}
+		left -= lead;
+		src = 1;
+	}
+	int full = left >> d;
+	int tail = left & (k - 1);
+	while (full > 0) {
+		int cnt = full > LTS_SIMD_CHUNK ? LTS_SIMD_CHUNK : full;
+		const struct lts_pal16 *pal = NULL;
+#ifdef LTS_SIMD_PSHUFB
+		uae_u8 any = lts_span_index(idx, cp + src, cnt, remap, remap_no, ofs, bxor);
+		if (any < 16 && cnt >= 16) {
+			if (!pal16init) {
+				lts_pal16_init(&pal16, acolors);
+				pal16init = true;
+			}
+			pal = &pal16;
+		}
+#else
+		lts_span_index(idx, cp + src, cnt, remap, remap_no, ofs, bxor);
+#endif
+		lts_span_colors(idx, cnt, d, acolors, pal, out);
+		out += cnt << d;
+		src += cnt;
+		full -= cnt;
+	}
+	int last = src;
+	// partial last pixel
+	if (tail) {
+		lts_span_index(idx, cp + src, 1, remap, remap_no, ofs, bxor);
+		for (int j = 0; j < tail; j++) {
+			*out++ = acolors[idx[0]];
+		}
+		last++;
+	}
+	if (buf2) {
+		memcpy(buf2, buf1, outcnt * sizeof(uae_u32));
+	}
+
+	// bplcoltable only has 0 or 1 entries: stop at first match
+	uae_u16 clx = 0;
+	for (int i = 0; i < last; i++) {
+		clx |= clxtab[cp[i]];
+		if (clx) {
+			break;
+		}
+	}
+
+#if LTS_SIMD_CHECK
+	for (int j = 0; j < outcnt; j++) {
+		uae_u8 c = cp[(j + phase) >> d];
+		lts_span_index(idx, &c, 1, remap, remap_no, ofs, bxor);
+		if (buf1[j] != acolors[idx[0]]) {
+			write_log(_T("lts_span mismatch: n=%d d=%d phase=%d pixel %d: %08x != %08x\n"), n, d, phase, j, buf1[j], acolors[idx[0]]);
+			break;
+		}
+	}
+#endif
+
+	return clx;
+}
+
+#endif /* LTS_SIMD */
+
+#endif /* UAE_LINETOSCR_SIMD_H */
@@ -501,6 +501,12 @@ extern uae_u8 *baseaddr[MEMORY_BANKS];
 #endif
 
 #define get_mem_bank(addr) (*mem_banks[bankindex(addr)])
+
+/* Direct host pointers of banks that have baseaddr_direct_r/w set,
+ * biased so that mem_direct_r[bankindex(addr)] + addr is the host
+ * address. NULL if reads/writes must go through the bank handlers. */
+extern uae_u8 *mem_direct_r[MEMORY_BANKS];
+extern uae_u8 *mem_direct_w[MEMORY_BANKS];
 extern addrbank *get_mem_bank_real(uaecptr);
 
 #ifdef JIT
@@ -548,22 +554,37 @@ uae_u32 memory_get_wordi(uaecptr);
 
 STATIC_INLINE uae_u32 get_long(uaecptr addr)
 {
+	uae_u8 *m = mem_direct_r[bankindex(addr)];
+	if (m)
+		return do_get_mem_long((uae_u32*)(m + addr));
 	return memory_get_long(addr);
 }
 STATIC_INLINE uae_u32 get_word (uaecptr addr)
 {
+	uae_u8 *m = mem_direct_r[bankindex(addr)];
+	if (m)
+		return do_get_mem_word((uae_u16*)(m + addr));
 	return memory_get_word(addr);
 }
 STATIC_INLINE uae_u32 get_byte (uaecptr addr)
 {
+	uae_u8 *m = mem_direct_r[bankindex(addr)];
+	if (m)
+		return do_get_mem_byte(m + addr);
 	return memory_get_byte(addr);
 }
 STATIC_INLINE uae_u32 get_longi(uaecptr addr)
 {
+	uae_u8 *m = mem_direct_r[bankindex(addr)];
+	if (m)
+		return do_get_mem_long((uae_u32*)(m + addr));
 	return memory_get_longi(addr);
 }
 STATIC_INLINE uae_u32 get_wordi(uaecptr addr)
 {
+	uae_u8 *m = mem_direct_r[bankindex(addr)];
+	if (m)
+		return do_get_mem_word((uae_u16*)(m + addr));
 	return memory_get_wordi(addr);
 }
 
@@ -619,7 +640,7 @@ STATIC_INLINE uae_u32 get_long_jit(uaecptr addr)
 	addrbank *bank = &get_mem_bank(addr);
 	special_mem |= bank->jit_read_flag;
 #endif
-	return memory_get_long(addr);
+	return get_long(addr);
 }
 STATIC_INLINE uae_u32 get_word_jit(uaecptr addr)
 {
@@ -627,7 +648,7 @@ STATIC_INLINE uae_u32 get_word_jit(uaecptr addr)
 	addrbank *bank = &get_mem_bank(addr);
 	special_mem |= bank->jit_read_flag;
 #endif
-	return memory_get_word(addr);
+	return get_word(addr);
 }
 STATIC_INLINE uae_u32 get_byte_jit(uaecptr addr)
 {
@@ -635,7 +656,7 @@ STATIC_INLINE uae_u32 get_byte_jit(uaecptr addr)
 	addrbank *bank = &get_mem_bank(addr);
 	special_mem |= bank->jit_read_flag;
 #endif
-	return memory_get_byte(addr);
+	return get_byte(addr);
 }
 STATIC_INLINE uae_u32 get_longi_jit(uaecptr addr)
 {
@@ -643,7 +664,7 @@ STATIC_INLINE uae_u32 get_longi_jit(uaecptr addr)
 	addrbank *bank = &get_mem_bank(addr);
 	special_mem |= bank->jit_read_flag;
 #endif
-	return memory_get_longi(addr);
+	return get_longi(addr);
 }
 STATIC_INLINE uae_u32 get_wordi_jit(uaecptr addr)
 {
@@ -651,7 +672,7 @@ STATIC_INLINE uae_u32 get_wordi_jit(uaecptr addr)
 	addrbank *bank = &get_mem_bank(addr);
 	special_mem |= bank->jit_read_flag;
 #endif
-	return memory_get_wordi(addr);
+	return get_wordi(addr);
 }
 
 /*
@@ -695,15 +716,27 @@ void memory_put_byte(uaecptr, uae_u32);
 
 STATIC_INLINE void put_long (uaecptr addr, uae_u32 l)
 {
-	memory_put_long(addr, l);
+	uae_u8 *m = mem_direct_w[bankindex(addr)];
+	if (m)
+		do_put_mem_long((uae_u32*)(m + addr), l);
+	else
+		memory_put_long(addr, l);
 }
 STATIC_INLINE void put_word (uaecptr addr, uae_u32 w)
 {
-	memory_put_word(addr, w);
+	uae_u8 *m = mem_direct_w[bankindex(addr)];
+	if (m)
+		do_put_mem_word((uae_u16*)(m + addr), w);
+	else
+		memory_put_word(addr, w);
 }
 STATIC_INLINE void put_byte (uaecptr addr, uae_u32 b)
 {
-	memory_put_byte(addr, b);
+	uae_u8 *m = mem_direct_w[bankindex(addr)];
+	if (m)
+		do_put_mem_byte(m + addr, b);
+	else
+		memory_put_byte(addr, b);
 }
 
 // do split memory access if it can cross memory banks
@@ -741,7 +774,7 @@ STATIC_INLINE void put_long_jit(uaecptr addr, uae_u32 l)
 	addrbank *bank = &get_mem_bank(addr);
 	special_mem |= bank->jit_write_flag;
 #endif
-	memory_put_long(addr, l);
+	put_long(addr, l);
 }
 STATIC_INLINE void put_word_jit(uaecptr addr, uae_u32 l)
 {
@@ -749,7 +782,7 @@ STATIC_INLINE void put_word_jit(uaecptr addr, uae_u32 l)
 	addrbank *bank = &get_mem_bank(addr);
 	special_mem |= bank->jit_write_flag;
 #endif
-	memory_put_word(addr, l);
+	put_word(addr, l);
 }
 STATIC_INLINE void put_byte_jit(uaecptr addr, uae_u32 l)
 {
@@ -757,7 +790,7 @@ STATIC_INLINE void put_byte_jit(uaecptr addr, uae_u32 l)
 	addrbank *bank = &get_mem_bank(addr);
 	special_mem |= bank->jit_write_flag;
 #endif
-	memory_put_byte(addr, l);
+	put_byte(addr, l);
 }
 
 /*
@@ -848,6 +881,7 @@ extern void REGPARAM3 chipmem_bput (uaecptr, uae_u32) REGPARAM;
 
 extern uae_u32 REGPARAM3 chipmem_agnus_wget (uaecptr) REGPARAM;
 extern void REGPARAM3 chipmem_agnus_wput (uaecptr, uae_u32) REGPARAM;
+extern uae_u32 chipmem_agnus_linear_size (void);
 
 extern addrbank dummy_bank;
 
@@ -884,6 +918,7 @@ extern uae_u32 natmem_reserved_size;
 
 extern bool mapped_malloc (addrbank*);
 extern void mapped_free (addrbank*);
+extern void mapped_clear_direct (addrbank*);
 extern void a3000_fakekick (int);
 
 extern uaecptr strcpyha_safe (uaecptr dst, const uae_char *src);
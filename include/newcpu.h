@@ -133,12 +133,14 @@ struct cache020
 };
 
 #define CACHELINES030 16
+/* Tags and packed valid bits are kept apart from the data so that
+ * lookups and flushes only touch a few bytes. */
 struct cache030
 {
-	uae_u32 data[4];
-	bool valid[4];
-	uae_u32 tag;
-	uae_u8 fc;
+	uae_u32 tag[CACHELINES030];
+	uae_u8 valid[CACHELINES030]; /* bit n: data[line][n] valid */
+	uae_u8 fc[CACHELINES030];
+	uae_u32 data[CACHELINES030][4];
 };
 
 #define CACHESETS040 64
@@ -160,7 +162,7 @@ struct mmufixup
 };
 extern struct mmufixup mmufixup[2];
 
-#ifdef MSVC_LONG_DOUBLE
+#if defined(MSVC_LONG_DOUBLE) || defined(X87_LONG_DOUBLE)
 typedef struct {
 	uae_u64 m;
 	uae_u16 e;
@@ -173,7 +175,7 @@ typedef struct
 #ifdef WITH_SOFTFLOAT
 	floatx80 fpx;
 #endif
-#ifdef MSVC_LONG_DOUBLE
+#if defined(MSVC_LONG_DOUBLE) || defined(X87_LONG_DOUBLE)
 	union {
 		fptype fp;
 		fprawtype rfp;
@@ -738,6 +740,8 @@ extern int m68k_movec2 (int, uae_u32 *);
 extern int m68k_divl (uae_u32, uae_u32, uae_u16, uaecptr);
 extern int m68k_mull (uae_u32, uae_u32, uae_u16);
 extern void init_m68k (void);
+extern void cpu_benchmark_core(int mode);
+extern uae_s64 cpu_benchmark_run(uae_s64 count, uaecptr endpc);
 extern void m68k_go (int);
 extern void m68k_dumpstate(uaecptr *, uaecptr);
 extern void m68k_dumpcache(bool);
@@ -587,8 +587,11 @@ struct uae_prefs {
 	int comptrustnaddr;
 	bool compnf;
 	bool compfpu;
+	bool compfpu_sse2;
 	bool comp_hardflush;
 	bool comp_constjump;
+	bool comp_trace;
+	int comp_budget;
 	bool comp_catchfault;
 	int cachesize;
 	bool cachesize_inhibit;
@@ -625,6 +628,7 @@ struct uae_prefs {
 	bool lightpen_crosshair;
 	int lightpen_offset[2][2];
 	int gfx_display_sections;
+	int gfx_denise_threads;
 	int gfx_variable_sync;
 	bool gfx_windowed_resize;
 	int gfx_overscanmode;
@@ -699,9 +703,13 @@ struct uae_prefs {
 	bool turbo_boot;
 	int turbo_boot_delay;
 	bool headless;
+	bool nodisplay;
 	int filesys_limit;
 	int filesys_max_name;
 	int filesys_max_file_size;
+	int hardfile_cache;
+	bool hardfile_mmap;
+	int zfile_cache;
 	bool filesys_inject_icons;
 	TCHAR filesys_inject_icons_tool[MAX_DPATH];
 	TCHAR filesys_inject_icons_project[MAX_DPATH];
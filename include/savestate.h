@@ -119,6 +119,7 @@ extern uae_u8 *save_custom_agacolors(size_t *len, uae_u8 *);
 
 extern uae_u8 *restore_custom_event_delay (uae_u8 *src);
 extern uae_u8 *save_custom_event_delay(size_t *len, uae_u8 *dstptr);
+extern size_t save_custom_event_delay_size(void);
 
 extern uae_u8 *restore_custom_slots(uae_u8 *src);
 extern uae_u8 *save_custom_slots(size_t *len, uae_u8 *dstptr);
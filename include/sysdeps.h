@@ -61,6 +61,11 @@ using namespace std;
 #error unrecognized CPU type
 #endif
 
+/* GCC/Clang x86 builds: 80-bit native FPU mode (fpu_mode < 0) using x87 long double */
+#if (defined(CPU_x86_64) || defined(CPU_i386)) && defined(__GNUC__) && defined(WITH_SOFTFLOAT) && !defined(MSVC_LONG_DOUBLE) && !defined(USE_LONG_DOUBLE)
+#define X87_LONG_DOUBLE
+#endif
+
 #ifdef _WIN32
 /* Parameters are passed in ECX, EDX for both x86 and x86-64 (RCX, RDX).
  * For x86-64, __fastcall is the default, so it isn't really required. */
@@ -14,7 +14,7 @@
 extern void do_start_program (void);
 extern void start_program (void);
 extern void leave_program (void);
-extern void real_main (int, TCHAR **);
+extern int real_main (int, TCHAR **);
 extern void usage (void);
 extern int sleep_millis (int ms);
 extern int sleep_millis_main(int ms);
@@ -6,6 +6,8 @@
 typedef uae_s64 (*ZFILEREAD)(void*, uae_u64, uae_u64, struct zfile*);
 typedef uae_s64 (*ZFILEWRITE)(const void*, uae_u64, uae_u64, struct zfile*);
 typedef uae_s64 (*ZFILESEEK)(struct zfile*, uae_s64, int);
+typedef void (*ZFILECLOSE)(struct zfile*);
+typedef struct zfile *(*ZFILEDUP)(struct zfile*);
 
 struct zfile {
     TCHAR *name;
@@ -31,6 +33,8 @@ struct zfile {
     ZFILEREAD zfileread;
     ZFILEWRITE zfilewrite;
     ZFILESEEK zfileseek;
+    ZFILECLOSE zfileclose; // frees userdata contents, userdata itself is freed by zfile
+    ZFILEDUP zfiledup; // zfile_dup() of file with userdata
     void *userdata;
     int useparent;
 };
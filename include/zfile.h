@@ -71,6 +71,12 @@ extern int zfile_putc(int c, struct zfile *z);
 extern int zfile_ferror(struct zfile *z);
 extern uae_u8 *zfile_getdata(struct zfile *z, uae_s64 offset, int len, int *outlen);
 extern void zfile_exit(void);
+
+extern bool zfile_cache_enabled(void);
+extern bool zfile_cache_key(struct zfile *z, int mask, int index, uae_u8 *key);
+extern struct zfile *zfile_cache_open(const uae_u8 *key, struct zfile *z, const TCHAR *originalname);
+extern void zfile_cache_store(const uae_u8 *key, const TCHAR *packedname, struct zfile *z);
+extern void zfile_cache_exit(void);
 extern int execute_command(TCHAR *);
 extern int zfile_iscompressed(struct zfile *z);
 extern int zfile_zcompress(struct zfile *dst, void *src, size_t size);
@@ -9893,6 +9893,9 @@ void bootwarpmode(void)
 
 void warpmode(int mode)
 {
+	// no display mode always runs unthrottled
+	if (currprefs.nodisplay)
+		mode = 1;
 	if (mode < 0) {
 		if (currprefs.turbo_emulation) {
 			changed_prefs.gfx_framerate = currprefs.gfx_framerate = 1;
@@ -1930,6 +1930,24 @@ static bool target_check_bsf(void)
  *************************************************************************/
 
 
+/* With host double precision (no extended precision emulation) and
+ * comp_fpu_sse2 enabled the native FP registers live in XMM0-XMM5 instead
+ * of on the x87 stack. SSE2 arithmetic always rounds to double and uses
+ * the MXCSR rounding mode, which fpp_set_mode() loads from FPCR together
+ * with the x87 control word. FPCR single precision rounding is not
+ * emulated, so x87 stays the default
+ * until this has been verified against the cputest FPU sets. Only those six
+ * are used: XMM6 and up are callee-saved in the Win64 ABI. Operations that
+ * SSE2 cannot do go through the x87 unit one value at a time, which keeps
+ * the rounding mode of the x87 control word for integer conversions and
+ * frndint. */
+#if defined(CPU_x86_64)
+static bool fpu_use_sse2;
+#define FPU_SSE2 fpu_use_sse2
+#else
+#define FPU_SSE2 false
+#endif
+
 static inline void raw_fp_init(void)
 {
 	int i;
@@ -1937,6 +1955,9 @@ static inline void raw_fp_init(void)
 	for (i=0;i<N_FREGS;i++)
 		live.spos[i]=-2;
 	live.tos=-1;  /* Stack is empty */
+#if defined(CPU_x86_64)
+	fpu_use_sse2 = !use_long_double && currprefs.compfpu_sse2;
+#endif
 }
 
 static inline void raw_fp_cleanup_drop(void)
@@ -2064,16 +2085,44 @@ DEFINE_OP(fsts,  FSTSm);
 DEFINE_OP(fstpt, FSTPTm);
 DEFINE_OP(fldt,  FLDTm);
 DEFINE_OP(fistpl, FISTPLm);
+DEFINE_OP(fstps, FSTPSm);
 #undef DEFINE_OP
 
+alignas(16) static uae_u64 sse2_fp_tmp[2];
+alignas(16) static const uae_u64 sse2_fp_sign[2] = { 0x8000000000000000ULL, 0x8000000000000000ULL };
+alignas(16) static const uae_u64 sse2_fp_abs[2] = { 0x7fffffffffffffffULL, 0x7fffffffffffffffULL };
+static const double sse2_fp_zero = 0;
+
+/* Push XMM register r onto the x87 stack */
+static inline void sse2_fld(int r)
+{
+	MOVSDrm(r, JITPTR sse2_fp_tmp, X86_NOREG, X86_NOREG, 1);
+	raw_fldl(JITPTR sse2_fp_tmp);
+}
+
+/* Pop the x87 top of stack into XMM register r */
+static inline void sse2_fstp(int r)
+{
+	raw_fstpl(JITPTR sse2_fp_tmp);
+	MOVSDmr(JITPTR sse2_fp_tmp, X86_NOREG, X86_NOREG, 1, r);
+}
+
 LOWFUNC(NONE,WRITE,2,raw_fmov_mr,(MEMPTRW m, FR r))
 {
+	if (FPU_SSE2) {
+		MOVSDrm(r, m, X86_NOREG, X86_NOREG, 1);
+		return;
+	}
 	make_tos(r);
 	raw_fstl(m);
 }
 
 LOWFUNC(NONE,WRITE,2,raw_fmov_mr_drop,(MEMPTRW m, FR r))
 {
+	if (FPU_SSE2) {
+		MOVSDrm(r, m, X86_NOREG, X86_NOREG, 1);
+		return;
+	}
 	make_tos(r);
 	raw_fstpl(m);
 	live.onstack[live.tos]=-1;
@@ -2083,18 +2132,31 @@ LOWFUNC(NONE,WRITE,2,raw_fmov_mr_drop,(MEMPTRW m, FR r))
 
 LOWFUNC(NONE,READ,2,raw_fmov_rm,(FW r, MEMPTRR m))
 {
+	if (FPU_SSE2) {
+		MOVSDmr(m, X86_NOREG, X86_NOREG, 1, r);
+		return;
+	}
 	raw_fldl(m);
 	tos_make(r);
 }
 
 LOWFUNC(NONE,READ,2,raw_fmovi_rm,(FW r, MEMPTRR m))
 {
+	if (FPU_SSE2) {
+		CVTSI2SDLmr(m, X86_NOREG, X86_NOREG, 1, r);
+		return;
+	}
 	raw_fildl(m);
 	tos_make(r);
 }
 
 LOWFUNC(NONE,WRITE,2,raw_fmovi_mr,(MEMPTRW m, FR r))
 {
+	if (FPU_SSE2) {
+		sse2_fld(r);
+		raw_fistpl(m);
+		return;
+	}
 	make_tos(r);
 	raw_fistl(m);
 }
@@ -2104,8 +2166,15 @@ LOWFUNC(NONE,WRITE,3,raw_fmovi_mrb,(MEMPTRW m, FR r, double *bounds))
 	/* Clamp value to the given range and convert to integer. */
 
 	int rs;
-	usereg(r);
-	rs = stackpos(r)+1;
+	uae_s8 *target_p = NULL;
+
+	if (FPU_SSE2) {
+		sse2_fld(r);
+		rs = 1;
+	} else {
+		usereg(r);
+		rs = stackpos(r)+1;
+	}
 
 	/* Lower bound onto stack */
 	raw_fldl(JITPTR  &bounds[0]); /* fld double from lower */
@@ -2114,7 +2183,13 @@ LOWFUNC(NONE,WRITE,3,raw_fmovi_mrb,(MEMPTRW m, FR r, double *bounds))
 	emit_byte(0xdb);
 	emit_byte(0xf0+rs); /* fcomi lower,r */
 	emit_byte(0x73);
-	emit_byte(12);      /* jae to writeback */
+	if (FPU_SSE2) {
+		/* sse2_fp_tmp may not be RIP addressable, size varies */
+		target_p = (uae_s8 *)x86_get_target();
+		emit_byte(0);
+	} else {
+		emit_byte(12);      /* jae to writeback */
+	}
 
 	/* Upper bound onto stack */
 	emit_byte(0xdd);
@@ -2128,17 +2203,32 @@ LOWFUNC(NONE,WRITE,3,raw_fmovi_mrb,(MEMPTRW m, FR r, double *bounds))
 	emit_byte(0xd0+rs); /* fcmovnbe upper,r */
 
 	/* Store to destination */
+	if (target_p)
+		*target_p = JITPTR x86_get_target() - (JITPTR target_p + 1);
 	raw_fistpl(m);
+	if (FPU_SSE2) {
+		emit_byte(0xdd);
+		emit_byte(0xd8);	/* fstp st(0), drop the copy of r */
+	}
 }
 
 LOWFUNC(NONE,READ,2,raw_fmovs_rm,(FW r, MEMPTRR m))
 {
+	if (FPU_SSE2) {
+		CVTSS2SDmr(m, X86_NOREG, X86_NOREG, 1, r);
+		return;
+	}
 	raw_flds(m);
 	tos_make(r);
 }
 
 LOWFUNC(NONE,WRITE,2,raw_fmovs_mr,(MEMPTRW m, FR r))
 {
+	if (FPU_SSE2) {
+		sse2_fld(r);
+		raw_fstps(m);
+		return;
+	}
 	make_tos(r);
 	raw_fsts(m);
 }
@@ -2147,6 +2237,12 @@ LOWFUNC(NONE,WRITE,2,raw_fmov_ext_mr,(MEMPTRW m, FR r))
 {
 	int rs;
 
+	if (FPU_SSE2) {
+		sse2_fld(r);
+		raw_fstpt(m);
+		return;
+	}
+
 	/* Stupid x87 can't write a long double to mem without popping the stack! */
 	usereg(r);
 	rs=stackpos(r);
@@ -2158,6 +2254,11 @@ LOWFUNC(NONE,WRITE,2,raw_fmov_ext_mr,(MEMPTRW m, FR r))
 
 LOWFUNC(NONE,WRITE,2,raw_fmov_ext_mr_drop,(MEMPTRW m, FR r))
 {
+	if (FPU_SSE2) {
+		sse2_fld(r);
+		raw_fstpt(m);
+		return;
+	}
 	make_tos(r);
 	raw_fstpt(m);	/* store and pop it */
 	live.onstack[live.tos]=-1;
@@ -2168,46 +2269,68 @@ LOWFUNC(NONE,WRITE,2,raw_fmov_ext_mr_drop,(MEMPTRW m, FR r))
 LOWFUNC(NONE,READ,2,raw_fmov_ext_rm,(FW r, MEMPTRR m))
 {
 	raw_fldt(m);
-	tos_make(r);
+	if (FPU_SSE2)
+		sse2_fstp(r);
+	else
+		tos_make(r);
 }
 
 LOWFUNC(NONE,NONE,1,raw_fmov_pi,(FW r))
 {
 	emit_byte(0xd9);
 	emit_byte(0xeb);
-	tos_make(r);
+	if (FPU_SSE2)
+		sse2_fstp(r);
+	else
+		tos_make(r);
 }
 
 LOWFUNC(NONE,NONE,1,raw_fmov_log10_2,(FW r))
 {
 	emit_byte(0xd9);
 	emit_byte(0xec);
-	tos_make(r);
+	if (FPU_SSE2)
+		sse2_fstp(r);
+	else
+		tos_make(r);
 }
 
 LOWFUNC(NONE,NONE,1,raw_fmov_log2_e,(FW r))
 {
 	emit_byte(0xd9);
 	emit_byte(0xea);
-	tos_make(r);
+	if (FPU_SSE2)
+		sse2_fstp(r);
+	else
+		tos_make(r);
 }
 
 LOWFUNC(NONE,NONE,1,raw_fmov_loge_2,(FW r))
 {
 	emit_byte(0xd9);
 	emit_byte(0xed);
-	tos_make(r);
+	if (FPU_SSE2)
+		sse2_fstp(r);
+	else
+		tos_make(r);
 }
 
 LOWFUNC(NONE,NONE,1,raw_fmov_1,(FW r))
 {
 	emit_byte(0xd9);
 	emit_byte(0xe8);
-	tos_make(r);
+	if (FPU_SSE2)
+		sse2_fstp(r);
+	else
+		tos_make(r);
 }
 
 LOWFUNC(NONE,NONE,1,raw_fmov_0,(FW r))
 {
+	if (FPU_SSE2) {
+		XORPDrr(r, r);
+		return;
+	}
 	emit_byte(0xd9);
 	emit_byte(0xee);
 	tos_make(r);
@@ -2217,6 +2340,11 @@ LOWFUNC(NONE,NONE,2,raw_fmov_rr,(FW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		if (d!=s)
+			MOVAPDrr(s, d);
+		return;
+	}
 	usereg(s);
 	ds=stackpos(s);
 	if (ds==0 && live.spos[d]>=0) {
@@ -2244,6 +2372,10 @@ LOWFUNC(NONE,NONE,2,raw_fsqrt_rr,(FW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		SQRTSDrr(s, d);
+		return;
+	}
 	if (d!=s) {
 		usereg(s);
 		ds=stackpos(s);
@@ -2264,6 +2396,12 @@ LOWFUNC(NONE,NONE,2,raw_fabs_rr,(FW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		if (d!=s)
+			MOVAPDrr(s, d);
+		ANDPDmr(JITPTR sse2_fp_abs, X86_NOREG, X86_NOREG, 1, d);
+		return;
+	}
 	if (d!=s) {
 		usereg(s);
 		ds=stackpos(s);
@@ -2284,6 +2422,13 @@ LOWFUNC(NONE,NONE,2,raw_frndint_rr,(FW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		sse2_fld(s);
+		emit_byte(0xd9);
+		emit_byte(0xfc); /* take frndint */
+		sse2_fstp(d);
+		return;
+	}
 	if (d!=s) {
 		usereg(s);
 		ds=stackpos(s);
@@ -2304,6 +2449,13 @@ LOWFUNC(NONE,NONE,2,raw_fcos_rr,(FW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		sse2_fld(s);
+		emit_byte(0xd9);
+		emit_byte(0xff); /* take cos */
+		sse2_fstp(d);
+		return;
+	}
 	if (d!=s) {
 		usereg(s);
 		ds=stackpos(s);
@@ -2324,6 +2476,13 @@ LOWFUNC(NONE,NONE,2,raw_fsin_rr,(FW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		sse2_fld(s);
+		emit_byte(0xd9);
+		emit_byte(0xfe); /* fsin sin(x) */
+		sse2_fstp(d);
+		return;
+	}
 	if (d!=s) {
 		usereg(s);
 		ds=stackpos(s);
@@ -2346,10 +2505,14 @@ LOWFUNC(NONE,NONE,2,raw_ftwotox_rr,(FW d, FR s))
 {
 	int ds;
 
-	usereg(s);
-	ds=stackpos(s);
-	emit_byte(0xd9);
-	emit_byte(0xc0+ds); /* fld x */
+	if (FPU_SSE2) {
+		sse2_fld(s);
+	} else {
+		usereg(s);
+		ds=stackpos(s);
+		emit_byte(0xd9);
+		emit_byte(0xc0+ds); /* fld x */
+	}
 	emit_byte(0xd9);
 	emit_byte(0xc0);	/* duplicate top of stack. Now up to 8 high */
 	emit_byte(0xd9);
@@ -2365,17 +2528,24 @@ LOWFUNC(NONE,NONE,2,raw_ftwotox_rr,(FW d, FR s))
 	emit_byte(0xfd);    /* fscale (2^frac(x))*2^int(x) */
 	emit_byte(0xdd);
 	emit_byte(0xd9);    /* fstp copy & pop */
-	tos_make(d);        /* store y=2^x */
+	if (FPU_SSE2)
+		sse2_fstp(d);
+	else
+		tos_make(d);        /* store y=2^x */
 }
 
 LOWFUNC(NONE,NONE,2,raw_fetox_rr,(FW d, FR s))
 {
 	int ds;
 
-	usereg(s);
-	ds=stackpos(s);
-	emit_byte(0xd9);
-	emit_byte(0xc0+ds); /* duplicate source */
+	if (FPU_SSE2) {
+		sse2_fld(s);
+	} else {
+		usereg(s);
+		ds=stackpos(s);
+		emit_byte(0xd9);
+		emit_byte(0xc0+ds); /* duplicate source */
+	}
 	emit_byte(0xd9);
 	emit_byte(0xea);    /* fldl2e log2(e) */
 	emit_byte(0xde);
@@ -2396,24 +2566,34 @@ LOWFUNC(NONE,NONE,2,raw_fetox_rr,(FW d, FR s))
 	emit_byte(0xfd);  /* and scale it */
 	emit_byte(0xdd);
 	emit_byte(0xd9);  /* take he rounded value off */
-	tos_make(d); /* store to destination */
+	if (FPU_SSE2)
+		sse2_fstp(d);
+	else
+		tos_make(d); /* store to destination */
 }
 
 LOWFUNC(NONE,NONE,2,raw_flog2_rr,(FW d, FR s))
 {
 	int ds;
 
-	usereg(s);
-	ds=stackpos(s);
-	emit_byte(0xd9);
-	emit_byte(0xc0+ds); /* duplicate source */
+	if (FPU_SSE2) {
+		sse2_fld(s);
+	} else {
+		usereg(s);
+		ds=stackpos(s);
+		emit_byte(0xd9);
+		emit_byte(0xc0+ds); /* duplicate source */
+	}
 	emit_byte(0xd9);
 	emit_byte(0xe8);    /* push '1' */
 	emit_byte(0xd9);
 	emit_byte(0xc9);    /* swap top two */
 	emit_byte(0xd9);
 	emit_byte(0xf1);    /* take 1*log2(x) */
-	tos_make(d); /* store to destination */
+	if (FPU_SSE2)
+		sse2_fstp(d);
+	else
+		tos_make(d); /* store to destination */
 }
 
 
@@ -2421,6 +2601,12 @@ LOWFUNC(NONE,NONE,2,raw_fneg_rr,(FW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		if (d!=s)
+			MOVAPDrr(s, d);
+		XORPDmr(JITPTR sse2_fp_sign, X86_NOREG, X86_NOREG, 1, d);
+		return;
+	}
 	if (d!=s) {
 		usereg(s);
 		ds=stackpos(s);
@@ -2441,6 +2627,10 @@ LOWFUNC(NONE,NONE,2,raw_fadd_rr,(FRW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		ADDSDrr(s, d);
+		return;
+	}
 	usereg(s);
 	usereg(d);
 
@@ -2463,6 +2653,10 @@ LOWFUNC(NONE,NONE,2,raw_fsub_rr,(FRW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		SUBSDrr(s, d);
+		return;
+	}
 	usereg(s);
 	usereg(d);
 
@@ -2485,6 +2679,10 @@ LOWFUNC(NONE,NONE,2,raw_fcmp_rr,(FR d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		UCOMISDrr(s, d);
+		return;
+	}
 	usereg(s);
 	usereg(d);
 
@@ -2499,6 +2697,10 @@ LOWFUNC(NONE,NONE,2,raw_fmul_rr,(FRW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		MULSDrr(s, d);
+		return;
+	}
 	usereg(s);
 	usereg(d);
 
@@ -2521,6 +2723,10 @@ LOWFUNC(NONE,NONE,2,raw_fdiv_rr,(FRW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		DIVSDrr(s, d);
+		return;
+	}
 	usereg(s);
 	usereg(d);
 
@@ -2543,6 +2749,16 @@ LOWFUNC(NONE,NONE,2,raw_frem_rr,(FRW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		sse2_fld(s);
+		sse2_fld(d);
+		emit_byte(0xd9);
+		emit_byte(0xf8); /* take rem from dest by source */
+		sse2_fstp(d);
+		emit_byte(0xdd);
+		emit_byte(0xd8); /* fstp st(0), drop source */
+		return;
+	}
 	usereg(s);
 	usereg(d);
 
@@ -2560,6 +2776,16 @@ LOWFUNC(NONE,NONE,2,raw_frem1_rr,(FRW d, FR s))
 {
 	int ds;
 
+	if (FPU_SSE2) {
+		sse2_fld(s);
+		sse2_fld(d);
+		emit_byte(0xd9);
+		emit_byte(0xf5); /* take rem1 from dest by source */
+		sse2_fstp(d);
+		emit_byte(0xdd);
+		emit_byte(0xd8); /* fstp st(0), drop source */
+		return;
+	}
 	usereg(s);
 	usereg(d);
 
@@ -2576,6 +2802,10 @@ LOWFUNC(NONE,NONE,2,raw_frem1_rr,(FRW d, FR s))
 
 LOWFUNC(NONE,NONE,1,raw_ftst_r,(FR r))
 {
+	if (FPU_SSE2) {
+		UCOMISDmr(JITPTR &sse2_fp_zero, X86_NOREG, X86_NOREG, 1, r);
+		return;
+	}
 	make_tos(r);
 	emit_byte(0xd9);  /* ftst */
 	emit_byte(0xe4);
@@ -2743,6 +2973,12 @@ LOWFUNC(NONE,NONE,2,raw_ftan_rr,(FW d, FR s))
 
 LOWFUNC(NONE,NONE,1,raw_fcuts_r,(FRW r))
 {
+	if (FPU_SSE2) {
+		sse2_fld(r);
+		raw_fstps(JITPTR sse2_fp_tmp);
+		CVTSS2SDmr(JITPTR sse2_fp_tmp, X86_NOREG, X86_NOREG, 1, r);
+		return;
+	}
 	make_tos(r);     /* TOS = r */
 	REX64();
 	emit_byte(0x83);
@@ -2763,6 +2999,8 @@ LOWFUNC(NONE,NONE,1,raw_fcuts_r,(FRW r))
 
 LOWFUNC(NONE,NONE,1,raw_fcut_r,(FRW r))
 {
+	if (FPU_SSE2)
+		return;		/* already double */
 	make_tos(r);     /* TOS = r */
 	REX64();
 	emit_byte(0x83);
@@ -3272,6 +3510,10 @@ static inline void raw_fflags_into_flags(int r)
 {
 	int p;
 
+	if (FPU_SSE2) {
+		UCOMISDmr(JITPTR &sse2_fp_zero, X86_NOREG, X86_NOREG, 1, r);
+		return;
+	}
 	usereg(r);
 	p=stackpos(r);
 
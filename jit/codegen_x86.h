@@ -1829,15 +1829,23 @@ enum {
 #define XORPDrr(RS, RD)			_SSEPDrr(X86_SSE_XOR, RS, RD)
 #define XORPDmr(MD, MB, MI, MS, RD)	_SSEPDmr(X86_SSE_XOR, MD, MB, MI, MS, RD)
 
-#define COMISSrr(RS, RD)		_SSESSrr(X86_SSE_COMI, RS, RD)
-#define COMISSmr(MD, MB, MI, MS, RD)	_SSESSmr(X86_SSE_COMI, MD, MB, MI, MS, RD)
-#define COMISDrr(RS, RD)		_SSESDrr(X86_SSE_COMI, RS, RD)
-#define COMISDmr(MD, MB, MI, MS, RD)	_SSESDmr(X86_SSE_COMI, MD, MB, MI, MS, RD)
-
-#define UCOMISSrr(RS, RD)		_SSESSrr(X86_SSE_UCOMI, RS, RD)
-#define UCOMISSmr(MD, MB, MI, MS, RD)	_SSESSmr(X86_SSE_UCOMI, MD, MB, MI, MS, RD)
-#define UCOMISDrr(RS, RD)		_SSESDrr(X86_SSE_UCOMI, RS, RD)
-#define UCOMISDmr(MD, MB, MI, MS, RD)	_SSESDmr(X86_SSE_UCOMI, MD, MB, MI, MS, RD)
+#define COMISSrr(RS, RD)		_SSEPSrr(X86_SSE_COMI, RS, RD)
+#define COMISSmr(MD, MB, MI, MS, RD)	_SSEPSmr(X86_SSE_COMI, MD, MB, MI, MS, RD)
+#define COMISDrr(RS, RD)		_SSEPDrr(X86_SSE_COMI, RS, RD)
+#define COMISDmr(MD, MB, MI, MS, RD)	_SSEPDmr(X86_SSE_COMI, MD, MB, MI, MS, RD)
+
+#define UCOMISSrr(RS, RD)		_SSEPSrr(X86_SSE_UCOMI, RS, RD)
+#define UCOMISSmr(MD, MB, MI, MS, RD)	_SSEPSmr(X86_SSE_UCOMI, MD, MB, MI, MS, RD)
+#define UCOMISDrr(RS, RD)		_SSEPDrr(X86_SSE_UCOMI, RS, RD)
+#define UCOMISDmr(MD, MB, MI, MS, RD)	_SSEPDmr(X86_SSE_UCOMI, MD, MB, MI, MS, RD)
+
+#define MOVSSrr(RS, RD)			_SSESSrr(0x10, RS, RD)
+#define MOVSSmr(MD, MB, MI, MS, RD)	_SSESSmr(0x10, MD, MB, MI, MS, RD)
+#define MOVSSrm(RS, MD, MB, MI, MS)	_SSESSrm(0x11, RS, MD, MB, MI, MS)
+
+#define MOVSDrr(RS, RD)			_SSESDrr(0x10, RS, RD)
+#define MOVSDmr(MD, MB, MI, MS, RD)	_SSESDmr(0x10, MD, MB, MI, MS, RD)
+#define MOVSDrm(RS, MD, MB, MI, MS)	_SSESDrm(0x11, RS, MD, MB, MI, MS)
 
 #define MOVAPSrr(RS, RD)		_SSEPSrr(0x28, RS, RD)
 #define MOVAPSmr(MD, MB, MI, MS, RD)	_SSEPSmr(0x28, MD, MB, MI, MS, RD)
@@ -537,6 +537,16 @@ static inline int end_block(uae_u32 opcode)
 {
 	return (prop[opcode].cflow & fl_end_block);
 }
+/* Conditional branches that a trace may continue through: Bcc and DBF are
+ * the only ones compiled with register_branch(), other DBcc update PC_P
+ * with cmov and have no side exit. */
+static inline bool is_trace_branch(uae_u32 opcode)
+{
+	return (prop[opcode].cflow & fl_end_block) == fl_branch &&
+		(((opcode & 0xf000) == 0x6000 && (opcode & 0x0e00)) || (opcode & 0xfff8) == 0x51c8);
+}
+/* Maximum number of side exits in one trace */
+#define MAXTRACEEXITS 8
 
 #ifdef _WIN32
 LONG WINAPI EvalException(LPEXCEPTION_POINTERS info);
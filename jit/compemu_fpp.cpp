@@ -1552,10 +1552,21 @@ void comp_fpp_opp(uae_u32 opcode, uae_u16 extra)
 				FAIL(1);
 				return;
 			}
-
+#ifdef USE_X86_FPUCW
+			/* frndint rounds according to the control word, which follows FPCR */
+			dont_care_fflags();
+			src = get_fp_value(opcode, extra);
+			if (src < 0)
+			{
+				FAIL(1);				/* Illegal instruction */
+				return;
+			}
+			frndint_rr(reg, src);
+			MAKE_FPSR(reg);
+			break;
+#endif
 			FAIL(1);
 			return;
-			dont_care_fflags();
 			break;
 		case 0x02:						/* FSINH */
 			if (jit_disable.fsinh)
@@ -1588,7 +1599,8 @@ void comp_fpp_opp(uae_u32 opcode, uae_u16 extra)
 
 			frndint_rr(reg, src);
 
-			/* restore control word */
+			/* restore control word, MXCSR is left at the FPCR rounding
+			 * mode (set by fpp_set_mode()) as only frndint used RZ */
 			mov_l_rm(S1, JITPTR &regs.fpcr);
 			and_l_ri(S1, 0x000000f0);
 			fldcw_m_indexed(S1, JITPTR x86_fpucw);
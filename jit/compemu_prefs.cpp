@@ -18,7 +18,9 @@ bool check_prefs_changed_comp (bool checkonly)
 		currprefs.compnf != changed_prefs.compnf ||
 		currprefs.comp_hardflush != changed_prefs.comp_hardflush ||
 		currprefs.comp_constjump != changed_prefs.comp_constjump ||
+		currprefs.comp_trace != changed_prefs.comp_trace ||
 		currprefs.compfpu != changed_prefs.compfpu ||
+		currprefs.compfpu_sse2 != changed_prefs.compfpu_sse2 ||
 		currprefs.fpu_strict != changed_prefs.fpu_strict ||
 		currprefs.cachesize != changed_prefs.cachesize)
 		changed = 1;
@@ -33,7 +35,10 @@ bool check_prefs_changed_comp (bool checkonly)
 	currprefs.compnf = changed_prefs.compnf;
 	currprefs.comp_hardflush = changed_prefs.comp_hardflush;
 	currprefs.comp_constjump = changed_prefs.comp_constjump;
+	currprefs.comp_trace = changed_prefs.comp_trace;
+	currprefs.comp_budget = changed_prefs.comp_budget;
 	currprefs.compfpu = changed_prefs.compfpu;
+	currprefs.compfpu_sse2 = changed_prefs.compfpu_sse2;
 	currprefs.fpu_strict = changed_prefs.fpu_strict;
 
 	if (currprefs.cachesize != changed_prefs.cachesize) {
@@ -4061,8 +4061,11 @@ static void prepare_block(blockinfo* bi)
 }
 
 #ifdef UAE
+static void compile_block_stats_log(void);
+
 void compemu_reset(void)
 {
+	compile_block_stats_log();
 	flush_icache = lazy_flush ? flush_icache_lazy : flush_icache_hard;
 	set_cache_state(0);
 }
@@ -4724,11 +4727,121 @@ static void print_inst(void)
 }
 #endif
 
+#ifdef UAE
+/* Translation rate limit (comp_budget). At most comp_budget percent of
+ * each 1/50s window is spent in compile_block(), blocks that miss the
+ * budget keep running in execute_normal() and are retried later.
+ */
+static frame_time_t compile_window_start, compile_window_used;
+static frame_time_t compile_time_total, compile_time_max;
+static uae_u32 compile_blocks, compile_deferred, compile_deferred_peak;
+
+static bool compile_block_deferred(uae_u16 *location)
+{
+	frame_time_t now, window;
+	blockinfo *bi;
+
+	if (currprefs.comp_budget <= 0)
+		return false;
+	now = read_processor_time();
+	window = syncbase / 50;
+	if (now - compile_window_start >= window) {
+		compile_window_start = now;
+		compile_window_used = 0;
+		compile_deferred = 0;
+	}
+	if (compile_window_used < window * currprefs.comp_budget / 100)
+		return false;
+	/* Expired countdown keeps decrementing while interpreted */
+	bi = get_blockinfo_addr(location);
+	if (bi && bi->count < -1)
+		bi->count = -1;
+	compile_deferred++;
+	if (compile_deferred > compile_deferred_peak)
+		compile_deferred_peak = compile_deferred;
+	return true;
+}
+
+static void compile_block_stats(frame_time_t t)
+{
+	compile_window_used += t;
+	compile_time_total += t;
+	if (t > compile_time_max)
+		compile_time_max = t;
+	compile_blocks++;
+}
+
+static void compile_block_stats_log(void)
+{
+	if (compile_blocks && syncbase > 0) {
+		write_log(_T("JIT: %u blocks translated, avg %.1fus max %.1fus, deferred peak %u/window\n"),
+			compile_blocks,
+			(double)compile_time_total * 1000000.0 / syncbase / compile_blocks,
+			(double)compile_time_max * 1000000.0 / syncbase,
+			compile_deferred_peak);
+	}
+	compile_time_total = 0;
+	compile_time_max = 0;
+	compile_blocks = 0;
+	compile_deferred = 0;
+	compile_deferred_peak = 0;
+}
+
+/* A conditional branch was compiled in the middle of a trace. Emit a side
+ * exit for the direction that was not recorded and keep the register state
+ * for the direction the trace continues in.
+ */
+static void compile_trace_exit(uintptr cont, int cycles)
+{
+	uintptr exit_pc_p;
+	int cc;
+	uae_u32* branchadd;
+	bigstate tmp;
+	int r, r2;
+
+	if (cont == taken_pc_p) {
+		exit_pc_p = next_pc_p;
+		cc = branch_cc;
+	} else {
+		exit_pc_p = taken_pc_p;
+		cc = branch_cc ^ 1;
+	}
+	next_pc_p = 0;
+	taken_pc_p = 0;
+
+	tmp = live;
+#if defined(USE_DATA_BUFFER)
+	data_check_end(32, 128); // just a pessimistic guess...
+#endif
+	/* fall through to the side exit when the branch goes the other way */
+	compemu_raw_jcc_l_oponly(cc);
+	branchadd = (uae_u32*)get_target();
+	skip_long();
+
+	mov_l_ri(PC_P, exit_pc_p);
+	flush(1);
+	flush_reg_count();
+	r = REG_PC_TMP;
+	r2 = (r == 0) ? 1 : 0;
+	compemu_raw_mov_l_ri(r, cacheline(exit_pc_p));
+	compemu_raw_mov_l_ri(r2, JITPTR popall_do_nothing);
+	raw_sub_l_mi(uae_p32(&countdown), cycles);
+	raw_cmov_l_rm_indexed(r2, JITPTR cache_tags, r, sizeof(void *), NATIVE_CC_PL);
+	compemu_raw_jmp_r(r2);
+
+	align_target(align_jumps);
+	write_jmp_target(branchadd, (cpuop_func *)get_target());
+	live = tmp;
+	mov_l_ri(PC_P, cont);
+	comp_pc_p = (uae_u8*)cont;
+}
+#endif
 
 #ifdef UAE
 void compile_block(cpu_history *pc_hist, int blocklen, int totcycles)
 {
-	if (cache_enabled && compiled_code && currprefs.cpu_model >= 68020) {
+	if (cache_enabled && compiled_code && currprefs.cpu_model >= 68020 && !compile_block_deferred(pc_hist[0].location)) {
+		frame_time_t compile_start = read_processor_time();
 #else
 static void compile_block(cpu_history* pc_hist, int blocklen)
 {
@@ -4805,9 +4918,15 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 			uae_u16* currpcp=pc_hist[i].location;
 			uae_u32 op=DO_GET_OPCODE(currpcp);
 
+#ifdef UAE
+			if (i < blocklen - 1 && is_trace_branch(op)) {
+				/* Side exit: whatever follows may need any flag */
+				liveflags[i+1]=FLAG_ALL;
+			}
+#endif
 #if USE_CHECKSUM_INFO
 			trace_in_rom = trace_in_rom && isinrom((uintptr)currpcp);
-			if (follow_const_jumps && is_const_jump(op)) {
+			if ((follow_const_jumps && is_const_jump(op)) || (i < blocklen - 1 && is_trace_branch(op))) {
 				checksum_info *csi = alloc_checksum_info();
 				csi->start_p = (uae_u8 *)min_pcp;
 				csi->length = JITPTR max_pcp - JITPTR min_pcp + LONGEST_68K_INST;
@@ -4961,6 +5080,12 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 
 					comptbl[opcode](opcode);
 					freescratch();
+#ifdef UAE
+					if (next_pc_p && i < blocklen - 1) {
+						/* Conditional branch inside a trace */
+						compile_trace_exit(JITPTR pc_hist[i+1].location, scaled_cycles(totcycles * (i + 1) / blocklen));
+					}
+#endif
 					if (!(liveflags[i+1] & FLAG_CZNV)) {
 						/* We can forget about flags */
 						dont_care_flags();
@@ -5060,6 +5185,18 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 #endif
 						compemu_raw_jmp(JITPTR popall_do_nothing);
 						*branchadd = JITPTR get_target() - (JITPTR branchadd + 1);
+#ifdef UAE
+						if (is_trace_branch(opcode)) {
+							/* Interpreted branch inside a trace: leave if it went the other way */
+							compemu_raw_cmp_l_mi(JITPTR &regs.pc_p, JITPTR pc_hist[i+1].location);
+							compemu_raw_jz_b_oponly();
+							branchadd=get_target();
+							skip_byte();
+							raw_sub_l_mi(uae_p32(&countdown),scaled_cycles(totcycles * (i + 1) / blocklen));
+							compemu_raw_jmp(JITPTR popall_do_nothing);
+							*branchadd = JITPTR get_target() - (JITPTR branchadd + 1);
+						}
+#endif
 					}
 				}
 			}
@@ -5322,6 +5459,7 @@ static void compile_block(cpu_history* pc_hist, int blocklen)
 		compile_time += (clock() - start_time);
 #endif
 #ifdef UAE
+		compile_block_stats(read_processor_time() - compile_start);
 		/* Account for compilation time */
 		do_extra_cycles(totcycles);
 #endif
@@ -4,13 +4,19 @@
 * This file was generated by genlinetoscr. Don't edit.
 */
 
-static void lts_aga_n_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -21,6 +27,18 @@ static void lts_aga_n_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -37,18 +55,29 @@ static void lts_aga_n_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -59,6 +88,18 @@ static void lts_aga_dpf_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -81,15 +122,20 @@ static void lts_aga_dpf_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -124,15 +170,20 @@ static void lts_aga_ehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -161,15 +212,20 @@ static void lts_aga_ham_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -199,15 +255,20 @@ static void lts_aga_kehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -239,11 +300,16 @@ static void lts_aga_n_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -279,11 +345,19 @@ static void lts_aga_n_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstr
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -321,11 +395,19 @@ static void lts_aga_dpf_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -373,11 +455,16 @@ static void lts_aga_dpf_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -414,11 +501,16 @@ static void lts_aga_ehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -464,11 +556,16 @@ static void lts_aga_ehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -500,11 +597,16 @@ static void lts_aga_ham_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -538,11 +640,16 @@ static void lts_aga_ham_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -574,11 +681,16 @@ static void lts_aga_kehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -614,54 +726,62 @@ static void lts_aga_kehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hb
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 1);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -673,6 +793,18 @@ static void lts_aga_n_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -695,18 +827,29 @@ static void lts_aga_n_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 1);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -718,6 +861,18 @@ static void lts_aga_dpf_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -752,15 +907,20 @@ static void lts_aga_dpf_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -807,15 +967,20 @@ static void lts_aga_ehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -850,15 +1015,20 @@ static void lts_aga_ham_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -895,18 +1065,26 @@ static void lts_aga_kehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -917,6 +1095,18 @@ static void lts_aga_n_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -933,18 +1123,29 @@ static void lts_aga_n_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -955,6 +1156,18 @@ static void lts_aga_dpf_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -977,15 +1190,20 @@ static void lts_aga_dpf_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1020,15 +1238,20 @@ static void lts_aga_ehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1057,15 +1280,20 @@ static void lts_aga_ham_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1095,15 +1323,20 @@ static void lts_aga_kehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1135,11 +1368,16 @@ static void lts_aga_n_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1175,11 +1413,19 @@ static void lts_aga_n_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstr
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1217,11 +1463,19 @@ static void lts_aga_dpf_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1269,11 +1523,16 @@ static void lts_aga_dpf_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1310,11 +1569,16 @@ static void lts_aga_ehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1360,11 +1624,16 @@ static void lts_aga_ehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1396,11 +1665,16 @@ static void lts_aga_ham_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1434,11 +1708,16 @@ static void lts_aga_ham_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1470,11 +1749,16 @@ static void lts_aga_kehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1510,14 +1794,22 @@ static void lts_aga_kehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hb
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 2);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -1531,6 +1823,18 @@ static void lts_aga_n_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 2, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 2;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -1565,18 +1869,29 @@ static void lts_aga_n_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 2);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -1590,6 +1905,18 @@ static void lts_aga_dpf_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 2, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 2;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -1648,15 +1975,20 @@ static void lts_aga_dpf_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1727,15 +2059,20 @@ static void lts_aga_ehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1782,15 +2119,20 @@ static void lts_aga_ham_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1841,18 +2183,26 @@ static void lts_aga_kehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 1);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -1864,6 +2214,18 @@ static void lts_aga_n_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -1886,18 +2248,29 @@ static void lts_aga_n_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 1);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -1909,6 +2282,18 @@ static void lts_aga_dpf_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -1943,15 +2328,20 @@ static void lts_aga_dpf_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1998,15 +2388,20 @@ static void lts_aga_ehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2041,15 +2436,20 @@ static void lts_aga_ham_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2086,18 +2486,26 @@ static void lts_aga_kehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2108,6 +2516,18 @@ static void lts_aga_n_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2124,18 +2544,29 @@ static void lts_aga_n_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2146,6 +2577,18 @@ static void lts_aga_dpf_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2168,15 +2611,20 @@ static void lts_aga_dpf_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2211,15 +2659,20 @@ static void lts_aga_ehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2248,15 +2701,20 @@ static void lts_aga_ham_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2286,18 +2744,27 @@ static void lts_aga_kehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2310,6 +2777,19 @@ static void lts_aga_n_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2327,18 +2807,31 @@ static void lts_aga_n_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2351,6 +2844,19 @@ static void lts_aga_dpf_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2374,15 +2880,22 @@ static void lts_aga_dpf_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2420,15 +2933,22 @@ static void lts_aga_ehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2460,15 +2980,22 @@ static void lts_aga_ham_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2501,15 +3028,22 @@ static void lts_aga_kehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2544,11 +3078,18 @@ static void lts_aga_n_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2587,11 +3128,21 @@ static void lts_aga_n_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstr
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2632,11 +3183,21 @@ static void lts_aga_dpf_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2687,11 +3248,18 @@ static void lts_aga_dpf_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2731,11 +3299,18 @@ static void lts_aga_ehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2784,11 +3359,18 @@ static void lts_aga_ehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2823,11 +3405,18 @@ static void lts_aga_ham_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2864,11 +3453,18 @@ static void lts_aga_ham_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2903,11 +3499,18 @@ static void lts_aga_kehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2946,54 +3549,64 @@ static void lts_aga_kehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hb
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 1);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -3008,6 +3621,19 @@ static void lts_aga_n_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 1;
+					buf2 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -3032,18 +3658,31 @@ static void lts_aga_n_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 1);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -3058,6 +3697,19 @@ static void lts_aga_dpf_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 1;
+					buf2 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -3094,15 +3746,22 @@ static void lts_aga_dpf_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3154,15 +3813,22 @@ static void lts_aga_ehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3202,15 +3868,22 @@ static void lts_aga_ham_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3252,18 +3925,28 @@ static void lts_aga_kehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -3276,6 +3959,19 @@ static void lts_aga_n_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -3293,18 +3989,31 @@ static void lts_aga_n_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -3317,6 +4026,19 @@ static void lts_aga_dpf_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -3340,15 +4062,22 @@ static void lts_aga_dpf_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3386,15 +4115,22 @@ static void lts_aga_ehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3426,15 +4162,22 @@ static void lts_aga_ham_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3467,15 +4210,22 @@ static void lts_aga_kehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3510,11 +4260,18 @@ static void lts_aga_n_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3553,11 +4310,21 @@ static void lts_aga_n_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstr
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3598,11 +4365,21 @@ static void lts_aga_dpf_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3653,11 +4430,18 @@ static void lts_aga_dpf_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3697,11 +4481,18 @@ static void lts_aga_ehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3750,11 +4541,18 @@ static void lts_aga_ehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3789,11 +4587,18 @@ static void lts_aga_ham_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3830,11 +4635,18 @@ static void lts_aga_ham_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3869,11 +4681,18 @@ static void lts_aga_kehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3912,14 +4731,24 @@ static void lts_aga_kehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hb
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 2);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -3938,6 +4767,19 @@ static void lts_aga_n_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 2, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 2;
+					buf2 += n << 2;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -3976,18 +4818,31 @@ static void lts_aga_n_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 2);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -4006,6 +4861,19 @@ static void lts_aga_dpf_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 2, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 2;
+					buf2 += n << 2;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -4068,15 +4936,22 @@ static void lts_aga_dpf_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4156,15 +5031,22 @@ static void lts_aga_ehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4220,15 +5102,22 @@ static void lts_aga_ham_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4288,18 +5177,28 @@ static void lts_aga_kehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 1);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -4314,6 +5213,19 @@ static void lts_aga_n_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 1;
+					buf2 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -4338,18 +5250,31 @@ static void lts_aga_n_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 1);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -4364,6 +5289,19 @@ static void lts_aga_dpf_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 1;
+					buf2 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -4400,15 +5338,22 @@ static void lts_aga_dpf_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4460,15 +5405,22 @@ static void lts_aga_ehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4508,15 +5460,22 @@ static void lts_aga_ham_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4558,18 +5517,28 @@ static void lts_aga_kehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -4582,6 +5551,19 @@ static void lts_aga_n_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -4599,18 +5581,31 @@ static void lts_aga_n_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
+	#if LTS_SIMD
+	int spanphase = lts_span_phase(cpadds, 0);
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -4623,6 +5618,19 @@ static void lts_aga_dpf_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, dpf_lookup_no, dblpfofs[bpldualpf2of], bxor, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -4646,15 +5654,22 @@ static void lts_aga_dpf_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4692,15 +5707,22 @@ static void lts_aga_ehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4732,15 +5754,22 @@ static void lts_aga_ham_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4773,8 +5802,11 @@ static void lts_aga_kehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
@@ -4,10 +4,14 @@
 * This file was generated by genlinetoscr. Don't edit.
 */
 
-static void lts_aga_n_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -42,15 +46,25 @@ static void lts_aga_n_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -91,15 +105,22 @@ static void lts_aga_dpf_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -139,15 +160,22 @@ static void lts_aga_ehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -181,15 +209,22 @@ static void lts_aga_ham_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -224,15 +259,22 @@ static void lts_aga_kehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -269,11 +311,18 @@ static void lts_aga_n_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -314,11 +363,21 @@ static void lts_aga_n_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, i
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -361,11 +420,21 @@ static void lts_aga_dpf_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -418,11 +487,18 @@ static void lts_aga_dpf_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -464,11 +540,18 @@ static void lts_aga_ehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -519,11 +602,18 @@ static void lts_aga_ehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -560,11 +650,18 @@ static void lts_aga_ham_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -603,11 +700,18 @@ static void lts_aga_ham_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -644,11 +748,18 @@ static void lts_aga_kehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -689,51 +800,58 @@ static void lts_aga_kehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -778,15 +896,25 @@ static void lts_aga_n_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -843,15 +971,22 @@ static void lts_aga_dpf_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -906,15 +1041,22 @@ static void lts_aga_ehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -957,15 +1099,22 @@ static void lts_aga_ham_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1010,15 +1159,22 @@ static void lts_aga_kehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1053,15 +1209,25 @@ static void lts_aga_n_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1102,15 +1268,22 @@ static void lts_aga_dpf_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1150,15 +1323,22 @@ static void lts_aga_ehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1192,15 +1372,22 @@ static void lts_aga_ham_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1235,15 +1422,22 @@ static void lts_aga_kehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1280,11 +1474,18 @@ static void lts_aga_n_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1325,11 +1526,21 @@ static void lts_aga_n_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, i
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1372,11 +1583,21 @@ static void lts_aga_dpf_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1429,11 +1650,18 @@ static void lts_aga_dpf_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1475,11 +1703,18 @@ static void lts_aga_ehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1530,11 +1765,18 @@ static void lts_aga_ehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1571,11 +1813,18 @@ static void lts_aga_ham_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1614,11 +1863,18 @@ static void lts_aga_ham_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1655,11 +1911,18 @@ static void lts_aga_kehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1700,11 +1963,18 @@ static void lts_aga_kehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1769,15 +2039,25 @@ static void lts_aga_n_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1866,15 +2146,22 @@ static void lts_aga_dpf_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -1959,15 +2246,22 @@ static void lts_aga_ehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2028,15 +2322,22 @@ static void lts_aga_ham_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2101,15 +2402,22 @@ static void lts_aga_kehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2154,15 +2462,25 @@ static void lts_aga_n_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2219,15 +2537,22 @@ static void lts_aga_dpf_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2282,15 +2607,22 @@ static void lts_aga_ehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2333,15 +2665,22 @@ static void lts_aga_ham_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2386,15 +2725,22 @@ static void lts_aga_kehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2429,15 +2775,25 @@ static void lts_aga_n_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2478,15 +2834,22 @@ static void lts_aga_dpf_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2526,15 +2889,22 @@ static void lts_aga_ehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2568,15 +2938,22 @@ static void lts_aga_ham_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2611,15 +2988,23 @@ static void lts_aga_kehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2657,15 +3042,27 @@ static void lts_aga_n_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2709,15 +3106,24 @@ static void lts_aga_dpf_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2760,15 +3166,24 @@ static void lts_aga_ehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2805,15 +3220,24 @@ static void lts_aga_ham_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2851,15 +3275,24 @@ static void lts_aga_kehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2899,11 +3332,20 @@ static void lts_aga_n_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2947,11 +3389,23 @@ static void lts_aga_n_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, i
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -2997,11 +3451,23 @@ static void lts_aga_dpf_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3057,11 +3523,20 @@ static void lts_aga_dpf_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3106,11 +3581,20 @@ static void lts_aga_ehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3164,11 +3648,20 @@ static void lts_aga_ehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3208,11 +3701,20 @@ static void lts_aga_ham_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3254,11 +3756,20 @@ static void lts_aga_ham_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3298,11 +3809,20 @@ static void lts_aga_kehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3346,51 +3866,60 @@ static void lts_aga_kehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3440,15 +3969,27 @@ static void lts_aga_n_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3510,15 +4051,24 @@ static void lts_aga_dpf_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3578,15 +4128,24 @@ static void lts_aga_ehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3634,15 +4193,24 @@ static void lts_aga_ham_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3692,15 +4260,24 @@ static void lts_aga_kehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3738,15 +4315,27 @@ static void lts_aga_n_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3790,15 +4379,24 @@ static void lts_aga_dpf_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3841,15 +4439,24 @@ static void lts_aga_ehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3886,15 +4493,24 @@ static void lts_aga_ham_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3932,15 +4548,24 @@ static void lts_aga_kehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -3980,11 +4605,20 @@ static void lts_aga_n_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4028,11 +4662,23 @@ static void lts_aga_n_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, i
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4078,11 +4724,23 @@ static void lts_aga_dpf_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4138,11 +4796,20 @@ static void lts_aga_dpf_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4187,11 +4854,20 @@ static void lts_aga_ehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4245,11 +4921,20 @@ static void lts_aga_ehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4289,11 +4974,20 @@ static void lts_aga_ham_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4335,11 +5029,20 @@ static void lts_aga_ham_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4379,11 +5082,20 @@ static void lts_aga_kehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4427,11 +5139,20 @@ static void lts_aga_kehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4505,15 +5226,27 @@ static void lts_aga_n_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4611,15 +5344,24 @@ static void lts_aga_dpf_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4713,15 +5455,24 @@ static void lts_aga_ehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4791,15 +5542,24 @@ static void lts_aga_ham_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4873,15 +5633,24 @@ static void lts_aga_kehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -4931,15 +5700,27 @@ static void lts_aga_n_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -5001,15 +5782,24 @@ static void lts_aga_dpf_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -5069,15 +5859,24 @@ static void lts_aga_ehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -5125,15 +5924,24 @@ static void lts_aga_ham_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -5183,15 +5991,24 @@ static void lts_aga_kehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_n_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -5229,15 +6046,27 @@ static void lts_aga_n_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_n_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_n_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_dpf_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
+	int *dpf_lookup_no = fs->dpf_lookup_no;
+	int bpldualpf2of = fs->bpldualpf2of;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -5281,15 +6110,24 @@ static void lts_aga_dpf_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_dpf_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_dpf_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -5332,15 +6170,24 @@ static void lts_aga_ehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ehb_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ehb_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_ham_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -5377,15 +6224,24 @@ static void lts_aga_ham_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_ham_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_ham_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_aga_kehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u32 *colors_aga = (uae_u32*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 bxor = ls->bplcon4 >> 8;
@@ -5423,8 +6279,12 @@ static void lts_aga_kehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_aga_kehb_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_aga_kehb_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
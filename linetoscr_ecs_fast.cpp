@@ -4,12 +4,18 @@
 * This file was generated by genlinetoscr. Don't edit.
 */
 
-static void lts_ecs_n_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -20,6 +26,18 @@ static void lts_ecs_n_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -35,17 +53,26 @@ static void lts_ecs_n_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -56,6 +83,18 @@ static void lts_ecs_dpf_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -74,15 +113,21 @@ static void lts_ecs_dpf_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -115,15 +160,20 @@ static void lts_ecs_ehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -151,15 +201,20 @@ static void lts_ecs_ham_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -187,15 +242,20 @@ static void lts_ecs_kehb_ilores_dlores_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -225,11 +285,16 @@ static void lts_ecs_n_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -262,11 +327,17 @@ static void lts_ecs_n_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstr
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -299,11 +370,17 @@ static void lts_ecs_dpf_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -342,11 +419,17 @@ static void lts_ecs_dpf_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -381,11 +464,17 @@ static void lts_ecs_ehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -428,11 +517,16 @@ static void lts_ecs_ehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -462,11 +556,16 @@ static void lts_ecs_ham_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -499,11 +598,16 @@ static void lts_ecs_ham_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -533,11 +637,16 @@ static void lts_ecs_kehb_ihires_dlores_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -570,53 +679,61 @@ static void lts_ecs_kehb_ihires_dlores_b1_filtered(int cnt, int draw_end, int hb
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dlores_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dlores_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -628,6 +745,18 @@ static void lts_ecs_n_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -647,17 +776,26 @@ static void lts_ecs_n_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -669,6 +807,18 @@ static void lts_ecs_dpf_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -694,15 +844,21 @@ static void lts_ecs_dpf_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -745,15 +901,20 @@ static void lts_ecs_ehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -786,15 +947,20 @@ static void lts_ecs_ham_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -827,17 +993,25 @@ static void lts_ecs_kehb_ilores_dhires_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -848,6 +1022,18 @@ static void lts_ecs_n_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -863,17 +1049,26 @@ static void lts_ecs_n_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -884,6 +1079,18 @@ static void lts_ecs_dpf_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -902,15 +1109,21 @@ static void lts_ecs_dpf_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -943,15 +1156,20 @@ static void lts_ecs_ehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -979,15 +1197,20 @@ static void lts_ecs_ham_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1015,15 +1238,19 @@ static void lts_ecs_kehb_ihires_dhires_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1050,11 +1277,15 @@ static void lts_ecs_n_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1081,11 +1312,16 @@ static void lts_ecs_n_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstr
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1112,11 +1348,16 @@ static void lts_ecs_dpf_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1143,11 +1384,16 @@ static void lts_ecs_dpf_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1174,11 +1420,16 @@ static void lts_ecs_ehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1205,11 +1456,15 @@ static void lts_ecs_ehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1236,11 +1491,15 @@ static void lts_ecs_ham_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1267,11 +1526,15 @@ static void lts_ecs_ham_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1298,11 +1561,15 @@ static void lts_ecs_kehb_ishres_dhires_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1329,13 +1596,21 @@ static void lts_ecs_kehb_ishres_dhires_b1_filtered(int cnt, int draw_end, int hb
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -1349,6 +1624,18 @@ static void lts_ecs_n_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 2, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 2;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -1376,17 +1663,26 @@ static void lts_ecs_n_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -1400,6 +1696,18 @@ static void lts_ecs_dpf_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 2, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 2;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -1439,15 +1747,21 @@ static void lts_ecs_dpf_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1510,15 +1824,20 @@ static void lts_ecs_ehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1561,15 +1880,20 @@ static void lts_ecs_ham_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1612,17 +1936,25 @@ static void lts_ecs_kehb_ilores_dshres_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -1634,6 +1966,18 @@ static void lts_ecs_n_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -1653,17 +1997,26 @@ static void lts_ecs_n_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -1675,6 +2028,18 @@ static void lts_ecs_dpf_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, NULL);
+					cp += n;
+					buf1 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -1700,15 +2065,21 @@ static void lts_ecs_dpf_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1751,15 +2122,20 @@ static void lts_ecs_ehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1792,15 +2168,20 @@ static void lts_ecs_ham_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1833,15 +2214,19 @@ static void lts_ecs_kehb_ihires_dshres_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1869,15 +2254,20 @@ static void lts_ecs_n_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1905,15 +2295,20 @@ static void lts_ecs_dpf_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1941,15 +2336,19 @@ static void lts_ecs_ehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -1977,15 +2376,19 @@ static void lts_ecs_ham_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2013,17 +2416,26 @@ static void lts_ecs_kehb_ishres_dshres_b1(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dshres_b1_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2036,6 +2448,19 @@ static void lts_ecs_n_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2052,17 +2477,28 @@ static void lts_ecs_n_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2075,6 +2511,19 @@ static void lts_ecs_dpf_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2094,15 +2543,23 @@ static void lts_ecs_dpf_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2138,15 +2595,22 @@ static void lts_ecs_ehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2177,15 +2641,22 @@ static void lts_ecs_ham_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2216,15 +2687,22 @@ static void lts_ecs_kehb_ilores_dlores_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2257,11 +2735,18 @@ static void lts_ecs_n_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2297,11 +2782,19 @@ static void lts_ecs_n_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstr
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2337,11 +2830,19 @@ static void lts_ecs_dpf_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2383,11 +2884,19 @@ static void lts_ecs_dpf_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2425,11 +2934,19 @@ static void lts_ecs_ehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2475,11 +2992,18 @@ static void lts_ecs_ehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2512,11 +3036,18 @@ static void lts_ecs_ham_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2552,11 +3083,18 @@ static void lts_ecs_ham_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2589,11 +3127,18 @@ static void lts_ecs_kehb_ihires_dlores_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2629,53 +3174,63 @@ static void lts_ecs_kehb_ihires_dlores_b2_filtered(int cnt, int draw_end, int hb
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dlores_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dlores_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2690,6 +3245,19 @@ static void lts_ecs_n_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 1;
+					buf2 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2711,17 +3279,28 @@ static void lts_ecs_n_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2736,6 +3315,19 @@ static void lts_ecs_dpf_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 1;
+					buf2 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2763,15 +3355,23 @@ static void lts_ecs_dpf_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2819,15 +3419,22 @@ static void lts_ecs_ehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2865,15 +3472,22 @@ static void lts_ecs_ham_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -2911,17 +3525,27 @@ static void lts_ecs_kehb_ilores_dhires_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2934,6 +3558,19 @@ static void lts_ecs_n_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2950,17 +3587,28 @@ static void lts_ecs_n_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -2973,6 +3621,19 @@ static void lts_ecs_dpf_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 0, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 0;
+					buf2 += n << 0;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -2992,15 +3653,23 @@ static void lts_ecs_dpf_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3036,15 +3705,22 @@ static void lts_ecs_ehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3075,15 +3751,22 @@ static void lts_ecs_ham_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3114,15 +3797,21 @@ static void lts_ecs_kehb_ihires_dhires_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3152,11 +3841,17 @@ static void lts_ecs_n_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3186,11 +3881,18 @@ static void lts_ecs_n_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstr
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3220,11 +3922,18 @@ static void lts_ecs_dpf_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3254,11 +3963,18 @@ static void lts_ecs_dpf_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3288,11 +4004,18 @@ static void lts_ecs_ehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3322,11 +4045,17 @@ static void lts_ecs_ehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3356,11 +4085,17 @@ static void lts_ecs_ham_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3390,11 +4125,17 @@ static void lts_ecs_ham_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3424,11 +4165,17 @@ static void lts_ecs_kehb_ishres_dhires_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3458,13 +4205,23 @@ static void lts_ecs_kehb_ishres_dhires_b2_filtered(int cnt, int draw_end, int hb
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -3483,6 +4240,19 @@ static void lts_ecs_n_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 2, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 2;
+					buf2 += n << 2;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -3514,17 +4284,28 @@ static void lts_ecs_n_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -3543,6 +4324,19 @@ static void lts_ecs_dpf_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 2, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 2;
+					buf2 += n << 2;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -3586,15 +4380,23 @@ static void lts_ecs_dpf_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3666,15 +4468,22 @@ static void lts_ecs_ehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3726,15 +4535,22 @@ static void lts_ecs_ham_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3786,17 +4602,27 @@ static void lts_ecs_kehb_ilores_dshres_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -3811,6 +4637,19 @@ static void lts_ecs_n_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, NULL, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 1;
+					buf2 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -3832,17 +4671,28 @@ static void lts_ecs_n_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
+	#if LTS_SIMD
+	int spanphase = 0;
+	#endif
 	while (cnt < draw_end) {
 		bool bpl = false;
 		if (cnt < bpl1dat_trigger_offset || cnt < hbstop_offset || cnt < hstrt_offset || cnt >= hstop_offset) {
@@ -3857,6 +4707,19 @@ static void lts_ecs_dpf_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 			}
 		} else {
 			bpl = true;
+			#if LTS_SIMD
+			{
+				int n = lts_span_len(cnt, draw_end, hstop_offset, bufaddv);
+				if (n >= LTS_SIMD_MIN && !lts_simd_disable) {
+					clxdat |= lts_span(cp, n, 1, spanphase, acolors, dpf_lookup, NULL, 0, 0, bplcoltable, buf1, buf2);
+					cp += n;
+					buf1 += n << 1;
+					buf2 += n << 1;
+					cnt += n * bufaddv;
+					continue;
+				}
+			}
+			#endif
 			uae_u8 c;
 			uae_u32 col;
 			c = *cp;
@@ -3884,15 +4747,23 @@ static void lts_ecs_dpf_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3940,15 +4811,22 @@ static void lts_ecs_ehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -3986,15 +4864,22 @@ static void lts_ecs_ham_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -4032,15 +4917,21 @@ static void lts_ecs_kehb_ihires_dshres_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -4072,15 +4963,22 @@ static void lts_ecs_n_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -4112,15 +5010,22 @@ static void lts_ecs_dpf_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -4152,15 +5057,21 @@ static void lts_ecs_ehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -4192,15 +5103,21 @@ static void lts_ecs_ham_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offse
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	while (cnt < draw_end) {
@@ -4232,8 +5149,11 @@ static void lts_ecs_kehb_ishres_dshres_b2(int cnt, int draw_end, int hbstrt_offs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dshres_b2_filtered(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
@@ -4,10 +4,14 @@
 * This file was generated by genlinetoscr. Don't edit.
 */
 
-static void lts_ecs_n_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -40,15 +44,23 @@ static void lts_ecs_n_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -84,15 +96,23 @@ static void lts_ecs_dpf_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -130,15 +150,22 @@ static void lts_ecs_ehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -171,15 +198,22 @@ static void lts_ecs_ham_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -212,15 +246,22 @@ static void lts_ecs_kehb_ilores_dlores_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -255,11 +296,18 @@ static void lts_ecs_n_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -297,11 +345,19 @@ static void lts_ecs_n_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, i
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -339,11 +395,19 @@ static void lts_ecs_dpf_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -387,11 +451,19 @@ static void lts_ecs_dpf_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -431,11 +503,19 @@ static void lts_ecs_ehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -483,11 +563,18 @@ static void lts_ecs_ehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -522,11 +609,18 @@ static void lts_ecs_ham_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -564,11 +658,18 @@ static void lts_ecs_ham_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -603,11 +704,18 @@ static void lts_ecs_kehb_ihires_dlores_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -645,51 +753,58 @@ static void lts_ecs_kehb_ihires_dlores_b1_filtered_genlock(int cnt, int draw_end
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dlores_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dlores_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -730,15 +845,23 @@ static void lts_ecs_n_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -785,15 +908,23 @@ static void lts_ecs_dpf_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -844,15 +975,22 @@ static void lts_ecs_ehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -893,15 +1031,22 @@ static void lts_ecs_ham_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -942,15 +1087,22 @@ static void lts_ecs_kehb_ilores_dhires_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -983,15 +1135,23 @@ static void lts_ecs_n_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1027,15 +1187,23 @@ static void lts_ecs_dpf_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1073,15 +1241,22 @@ static void lts_ecs_ehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1114,15 +1289,22 @@ static void lts_ecs_ham_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1155,15 +1337,21 @@ static void lts_ecs_kehb_ihires_dhires_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1196,11 +1384,17 @@ static void lts_ecs_n_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1233,11 +1427,18 @@ static void lts_ecs_n_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, i
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1270,11 +1471,18 @@ static void lts_ecs_dpf_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1307,11 +1515,18 @@ static void lts_ecs_dpf_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1344,11 +1559,18 @@ static void lts_ecs_ehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1381,11 +1603,17 @@ static void lts_ecs_ehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1418,11 +1646,17 @@ static void lts_ecs_ham_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1455,11 +1689,17 @@ static void lts_ecs_ham_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1492,11 +1732,17 @@ static void lts_ecs_kehb_ishres_dhires_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1529,11 +1775,18 @@ static void lts_ecs_kehb_ishres_dhires_b1_filtered_genlock(int cnt, int draw_end
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1590,15 +1843,23 @@ static void lts_ecs_n_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1667,15 +1928,23 @@ static void lts_ecs_dpf_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1752,15 +2021,22 @@ static void lts_ecs_ehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1817,15 +2093,22 @@ static void lts_ecs_ham_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1882,15 +2165,22 @@ static void lts_ecs_kehb_ilores_dshres_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1931,15 +2221,23 @@ static void lts_ecs_n_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -1986,15 +2284,23 @@ static void lts_ecs_dpf_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2045,15 +2351,22 @@ static void lts_ecs_ehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2094,15 +2407,22 @@ static void lts_ecs_ham_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2143,15 +2463,21 @@ static void lts_ecs_kehb_ihires_dshres_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2185,15 +2511,22 @@ static void lts_ecs_n_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2227,15 +2560,22 @@ static void lts_ecs_dpf_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2269,15 +2609,21 @@ static void lts_ecs_ehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2311,15 +2657,21 @@ static void lts_ecs_ham_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2353,15 +2705,23 @@ static void lts_ecs_kehb_ishres_dshres_b1_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dshres_b1_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2397,15 +2757,25 @@ static void lts_ecs_n_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2444,15 +2814,25 @@ static void lts_ecs_dpf_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2493,15 +2873,24 @@ static void lts_ecs_ehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2537,15 +2926,24 @@ static void lts_ecs_ham_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2581,15 +2979,24 @@ static void lts_ecs_kehb_ilores_dlores_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2627,11 +3034,20 @@ static void lts_ecs_n_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2672,11 +3088,21 @@ static void lts_ecs_n_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, i
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2717,11 +3143,21 @@ static void lts_ecs_dpf_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2768,11 +3204,21 @@ static void lts_ecs_dpf_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2815,11 +3261,21 @@ static void lts_ecs_ehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2870,11 +3326,20 @@ static void lts_ecs_ehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2912,11 +3377,20 @@ static void lts_ecs_ham_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2957,11 +3431,20 @@ static void lts_ecs_ham_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -2999,11 +3482,20 @@ static void lts_ecs_kehb_ihires_dlores_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3044,51 +3536,60 @@ static void lts_ecs_kehb_ihires_dlores_b2_filtered_genlock(int cnt, int draw_end
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dlores_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dlores_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3134,15 +3635,25 @@ static void lts_ecs_n_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3194,15 +3705,25 @@ static void lts_ecs_dpf_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3258,15 +3779,24 @@ static void lts_ecs_ehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3312,15 +3842,24 @@ static void lts_ecs_ham_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3366,15 +3905,24 @@ static void lts_ecs_kehb_ilores_dhires_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3410,15 +3958,25 @@ static void lts_ecs_n_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3457,15 +4015,25 @@ static void lts_ecs_dpf_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3506,15 +4074,24 @@ static void lts_ecs_ehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3550,15 +4127,24 @@ static void lts_ecs_ham_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3594,15 +4180,23 @@ static void lts_ecs_kehb_ihires_dhires_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3638,11 +4232,19 @@ static void lts_ecs_n_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3678,11 +4280,20 @@ static void lts_ecs_n_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, i
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3718,11 +4329,20 @@ static void lts_ecs_dpf_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3758,11 +4378,20 @@ static void lts_ecs_dpf_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3798,11 +4427,20 @@ static void lts_ecs_ehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3838,11 +4476,19 @@ static void lts_ecs_ehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3878,11 +4524,19 @@ static void lts_ecs_ham_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3918,11 +4572,19 @@ static void lts_ecs_ham_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end,
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3958,11 +4620,19 @@ static void lts_ecs_kehb_ishres_dhires_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -3998,11 +4668,20 @@ static void lts_ecs_kehb_ishres_dhires_b2_filtered_genlock(int cnt, int draw_end
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4068,15 +4747,25 @@ static void lts_ecs_n_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4154,15 +4843,25 @@ static void lts_ecs_dpf_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4248,15 +4947,24 @@ static void lts_ecs_ehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4322,15 +5030,24 @@ static void lts_ecs_ham_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4396,15 +5113,24 @@ static void lts_ecs_kehb_ilores_dshres_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ilores_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4450,15 +5176,25 @@ static void lts_ecs_n_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4510,15 +5246,25 @@ static void lts_ecs_dpf_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4574,15 +5320,24 @@ static void lts_ecs_ehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4628,15 +5383,24 @@ static void lts_ecs_ham_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u16 *bplcoltable = fs->bplcoltable;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4682,15 +5446,23 @@ static void lts_ecs_kehb_ihires_dshres_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ihires_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_n_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4728,15 +5500,24 @@ static void lts_ecs_n_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_n_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_n_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_dpf_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	int *dpf_lookup = fs->dpf_lookup;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4774,15 +5555,24 @@ static void lts_ecs_dpf_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_dpf_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_dpf_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
+	uae_u8 bplehb_mask = fs->bplehb_mask;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4820,15 +5610,23 @@ static void lts_ecs_ehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ehb_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ehb_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_ham_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4866,15 +5664,23 @@ static void lts_ecs_ham_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbst
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_ham_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_ham_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
-static void lts_ecs_kehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	uae_u8 *cp = *cpp;
 	uae_u8 *cp2 = *cp2p;
+	uae_u32 *buf1 = fs->buf1;
+	uae_u32 *buf2 = fs->buf2;
+	uae_u8 *gbuf = fs->gbuf;
+	uae_u16 clxdat = 0;
 	uae_u32 *acolors = (uae_u32*)ls->linecolorstate;
 	uae_u16 *colors_ocs = (uae_u16*)(ls->linecolorstate + 256 * sizeof(uae_u32));
 	uae_u8 gpix = get_genlock_transparency_border_fast(ls->bplcon3);
@@ -4912,8 +5718,12 @@ static void lts_ecs_kehb_ishres_dshres_b2_genlock(int cnt, int draw_end, int hbs
 	}
 	*cpp = cp;
 	*cp2p = cp2;
+	fs->buf1 = buf1;
+	fs->buf2 = buf2;
+	fs->gbuf = gbuf;
+	fs->clxdat |= clxdat;
 }
-static void lts_ecs_kehb_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls)
+static void lts_ecs_kehb_ishres_dshres_b2_filtered_genlock(int cnt, int draw_end, int hbstrt_offset, int hbstop_offset, int hstrt_offset, int hstop_offset,int bpl1dat_trigger_offset, int planes, uae_u32 bgcolor, uae_u8 **cpp, uae_u8 **cp2p, int cpaddv, int *cpadds, int bufaddv, struct linestate *ls, struct fastline_state *fs)
 {
 	lts_null();
 }
@@ -47,6 +47,7 @@
 #include "jit/compemu.h"
 #endif
 #include "disasm.h"
+#include "cpubench.h"
 #ifdef RETROPLATFORM
 #include "rp.h"
 #endif
@@ -796,6 +797,11 @@ void fixup_prefs (struct uae_prefs *p, bool userconfig)
 	} else if (p->gfx_display_sections > 99) {
 		p->gfx_display_sections = 99;
 	}
+	if (p->gfx_denise_threads < 0) {
+		p->gfx_denise_threads = 0;
+	} else if (p->gfx_denise_threads > 8) {
+		p->gfx_denise_threads = 8;
+	}
 	if (p->maprom && !p->address_space_24) {
 		p->maprom = 0x0f000000;
 	}
@@ -814,6 +820,16 @@ void fixup_prefs (struct uae_prefs *p, bool userconfig)
 	if (p->x86_speed_throttle < 0)
 		p->x86_speed_throttle = 0;
 
+	// no display: unthrottled, no host sound output, no display sync
+	if (p->nodisplay) {
+		p->turbo_emulation = 1;
+		p->turbo_emulation_limit = 0;
+		if (p->produce_sound > 1)
+			p->produce_sound = 1;
+		p->gfx_apmode[0].gfx_vsync = 0;
+		p->gfx_apmode[1].gfx_vsync = 0;
+	}
+
 	built_in_chipset_prefs (p);
 	blkdev_fix_prefs (p);
 	inputdevice_fix_prefs(p, userconfig);
@@ -1007,6 +1023,20 @@ static void parse_cmdline (int argc, TCHAR **argv)
 		} else if (_tcscmp (argv[i], _T("-h")) == 0 || _tcscmp (argv[i], _T("-help")) == 0) {
 			usage ();
 			exit (0);
+		} else if (_tcsncmp (argv[i], _T("-cpubench="), 10) == 0) {
+			xfree (cpubench_file);
+			cpubench_file = parsetextpath (argv[i] + 10);
+		} else if (_tcscmp (argv[i], _T("-cpubench")) == 0) {
+			xfree (cpubench_file);
+			cpubench_file = my_strdup (_T(""));
+		} else if (_tcscmp (argv[i], _T("-nodisplay")) == 0) {
+			currprefs.nodisplay = true;
+		} else if (_tcsncmp (argv[i], _T("-soundsink="), 11) == 0) {
+			xfree (sound_sink_path);
+			sound_sink_path = parsetextpath (argv[i] + 11);
+		} else if (_tcscmp (argv[i], _T("-soundsink")) == 0) {
+			xfree (sound_sink_path);
+			sound_sink_path = my_strdup (_T(""));
 		} else if (_tcsncmp (argv[i], _T("-cdimage="), 9) == 0) {
 			TCHAR *txt = parsetextpath (argv[i] + 9);
 			TCHAR *txt2 = xmalloc(TCHAR, _tcslen(txt) + 2);
@@ -1128,6 +1158,7 @@ void do_start_program (void)
 		// EvalException does the good stuff...
 	}
 #endif
+	custom_nodisplay_report();
 }
 
 void start_program (void)
@@ -1140,6 +1171,9 @@ void leave_program (void)
 	do_leave_program ();
 }
 
+// process exit code, nonzero if -cpubench failed
+static int exit_code;
+
 static int real_main2 (int argc, TCHAR **argv)
 {
 
@@ -1183,7 +1217,7 @@ static int real_main2 (int argc, TCHAR **argv)
 	inputdevice_updateconfig(&currprefs, &changed_prefs);
 
 	no_gui = ! currprefs.start_gui;
-	if (restart_program == 2 || restart_program == 4)
+	if (restart_program == 2 || restart_program == 4 || cpubench_file || currprefs.nodisplay)
 		no_gui = 1;
 	else if (restart_program == 3)
 		no_gui = 0;
@@ -1265,6 +1299,12 @@ static int real_main2 (int argc, TCHAR **argv)
 	reset_frame_rate_hack ();
 	init_m68k (); /* must come after reset_frame_rate_hack (); */
 
+	if (cpubench_file) {
+		if (!cpubench_run ())
+			exit_code = 1;
+		return 0;
+	}
+
 	gui_update ();
 
 	if (graphics_init (true)) {
@@ -1285,9 +1325,10 @@ static int real_main2 (int argc, TCHAR **argv)
 	return 0;
 }
 
-void real_main (int argc, TCHAR **argv)
+int real_main (int argc, TCHAR **argv)
 {
 	restart_program = 1;
+	exit_code = 0;
 
 	fetch_configurationpath (restart_config, sizeof (restart_config) / sizeof (TCHAR));
 	_tcscat (restart_config, OPTIONSFILENAME);
@@ -1303,13 +1344,13 @@ void real_main (int argc, TCHAR **argv)
 		quit_program = 0;
 	}
 	zfile_exit ();
+	return exit_code;
 }
 
 #ifndef NO_MAIN_IN_MAIN_C
 int main (int argc, TCHAR **argv)
 {
-	real_main (argc, argv);
-	return 0;
+	return real_main (argc, argv);
 }
 #endif
 
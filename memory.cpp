@@ -93,6 +93,10 @@ static void nocanbang (void)
 
 uae_u8 ce_banktype[65536];
 uae_u8 ce_cachable[65536];
+/* host pointer bias per 64k bank, NULL if the bank can't be accessed directly */
+uae_u8 *mem_direct_r[MEMORY_BANKS];
+uae_u8 *mem_direct_w[MEMORY_BANKS];
+static void refresh_memory_direct(addrbank *ab);
 
 static size_t bootrom_filepos, chip_filepos, bogo_filepos, a3000lmem_filepos, a3000hmem_filepos, mem25bit_filepos;
 
@@ -845,6 +849,22 @@ void REGPARAM2 chipmem_agnus_wput (uaecptr addr, uae_u32 w)
 	do_put_mem_word (m, w);
 }
 
+/* Chip RAM size Agnus DMA can access without address wrapping or noise
+ * through the default accessors, 0 if they are replaced. */
+uae_u32 chipmem_agnus_linear_size (void)
+{
+	uae_u32 size;
+
+	if (chipmem_wget_indirect != chipmem_agnus_wget || chipmem_wput_indirect != chipmem_agnus_wput)
+		return 0;
+	size = chipmem_full_size;
+	if (size > chipmem_full_mask + 1)
+		size = chipmem_full_mask + 1;
+	if (size > chipmem_bank.allocated_size)
+		size = chipmem_bank.allocated_size;
+	return size & ~1;
+}
+
 static void REGPARAM2 chipmem_agnus_bput (uaecptr addr, uae_u32 b)
 {
 	addr &= chipmem_full_mask;
@@ -1070,6 +1090,7 @@ static void a1000_handle_kickstart (int mode)
 		kickstart_version = 0;
 		kickmem_bank.baseaddr_direct_r = NULL;
 	}
+	refresh_memory_direct(&kickmem_bank);
 	if (kickstart_version == 0xffff)
 		kickstart_version = 0;
 }
@@ -2170,6 +2191,31 @@ err:
 	return 0;
 }
 
+static void set_memory_direct(int bnr)
+{
+	addrbank *ab = mem_banks[bnr];
+	uaecptr addr = bnr << 16;
+
+	mem_direct_r[bnr] = NULL;
+	mem_direct_w[bnr] = NULL;
+	// whole 64k bank must map linearly to host memory
+	if ((ab->mask & 0xffff) != 0xffff || (ab->startaccessmask & 0xffff))
+		return;
+	if (ab->baseaddr_direct_r)
+		mem_direct_r[bnr] = ab->baseaddr_direct_r + ((addr - ab->startaccessmask) & ab->mask) - addr;
+	if (ab->baseaddr_direct_w)
+		mem_direct_w[bnr] = ab->baseaddr_direct_w + ((addr - ab->startaccessmask) & ab->mask) - addr;
+}
+
+// baseaddr_direct_r/w changed after bank was mapped
+static void refresh_memory_direct(addrbank *ab)
+{
+	for (int i = 0; i < MEMORY_BANKS; i++) {
+		if (mem_banks[i] == ab)
+			set_memory_direct(i);
+	}
+}
+
 static void set_direct_memory(addrbank *ab)
 {
 	if (!(ab->flags & ABFLAG_DIRECTACCESS))
@@ -2180,6 +2226,15 @@ static void set_direct_memory(addrbank *ab)
 	ab->baseaddr_direct_r = ab->baseaddr;
 	if (!(ab->flags & ABFLAG_ROM))
 		ab->baseaddr_direct_w = ab->baseaddr;
+	refresh_memory_direct(ab);
+}
+
+// bank memory is going away, drop direct access pointers
+void mapped_clear_direct(addrbank *ab)
+{
+	ab->baseaddr_direct_r = NULL;
+	ab->baseaddr_direct_w = NULL;
+	refresh_memory_direct(ab);
 }
 
 #ifndef NATMEM_OFFSET
@@ -2199,6 +2254,7 @@ bool mapped_malloc (addrbank *ab)
 
 void mapped_free (addrbank *ab)
 {
+	mapped_clear_direct(ab);
 	xfree(ab->baseaddr);
 	ab->flags &= ~ABFLAG_MAPPED;
 	ab->allocated_size = 0;
@@ -2330,6 +2386,7 @@ bool mapped_malloc (addrbank *ab)
 	ab->baseaddr_direct_r = NULL;
 	ab->baseaddr_direct_w = NULL;
 	ab->flags &= ~ABFLAG_MAPPED;
+	refresh_memory_direct(ab);
 
 	if (ab->label && ab->label[0] == '*') {
 		if (ab->start == 0 || ab->start == 0xffffffff) {
@@ -2450,6 +2507,7 @@ static void init_mem_banks (void)
 	// unsigned so i << 16 won't overflow to negative when i >= 32768
 	for (unsigned int i = 0; i < MEMORY_BANKS; i++) {
 		put_mem_bank (i << 16, &dummy_bank, 0);
+		set_memory_direct(i);
 	}
 #ifdef NATMEM_OFFSET
 	delete_shmmaps (0, 0xFFFF0000);
@@ -2736,6 +2794,7 @@ static void setmemorywidth(struct ramboard *mb, addrbank *ab)
 	if (mb->fault) {
 		ab->baseaddr_direct_w = NULL;
 		ab->baseaddr_direct_r = NULL;
+		refresh_memory_direct(ab);
 		ab->lput = &dummy_lput;
 		ab->wput = &dummy_wput;
 		ab->bput = &dummy_bput;
@@ -3629,6 +3688,7 @@ static void map_banks2 (addrbank *bank, int start, int size, int realsize, int q
 				thread_mem_banks[bnr] = orig_bank;
 			}
 #endif
+			set_memory_direct(bnr);
 			real_left--;
 		}
 #ifdef DEBUGGER
@@ -3663,6 +3723,7 @@ static void map_banks2 (addrbank *bank, int start, int size, int realsize, int q
 				thread_mem_banks[bnr + hioffs] = orig_bank;
 			}
 #endif
+			set_memory_direct(bnr + hioffs);
 			real_left--;
 		}
 	}
@@ -143,8 +143,8 @@ static uae_u32 fake_tt0_030, fake_tt1_030, fake_tc_030;
 static uae_u16 fake_mmusr_030;
 
 static struct cache020 caches020[CACHELINES020];
-static struct cache030 icaches030[CACHELINES030];
-static struct cache030 dcaches030[CACHELINES030];
+static struct cache030 icaches030;
+static struct cache030 dcaches030;
 static int icachelinecnt, icachehalfline;
 static int dcachelinecnt;
 static struct cache040 icaches040[CACHESETS060];
@@ -1525,12 +1525,7 @@ bool set_cpu_tracer (bool state)
 static void invalidate_cpu_data_caches(void)
 {
 	if (currprefs.cpu_model == 68030) {
-		for (int i = 0; i < CACHELINES030; i++) {
-			dcaches030[i].valid[0] = 0;
-			dcaches030[i].valid[1] = 0;
-			dcaches030[i].valid[2] = 0;
-			dcaches030[i].valid[3] = 0;
-		}
+		memset(dcaches030.valid, 0, sizeof dcaches030.valid);
 	} else if (currprefs.cpu_model >= 68040) {
 		dcachelinecnt = 0;
 		for (int i = 0; i < CACHESETS060; i++) {
@@ -1572,12 +1567,7 @@ void flush_cpu_caches(bool force)
 	} else if (currprefs.cpu_model == 68030) {
 		if ((regs.cacr & 0x08) || force) { // clear instr cache
 			if (doflush) {
-				for (int i = 0; i < CACHELINES030; i++) {
-					icaches030[i].valid[0] = 0;
-					icaches030[i].valid[1] = 0;
-					icaches030[i].valid[2] = 0;
-					icaches030[i].valid[3] = 0;
-				}
+				memset(icaches030.valid, 0, sizeof icaches030.valid);
 			}
 			regs.cacr &= ~0x08;
 #ifdef DEBUGGER
@@ -1585,7 +1575,7 @@ void flush_cpu_caches(bool force)
 #endif
 		}
 		if (regs.cacr & 0x04) { // clear entry in instr cache
-			icaches030[(regs.caar >> 4) & (CACHELINES030 - 1)].valid[(regs.caar >> 2) & 3] = 0;
+			icaches030.valid[(regs.caar >> 4) & (CACHELINES030 - 1)] &= ~(1 << ((regs.caar >> 2) & 3));
 			regs.cacr &= ~0x04;
 #ifdef DEBUGGER
 			flush_cpu_cache_debug(regs.caar, CACHELINES030);
@@ -1593,17 +1583,12 @@ void flush_cpu_caches(bool force)
 		}
 		if ((regs.cacr & 0x800) || force) { // clear data cache
 			if (doflush) {
-				for (int i = 0; i < CACHELINES030; i++) {
-					dcaches030[i].valid[0] = 0;
-					dcaches030[i].valid[1] = 0;
-					dcaches030[i].valid[2] = 0;
-					dcaches030[i].valid[3] = 0;
-				}
+				memset(dcaches030.valid, 0, sizeof dcaches030.valid);
 			}
 			regs.cacr &= ~0x800;
 		}
 		if (regs.cacr & 0x400) { // clear entry in data cache
-			dcaches030[(regs.caar >> 4) & (CACHELINES030 - 1)].valid[(regs.caar >> 2) & 3] = 0;
+			dcaches030.valid[(regs.caar >> 4) & (CACHELINES030 - 1)] &= ~(1 << ((regs.caar >> 2) & 3));
 			regs.cacr &= ~0x400;
 		}
 	} else if (currprefs.cpu_model >= 68040) {
@@ -1774,7 +1759,7 @@ void cpu_invalidate_cache(uaecptr addr, int size)
 		uaecptr end = addr + size;
 		addr &= ~3;
 		while (addr < end) {
-			dcaches030[(addr >> 4) & (CACHELINES030 - 1)].valid[(addr >> 2) & 3] = 0;
+			dcaches030.valid[(addr >> 4) & (CACHELINES030 - 1)] &= ~(1 << ((addr >> 2) & 3));
 			addr += 4;
 		}
 	} else if (currprefs.cpu_model >= 68040) {
@@ -1889,6 +1874,9 @@ const struct cputbl *getjitcputbl(int cpulvl, int direct)
 
 #endif
 
+// forced cputbls[] column, used by the headless core benchmark
+static int cpufunctbl_force_mode = -1;
+
 static void build_cpufunctbl (void)
 {
 	int i, opcnt;
@@ -1897,7 +1885,10 @@ static void build_cpufunctbl (void)
 	int lvl, mode, jit;
 
 	jit = 0;
-	if (!currprefs.cachesize) {
+	if (cpufunctbl_force_mode >= 0) {
+		mode = cpufunctbl_force_mode;
+		m68k_pc_indirect = mode >= 2 ? 1 : 0;
+	} else if (!currprefs.cachesize) {
 		if (currprefs.mmu_model) {
 			if (currprefs.cpu_cycle_exact)
 				mode = 7;
@@ -5512,12 +5503,15 @@ void execute_normal(void)
 	int blocklen;
 	cpu_history pc_hist[MAXRUN];
 	int total_cycles;
+	int trace_exits;
+	bool endblock;
 
 	if (check_for_cache_miss ())
 		return;
 
 	total_cycles = 0;
 	blocklen = 0;
+	trace_exits = 0;
 	start_pc_p = r->pc_oldp;
 	start_pc = r->pc;
 	for (;;) {
@@ -5539,7 +5533,15 @@ void execute_normal(void)
 
 		pc_hist[blocklen].specmem = special_mem;
 		blocklen++;
-		if (end_block (r->opcode) || blocklen >= MAXRUN || r->spcflags || uae_int_requested) {
+		endblock = end_block (r->opcode);
+		if (endblock && currprefs.comp_trace && is_trace_branch (r->opcode) && trace_exits < MAXTRACEEXITS &&
+			(uae_u8*)r->pc_p > (uae_u8*)pc_hist[blocklen - 1].location) {
+			/* Forward conditional branch: continue the trace in the direction
+			 * taken now, the other direction becomes a side exit. */
+			trace_exits++;
+			endblock = false;
+		}
+		if (endblock || blocklen >= MAXRUN || r->spcflags || uae_int_requested) {
 			compile_block (pc_hist, blocklen, total_cycles);
 			return; /* We will deal with the spcflags in the caller */
 		}
@@ -6520,6 +6522,76 @@ static void m68k_run_mmu (void)
 
 #endif /* CPUEMU_0 */
 
+/* Headless core benchmark support (cpubench.cpp).
+ * Selects cputbls[][mode] for the CPU/FPU/MMU in changed_prefs and
+ * executes instructions without running the chipset or events.
+ */
+void cpu_benchmark_core(int mode)
+{
+	regs.itt0 = regs.itt1 = regs.dtt0 = regs.dtt1 = 0;
+	regs.tcr = 0;
+	cpufunctbl_force_mode = mode;
+	prefs_changed_cpu();
+	fpu_modechange();
+	build_cpufunctbl();
+	set_x_funcs();
+	cpufunctbl_force_mode = -1;
+#ifdef FPUEMU
+	fpu_reset();
+#endif
+	regs.spcflags = 0;
+	regs.halted = 0;
+	regs.stopped = 0;
+	mmufixup[0].reg = -1;
+	mmufixup[1].reg = -1;
+	mmu030_opcode_stageb = -1;
+	mmu030_fake_prefetch = -1;
+}
+
+// Returns number of executed instructions, stops early if PC reaches endpc.
+// Negative if an exception was raised.
+uae_s64 cpu_benchmark_run(uae_s64 count, uaecptr endpc)
+{
+	struct regstruct *r = &regs;
+	uae_s64 cnt = 0;
+
+	TRY(prb) {
+		if (currprefs.mmu_model == 68030) {
+			while (cnt < count && m68k_getpc() != endpc) {
+				r->instruction_pc = m68k_getpc();
+				mmu030_state[0] = mmu030_state[1] = mmu030_state[2] = 0;
+				mmu030_opcode = r->opcode = r->irc = x_prefetch(0);
+				mmu030_idx = mmu030_idx_done = 0;
+				mmu030_retry = false;
+				(*cpufunctbl[r->opcode])(r->opcode);
+				mmu030_opcode = -1;
+				cnt++;
+			}
+		} else if (currprefs.mmu_model) {
+			while (cnt < count && m68k_getpc() != endpc) {
+				r->instruction_pc = m68k_getpc();
+				mmu_restart = true;
+				if (currprefs.cpu_model == 68060)
+					mmu060_state = 1;
+				mmu_opcode = r->opcode = x_prefetch(0);
+				(*cpufunctbl[r->opcode])(r->opcode);
+				cnt++;
+			}
+		} else {
+			while (cnt < count && m68k_getpc() != endpc) {
+				r->instruction_pc = m68k_getpc();
+				r->opcode = x_get_iword(0);
+				(*cpufunctbl[r->opcode])(r->opcode);
+				cnt++;
+			}
+		}
+	} CATCH(prb) {
+		write_log(_T("CPUBENCH: exception %d at %08x after %lld instructions\n"), prb, regs.instruction_pc, cnt);
+		cnt = -1;
+	} ENDTRY
+	return cnt;
+}
+
 int in_m68k_go = 0;
 
 #if 0
@@ -6942,20 +7014,20 @@ void m68k_dumpcache (bool dc)
 			console_out_f (_T("\n"));
 		}
 	} else if (currprefs.cpu_model == 68030) {
+		struct cache030 *c = dc ? &dcaches030 : &icaches030;
 		for (int i = 0; i < CACHELINES030; i++) {
-			struct cache030 *c = dc ? &dcaches030[i] : &icaches030[i];
 			int fc;
 			uaecptr addr;
 			if (!dc) {
-				fc = (c->tag & 1) ? 6 : 2;
+				fc = (c->tag[i] & 1) ? 6 : 2;
 			} else {
-				fc = c->fc;
+				fc = c->fc[i];
 			}
-			addr = c->tag & ~1;
+			addr = c->tag[i] & ~1;
 			addr |= i << 4;
 			console_out_f (_T("%08X %d: "), addr, fc);
 			for (int j = 0; j < 4; j++) {
-				console_out_f (_T("%08X%c "), c->data[j], c->valid[j] ? '*' : ' ');
+				console_out_f (_T("%08X%c "), c->data[i][j], (c->valid[i] & (1 << j)) ? '*' : ' ');
 			}
 			console_out_f (_T("\n"));
 		}
@@ -7093,18 +7165,22 @@ uae_u8 *restore_cpu (uae_u8 *src)
 			}
 		} else if (model == 68030) {
 			for (int i = 0; i < CACHELINES030; i++) {
+				icaches030.valid[i] = 0;
 				for (int j = 0; j < 4; j++) {
-					icaches030[i].data[j] = restore_u32 ();
-					icaches030[i].valid[j] = restore_u8 () != 0;
+					icaches030.data[i][j] = restore_u32 ();
+					if (restore_u8 ())
+						icaches030.valid[i] |= 1 << j;
 				}
-				icaches030[i].tag = restore_u32 ();
+				icaches030.tag[i] = restore_u32 ();
 			}
 			for (int i = 0; i < CACHELINES030; i++) {
+				dcaches030.valid[i] = 0;
 				for (int j = 0; j < 4; j++) {
-					dcaches030[i].data[j] = restore_u32 ();
-					dcaches030[i].valid[j] = restore_u8 () != 0;
+					dcaches030.data[i][j] = restore_u32 ();
+					if (restore_u8 ())
+						dcaches030.valid[i] |= 1 << j;
 				}
-				dcaches030[i].tag = restore_u32 ();
+				dcaches030.tag[i] = restore_u32 ();
 			}
 			regs.prefetch020addr = restore_u32 ();
 			regs.cacheholdingaddr020 = restore_u32 ();
@@ -7566,17 +7642,17 @@ uae_u8 *save_cpu(size_t *len, uae_u8 *dstptr)
 	} else if (model == 68030) {
 		for (int i = 0; i < CACHELINES030; i++) {
 			for (int j = 0; j < 4; j++) {
-				save_u32 (icaches030[i].data[j]);
-				save_u8 (icaches030[i].valid[j] ? 1 : 0);
+				save_u32 (icaches030.data[i][j]);
+				save_u8 ((icaches030.valid[i] >> j) & 1);
 			}
-			save_u32 (icaches030[i].tag);
+			save_u32 (icaches030.tag[i]);
 		}
 		for (int i = 0; i < CACHELINES030; i++) {
 			for (int j = 0; j < 4; j++) {
-				save_u32 (dcaches030[i].data[j]);
-				save_u8 (dcaches030[i].valid[j] ? 1 : 0);
+				save_u32 (dcaches030.data[i][j]);
+				save_u8 ((dcaches030.valid[i] >> j) & 1);
 			}
-			save_u32 (dcaches030[i].tag);
+			save_u32 (dcaches030.tag[i]);
 		}
 		save_u32 (regs.prefetch020addr);
 		save_u32 (regs.cacheholdingaddr020);
@@ -8598,72 +8674,81 @@ void mem_access_delay_long_write_ce020 (uaecptr addr, uae_u32 v)
 
 // 68030 caches aren't so simple as 68020 cache..
 
-STATIC_INLINE struct cache030 *geticache030 (struct cache030 *cp, uaecptr addr, uae_u32 *tagp, int *lwsp)
+// Returns line index
+STATIC_INLINE int geticache030 (uaecptr addr, uae_u32 *tagp, int *lwsp)
 {
-	int index, lws;
-	uae_u32 tag;
-	struct cache030 *c;
-
 	addr &= ~3;
-	index = (addr >> 4) & (CACHELINES030 - 1);
-	tag = regs.s | (addr & ~((CACHELINES030 << 4) - 1));
-	lws = (addr >> 2) & 3;
-	c = &cp[index];
-	*tagp = tag;
-	*lwsp = lws;
-	return c;
+	*tagp = regs.s | (addr & ~((CACHELINES030 << 4) - 1));
+	*lwsp = (addr >> 2) & 3;
+	return (addr >> 4) & (CACHELINES030 - 1);
 }
 
-STATIC_INLINE void update_icache030 (struct cache030 *c, uae_u32 val, uae_u32 tag, int lws)
+STATIC_INLINE bool icache030_hit (int index, uae_u32 tag, int lws)
 {
-	if (c->tag != tag)
-		c->valid[0] = c->valid[1] = c->valid[2] = c->valid[3] = false;
-	c->tag = tag;
-	c->valid[lws] = true;
-	c->data[lws] = val;
+	return icaches030.tag[index] == tag && (icaches030.valid[index] & (1 << lws));
 }
 
-STATIC_INLINE struct cache030 *getdcache030 (struct cache030 *cp, uaecptr addr, uae_u32 *tagp, int *lwsp)
+STATIC_INLINE void update_icache030 (int index, uae_u32 val, uae_u32 tag, int lws)
 {
-	int index, lws;
-	uae_u32 tag;
-	struct cache030 *c;
+	if (icaches030.tag[index] != tag)
+		icaches030.valid[index] = 0;
+	icaches030.tag[index] = tag;
+	icaches030.valid[index] |= 1 << lws;
+	icaches030.data[index][lws] = val;
+}
 
+STATIC_INLINE int getdcache030 (uaecptr addr, uae_u32 *tagp, int *lwsp)
+{
 	addr &= ~3;
-	index = (addr >> 4) & (CACHELINES030 - 1);
-	tag = addr & ~((CACHELINES030 << 4) - 1);
-	lws = (addr >> 2) & 3;
-	c = &cp[index];
-	*tagp = tag;
-	*lwsp = lws;
-	return c;
+	*tagp = addr & ~((CACHELINES030 << 4) - 1);
+	*lwsp = (addr >> 2) & 3;
+	return (addr >> 4) & (CACHELINES030 - 1);
 }
 
-STATIC_INLINE void update_dcache030 (struct cache030 *c, uae_u32 val, uae_u32 tag, uae_u8 fc, int lws)
+STATIC_INLINE bool dcache030_hit (int index, uae_u32 tag, uae_u32 fc, int lws)
 {
-	if (c->tag != tag)
-		c->valid[0] = c->valid[1] = c->valid[2] = c->valid[3] = false;
-	c->tag = tag;
-	c->fc = fc;
-	c->valid[lws] = true;
-	c->data[lws] = val;
+	return dcaches030.tag[index] == tag && dcaches030.fc[index] == fc && (dcaches030.valid[index] & (1 << lws));
+}
+
+STATIC_INLINE void update_dcache030 (int index, uae_u32 val, uae_u32 tag, uae_u8 fc, int lws)
+{
+	if (dcaches030.tag[index] != tag)
+		dcaches030.valid[index] = 0;
+	dcaches030.tag[index] = tag;
+	dcaches030.fc[index] = fc;
+	dcaches030.valid[index] |= 1 << lws;
+	dcaches030.data[index][lws] = val;
+}
+
+// Burst fill of the remaining three line slots following slot lws
+static void burst_cache030 (struct cache030 *c, int index, uaecptr baddr, int lws, bool ins)
+{
+	int i = lws;
+	for (int j = 0; j < 3; j++) {
+		i++;
+		i &= 3;
+		c->data[index][i] = ins ? get_longi(baddr + i * 4) : get_long(baddr + i * 4);
+		c->valid[index] |= 1 << i;
+
+		if (currprefs.cpu_cycle_exact)
+			do_cycles_ce020_mem(1 * (CPU020_MEM_CYCLE - 1), c->data[index][i]);
+	}
 }
 
 static bool maybe_icache030(uae_u32 addr)
 {
-	int lws;
+	int lws, index;
 	uae_u32 tag;
-	struct cache030 *c;
 
 	regs.fc030 = (regs.s ? 4 : 0) | 2;
 	addr &= ~3;
 	if (regs.cacheholdingaddr020 == addr || regs.cacheholdingdata_valid == 0)
 		return true;
-	c = geticache030(icaches030, addr, &tag, &lws);
-	if ((regs.cacr & 1) && c->valid[lws] && c->tag == tag) {
+	index = geticache030(addr, &tag, &lws);
+	if ((regs.cacr & 1) && icache030_hit(index, tag, lws)) {
 		// cache hit
 		regs.cacheholdingaddr020 = addr;
-		regs.cacheholdingdata020 = c->data[lws];
+		regs.cacheholdingdata020 = icaches030.data[index][lws];
 		return true;
 	}
 	return false;
@@ -8671,20 +8756,19 @@ static bool maybe_icache030(uae_u32 addr)
 
 static void fill_icache030(uae_u32 addr)
 {
-	int lws;
+	int lws, index;
 	uae_u32 tag;
 	uae_u32 data;
-	struct cache030 *c;
 
 	regs.fc030 = (regs.s ? 4 : 0) | 2;
 	addr &= ~3;
 	if (regs.cacheholdingaddr020 == addr || regs.cacheholdingdata_valid == 0)
 		return;
-	c = geticache030 (icaches030, addr, &tag, &lws);
-	if ((regs.cacr & 1) && c->valid[lws] && c->tag == tag) {
+	index = geticache030 (addr, &tag, &lws);
+	if ((regs.cacr & 1) && icache030_hit(index, tag, lws)) {
 		// cache hit
 		regs.cacheholdingaddr020 = addr;
-		regs.cacheholdingdata020 = c->data[lws];
+		regs.cacheholdingdata020 = icaches030.data[index][lws];
 		return;
 	}
 
@@ -8711,7 +8795,7 @@ static void fill_icache030(uae_u32 addr)
 	if (mmu030_cache_state & CACHE_ENABLE_INS) {
 		if ((regs.cacr & 0x03) == 0x01) {
 			// instruction cache not frozen and enabled
-			update_icache030 (c, data, tag, lws);
+			update_icache030 (index, data, tag, lws);
 		}
 
 		// Do burst fetch if enabled, cache is not frozen, all line slots invalid, and 32-bit CPU local bus (no chip ram).
@@ -8722,45 +8806,25 @@ static void fill_icache030(uae_u32 addr)
 		// is generated and the remaining cache line slots are left invalid.
 		//
 		if ((mmu030_cache_state & CACHE_ENABLE_INS_BURST) && (regs.cacr & 0x11) == 0x11) {
-			if (c->valid[0] + c->valid[1] + c->valid[2] + c->valid[3] == 1) {
+			// only the slot filled above is valid?
+			if (icaches030.valid[index] == (1 << lws)) {
 				uaecptr physaddr = addr;
 				if (currprefs.mmu_model) {
 					physaddr = mmu030_translate(addr, regs.s != 0, false, false);
 				}
 
 				if (ce_banktype[physaddr >> 16] == CE_MEMBANK_FAST32) {
-					int i;
-					for (i = 0; i < 4; i++) {
-						if (c->valid[i])
-							break;
-					}
 					uaecptr baddr = physaddr & ~15;
 
 					if (currprefs.mmu_model) {
 						TRY (prb) {
 							// TODO: Need memory functions for burst row and burst column access.
-							for (int j = 0; j < 3; j++) {
-								i++;
-								i &= 3;
-								c->data[i] = get_longi(baddr + i * 4);
-								c->valid[i] = true;
-
-								if (currprefs.cpu_cycle_exact)
-									do_cycles_ce020_mem(1 * (CPU020_MEM_CYCLE - 1), c->data[i]);
-							}
+							burst_cache030(&icaches030, index, baddr, lws, true);
 						} CATCH (prb) {
 							; // abort burst fetch if bus error, do not report it.
 						} ENDTRY
 					} else {
-						for (int j = 0; j < 3; j++) {
-							i++;
-							i &= 3;
-							c->data[i] = get_longi(baddr + i * 4);
-							c->valid[i] = true;
-
-							if (currprefs.cpu_cycle_exact)
-								do_cycles_ce020_mem(1 * (CPU020_MEM_CYCLE - 1), c->data[i]);
-						}
+						burst_cache030(&icaches030, index, baddr, lws, true);
 					}
 				}
 			}
@@ -8774,14 +8838,13 @@ static void fill_icache030(uae_u32 addr)
 static void validate_dcache030(void)
 {
 	for (int i = 0; i < CACHELINES030; i++) {
-		struct cache030 *c = &dcaches030[i];
-		uae_u32 addr = c->tag & ~((CACHELINES030 << 4) - 1);
+		uae_u32 addr = dcaches030.tag[i] & ~((CACHELINES030 << 4) - 1);
 		addr |= i << 4;
 		for (int j = 0; j < 4; j++) {
-			if (c->valid[j]) {
+			if (dcaches030.valid[i] & (1 << j)) {
 				uae_u32 v = get_long(addr);
-				if (v != c->data[j]) {
-					write_log(_T("Address %08x data cache mismatch %08x != %08x\n"), addr, v, c->data[j]);
+				if (v != dcaches030.data[i][j]) {
+					write_log(_T("Address %08x data cache mismatch %08x != %08x\n"), addr, v, dcaches030.data[i][j]);
 				}
 			}
 			addr += 4;
@@ -8812,7 +8875,7 @@ static void write_dcache030x(uaecptr addr, uae_u32 val, uae_u32 size, uae_u32 fc
 {
 	if (regs.cacr & 0x100) {
 		static const uae_u32 mask[3] = { 0xff000000, 0xffff0000, 0xffffffff };
-		struct cache030 *c1, *c2;
+		int c1, c2;
 		int lws1, lws2;
 		uae_u32 tag1, tag2;
 		int aligned = addr & 3;
@@ -8821,8 +8884,8 @@ static void write_dcache030x(uaecptr addr, uae_u32 val, uae_u32 size, uae_u32 fc
 		int offset = 8 * aligned;
 		int hit;
 
-		c1 = getdcache030(dcaches030, addr, &tag1, &lws1);
-		hit = c1->tag == tag1 && c1->fc == fc && c1->valid[lws1];
+		c1 = getdcache030(addr, &tag1, &lws1);
+		hit = dcache030_hit(c1, tag1, fc, lws1);
 
 		// Write-allocate can create new valid cache entry if
 		// long aligned long write and MMU CI is not active.
@@ -8837,7 +8900,7 @@ static void write_dcache030x(uaecptr addr, uae_u32 val, uae_u32 size, uae_u32 fc
 #endif
 			} else if (hit) {
 				// Does real 68030 do this if MMU cache inhibited?
-				c1->valid[lws1] = false;
+				dcaches030.valid[c1] &= ~(1 << lws1);
 			}
 			return;
 		}
@@ -8845,23 +8908,23 @@ static void write_dcache030x(uaecptr addr, uae_u32 val, uae_u32 size, uae_u32 fc
 		if (hit || wa) {
 			if (hit) {
 				uae_u32 val_left_aligned = val << (32 - width);
-				c1->data[lws1] &= ~(mask[size] >> offset);
-				c1->data[lws1] |= val_left_aligned >> offset;
+				dcaches030.data[c1][lws1] &= ~(mask[size] >> offset);
+				dcaches030.data[c1][lws1] |= val_left_aligned >> offset;
 			} else {
-				c1->valid[lws1] = false;
+				dcaches030.valid[c1] &= ~(1 << lws1);
 			}
 		}
 
 		// do we need to update a 2nd cache entry ?
 		if (width + offset > 32) {
-			c2 = getdcache030(dcaches030, addr + 4, &tag2, &lws2);
-			hit = c2->tag == tag2 && c2->fc == fc && c2->valid[lws2];
+			c2 = getdcache030(addr + 4, &tag2, &lws2);
+			hit = dcache030_hit(c2, tag2, fc, lws2);
 			if (hit || wa) {
 				if (hit) {
-					c2->data[lws2] &= 0xffffffff >> (width + offset - 32);
-					c2->data[lws2] |= val << (32 - (width + offset - 32));
+					dcaches030.data[c2][lws2] &= 0xffffffff >> (width + offset - 32);
+					dcaches030.data[c2][lws2] |= val << (32 - (width + offset - 32));
 				} else {
-					c2->valid[lws2] = false;
+					dcaches030.valid[c2] &= ~(1 << lws2);
 				}
 			}
 		}
@@ -8898,49 +8961,28 @@ void write_dcache030_retry(uaecptr addr, uae_u32 v, uae_u32 fc, int size, int fl
 	write_dcache030x(addr, v, size, fc);
 }
 
-static void dcache030_maybe_burst(uaecptr addr, struct cache030 *c, int lws)
+static void dcache030_maybe_burst(uaecptr addr, int index, int lws)
 {
 	// Do burst fetch if enabled, cache not frozen, all line slots invalid, and 32-bit CPU local bus (no chip ram).
 	// (See notes about burst fetches in icache routines)
-	if (c->valid[0] + c->valid[1] + c->valid[2] + c->valid[3] == 1) {
+	if (dcaches030.valid[index] == (1 << lws)) {
 		uaecptr physaddr = addr;
 		if (currprefs.mmu_model) {
 			physaddr = mmu030_translate(addr, regs.s != 0, false, false);
 		}
 
 		if (ce_banktype[physaddr >> 16] == CE_MEMBANK_FAST32) {
-			int i;
-			for (i = 0; i < 4; i++) {
-				if (c->valid[i])
-					break;
-			}
 			uaecptr baddr = physaddr & ~15;
 
 			if (currprefs.mmu_model) {
 				TRY (prb) {
 					// TODO: Need memory functions for burst row and burst column access.
-					for (int j = 0; j < 3; j++) {
-						i++;
-						i &= 3;
-						c->data[i] = get_long(baddr + i * 4);
-						c->valid[i] = true;
-
-						if (currprefs.cpu_cycle_exact)
-							do_cycles_ce020_mem(1 * (CPU020_MEM_CYCLE - 1), c->data[i]);
-					}
+					burst_cache030(&dcaches030, index, baddr, lws, false);
 				} CATCH (prb) {
 					; // abort burst fetch if bus error
 				} ENDTRY
 			} else {
-				for (int j = 0; j < 3; j++) {
-					i++;
-					i &= 3;
-					c->data[i] = get_long(baddr + i * 4);
-					c->valid[i] = true;
-
-					if (currprefs.cpu_cycle_exact)
-						do_cycles_ce020_mem(1 * (CPU020_MEM_CYCLE - 1), c->data[i]);
-				}
+				burst_cache030(&dcaches030, index, baddr, lws, false);
 			}
 		}
 #if VALIDATE_68030_DATACACHE
@@ -8953,7 +8995,7 @@ static void dcache030_maybe_burst(uaecptr addr, struct cache030 *c, int lws)
 static uae_u32 read_dcache030_debug(uaecptr addr, uae_u32 size, uae_u32 fc, bool *cached)
 {
 	static const uae_u32 mask[3] = { 0x000000ff, 0x0000ffff, 0xffffffff };
-	struct cache030 *c1, *c2;
+	int c1, c2;
 	int lws1, lws2;
 	uae_u32 tag1, tag2;
 	int aligned = addr & 3;
@@ -8971,13 +9013,13 @@ static uae_u32 read_dcache030_debug(uaecptr addr, uae_u32 size, uae_u32 fc, bool
 		return get_long_debug(addr);
 	}
 
-	c1 = getdcache030(dcaches030, addr, &tag1, &lws1);
+	c1 = getdcache030(addr, &tag1, &lws1);
 	addr &= ~3;
-	if (!c1->valid[lws1] || c1->tag != tag1 || c1->fc != fc) {
+	if (!dcache030_hit(c1, tag1, fc, lws1)) {
 		v1 = get_long_debug(addr);
 	} else {
 		// Cache hit, inhibited caching do not prevent read hits.
-		v1 = c1->data[lws1];
+		v1 = dcaches030.data[c1][lws1];
 		*cached = true;
 	}
 
@@ -8990,11 +9032,11 @@ static uae_u32 read_dcache030_debug(uaecptr addr, uae_u32 size, uae_u32 fc, bool
 
 	// no, need another one
 	addr += 4;
-	c2 = getdcache030(dcaches030, addr, &tag2, &lws2);
-	if (!c2->valid[lws2] || c2->tag != tag2 || c2->fc != fc) {
+	c2 = getdcache030(addr, &tag2, &lws2);
+	if (!dcache030_hit(c2, tag2, fc, lws2)) {
 		v2 = get_long_debug(addr);
 	} else {
-		v2 = c2->data[lws2];
+		v2 = dcaches030.data[c2][lws2];
 		*cached = true;
 	}
 
@@ -9014,7 +9056,7 @@ static bool read_dcache030_2(uaecptr addr, uae_u32 size, uae_u32 *valp)
 	uae_u32 addr_o = addr;
 	uae_u32 fc = regs.fc030;
 	static const uae_u32 mask[3] = { 0x000000ff, 0x0000ffff, 0xffffffff };
-	struct cache030 *c1, *c2;
+	int c1, c2;
 	int lws1, lws2;
 	uae_u32 tag1, tag2;
 	int aligned = addr & 3;
@@ -9023,9 +9065,9 @@ static bool read_dcache030_2(uaecptr addr, uae_u32 size, uae_u32 *valp)
 	int offset = 8 * aligned;
 	uae_u32 out;
 
-	c1 = getdcache030(dcaches030, addr, &tag1, &lws1);
+	c1 = getdcache030(addr, &tag1, &lws1);
 	addr &= ~3;
-	if (!c1->valid[lws1] || c1->tag != tag1 || c1->fc != fc) {
+	if (!dcache030_hit(c1, tag1, fc, lws1)) {
 		// MMU validate address, returns zero if valid but uncacheable
 		// throws bus error if invalid
 		uae_u8 cs = dcache_check(addr_o, false, size);
@@ -9040,7 +9082,7 @@ static bool read_dcache030_2(uaecptr addr, uae_u32 size, uae_u32 *valp)
 #endif
 	} else {
 		// Cache hit, inhibited caching do not prevent read hits.
-		v1 = c1->data[lws1];
+		v1 = dcaches030.data[c1][lws1];
 	}
 
 	// only one long fetch needed?
@@ -9056,8 +9098,8 @@ static bool read_dcache030_2(uaecptr addr, uae_u32 size, uae_u32 *valp)
 
 	// no, need another one
 	addr += 4;
-	c2 = getdcache030(dcaches030, addr, &tag2, &lws2);
-	if (!c2->valid[lws2] || c2->tag != tag2 || c2->fc != fc) {
+	c2 = getdcache030(addr, &tag2, &lws2);
+	if (!dcache030_hit(c2, tag2, fc, lws2)) {
 		uae_u8 cs = dcache_check(addr, false, 2);
 		if (!(cs & CACHE_ENABLE_DATA))
 			return false;
@@ -9069,7 +9111,7 @@ static bool read_dcache030_2(uaecptr addr, uae_u32 size, uae_u32 *valp)
 		validate_dcache030();
 #endif
 	} else {
-		v2 = c2->data[lws2];
+		v2 = dcaches030.data[c2][lws2];
 	}
 
 	uae_u64 v64 = ((uae_u64)v1 << 32) | v2;
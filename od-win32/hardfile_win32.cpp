@@ -54,6 +54,11 @@ struct hardfilehandle
 	BOOL firstwrite;
 	HANDLE locked_volumes[MAX_LOCKED_VOLUMES];
 	bool dismounted;
+	HANDLE maph;
+	uae_u8 *map;
+	uae_u64 mapsize;
+	bool mapdirty;
+	bool mapbypass;
 };
 
 struct uae_driveinfo {
@@ -2035,6 +2040,8 @@ static void lock_drive(struct hardfiledata *hfd, const TCHAR *name, HANDLE drvha
 	}
 }
 
+static bool hdf_map (struct hardfiledata *hfd);
+
 int hdf_open_target (struct hardfiledata *hfd, const TCHAR *pname)
 {
 	HANDLE h = INVALID_HANDLE_VALUE;
@@ -2282,6 +2289,8 @@ emptyreal:
 				zfile_fseek (hfd->handle->zf, 0, SEEK_SET);
 				hfd->handle_valid = HDF_HANDLE_ZFILE;
 			}
+			if (hfd->handle_valid == HDF_HANDLE_WIN32_NORMAL && currprefs.hardfile_mmap)
+				hdf_map (hfd);
 		} else {
 			DWORD err = GetLastError ();
 			if (err == ERROR_WRITE_PROTECT)
@@ -2302,10 +2311,132 @@ end:
 	return ret;
 }
 
+/* Plain image files can be mapped to memory (hardfile_mmap). Reads are
+ * then a single memcpy() from the view to the request buffer, which is
+ * Amiga RAM when cmd_read() can address it directly. Writes go to the view
+ * and are flushed to disk when the Amiga side asks for it (CMD_UPDATE,
+ * SYNCHRONIZE CACHE, FLUSH CACHE) and when the image is closed.
+ */
+
+#ifndef CPU_64_BIT
+#define HDF_MAP_MAX (512 * 1024 * 1024)
+#endif
+
+static void hdf_unmap (struct hardfilehandle *h)
+{
+	if (h->map) {
+		if (h->mapdirty) {
+			FlushViewOfFile (h->map, 0);
+			FlushFileBuffers (h->h);
+		}
+		UnmapViewOfFile (h->map);
+	}
+	if (h->maph)
+		CloseHandle (h->maph);
+	h->map = NULL;
+	h->maph = NULL;
+	h->mapsize = 0;
+	h->mapdirty = false;
+}
+
+static bool hdf_map (struct hardfiledata *hfd)
+{
+	struct hardfilehandle *h = hfd->handle;
+	LARGE_INTEGER size;
+
+	if (!GetFileSizeEx (h->h, &size) || size.QuadPart == 0)
+		return false;
+#ifdef HDF_MAP_MAX
+	if (size.QuadPart > HDF_MAP_MAX) {
+		write_log (_T("HDF: %I64d bytes is too large to map\n"), size.QuadPart);
+		return false;
+	}
+#endif
+	h->maph = CreateFileMapping (h->h, NULL, hfd->ci.readonly ? PAGE_READONLY : PAGE_READWRITE, 0, 0, NULL);
+	if (!h->maph) {
+		write_log (_T("HDF: CreateFileMapping() failed, error %d\n"), GetLastError ());
+		return false;
+	}
+	h->map = (uae_u8*)MapViewOfFile (h->maph, hfd->ci.readonly ? FILE_MAP_READ : FILE_MAP_WRITE, 0, 0, 0);
+	if (!h->map) {
+		write_log (_T("HDF: MapViewOfFile() failed, error %d\n"), GetLastError ());
+		hdf_unmap (h);
+		return false;
+	}
+	h->mapsize = size.QuadPart;
+	hfd_log (_T("HDF: %I64d bytes mapped at %p\n"), h->mapsize, h->map);
+	return true;
+}
+
+// disk errors are reported as EXCEPTION_IN_PAGE_ERROR when view is accessed
+static int hdf_map_filter (DWORD code)
+{
+	return code == EXCEPTION_IN_PAGE_ERROR ? EXCEPTION_EXECUTE_HANDLER : EXCEPTION_CONTINUE_SEARCH;
+}
+
+static int hdf_map_read (struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error)
+{
+	struct hardfilehandle *h = hfd->handle;
+	__try {
+		memcpy (buffer, h->map + hfd->offset + offset, len);
+	} __except (hdf_map_filter (GetExceptionCode ())) {
+		write_log (_T("HDF: mapped read %I64X %d failed\n"), offset, len);
+		*error = 45;
+		return 0;
+	}
+	return len;
+}
+
+static int hdf_map_write (struct hardfiledata *hfd, void *buffer, uae_u64 offset, int len, uae_u32 *error)
+{
+	struct hardfilehandle *h = hfd->handle;
+	__try {
+		memcpy (h->map + hfd->offset + offset, buffer, len);
+	} __except (hdf_map_filter (GetExceptionCode ())) {
+		write_log (_T("HDF: mapped write %I64X %d failed\n"), offset, len);
+		*error = 45;
+		return 0;
+	}
+	h->mapdirty = true;
+	return len;
+}
+
+static bool hdf_map_inrange (struct hardfiledata *hfd, uae_u64 offset, int len)
+{
+	struct hardfilehandle *h = hfd->handle;
+	return h && h->map && !h->mapbypass && len >= 0 && hfd->offset + offset + len <= h->mapsize;
+}
+
+bool hdf_mapped_target (struct hardfiledata *hfd)
+{
+	return hfd->handle && hfd->handle->map != NULL;
+}
+
+// reads go through the file handle even if mapped (debugger benchmark baseline)
+void hdf_map_bypass_target (struct hardfiledata *hfd, bool bypass)
+{
+	if (!hfd->handle)
+		return;
+	hfd->handle->mapbypass = bypass;
+	// mapped writes do not update the read cache
+	hfd->cache_valid = 0;
+}
+
+void hdf_flush_target (struct hardfiledata *hfd)
+{
+	struct hardfilehandle *h = hfd->handle;
+	if (!h || !h->map || !h->mapdirty)
+		return;
+	FlushViewOfFile (h->map, 0);
+	FlushFileBuffers (h->h);
+	h->mapdirty = false;
+}
+
 static void freehandle (struct hardfilehandle *h)
 {
 	if (!h)
 		return;
+	hdf_unmap (h);
 	for (int i = 0; i < MAX_LOCKED_VOLUMES; i++) {
 		if (h->locked_volumes[i] != INVALID_HANDLE_VALUE) {
 			CloseHandle(h->locked_volumes[i]);
@@ -2631,6 +2762,9 @@ int hdf_read_target(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int
 		return 0;
 	}
 
+	if (hdf_map_inrange (hfd, offset, len))
+		return hdf_map_read (hfd, buffer, offset, len, error);
+
 	if (hfd->handle_valid == HDF_HANDLE_WIN32_CHS) {
 		int len2 = len;
 		while (len > 0) {
@@ -2771,6 +2905,11 @@ int hdf_write_target(struct hardfiledata *hfd, void *buffer, uae_u64 offset, int
 	if (hfd->drive_empty || hfd->physsize == 0)
 		return 0;
 
+	if (!hfd->ci.readonly && !hfd->dangerous && hdf_map_inrange (hfd, offset, len)) {
+		hfd->cache_valid = 0;
+		return hdf_map_write (hfd, buffer, offset, len, error);
+	}
+
 	while (len > 0) {
 		int maxlen = len > CACHE_SIZE ? CACHE_SIZE : len;
 		int ret = hdf_write_2(hfd, p, offset, maxlen, error);
@@ -2790,7 +2929,11 @@ int hdf_resize_target (struct hardfiledata *hfd, uae_u64 newsize)
 {
 	LONG highword = 0;
 	DWORD ret, err;
+	bool mapped = hfd->handle->map != NULL;
+	int ok = 0;
 
+	// view can't be resized, map again after file size has changed
+	hdf_unmap (hfd->handle);
 	if (newsize >= 0x80000000) {
 		highword = (DWORD)(newsize >> 32);
 		ret = SetFilePointer (hfd->handle->h, (DWORD)newsize, &highword, FILE_BEGIN);
@@ -2800,15 +2943,16 @@ int hdf_resize_target (struct hardfiledata *hfd, uae_u64 newsize)
 	err = GetLastError ();
 	if (ret == INVALID_SET_FILE_POINTER && err != NO_ERROR) {
 		write_log (_T("hdf_resize_target: SetFilePointer() %d\n"), err);
-		return 0;
-	}
-	if (SetEndOfFile (hfd->handle->h)) {
+	} else if (SetEndOfFile (hfd->handle->h)) {
 		hfd->physsize = newsize;
-		return 1;
+		ok = 1;
+	} else {
+		err = GetLastError ();
+		write_log (_T("hdf_resize_target: SetEndOfFile() %d\n"), err);
 	}
-	err = GetLastError ();
-	write_log (_T("hdf_resize_target: SetEndOfFile() %d\n"), err);
-	return 0;
+	if (mapped)
+		hdf_map (hfd);
+	return ok;
 }
 
 #endif
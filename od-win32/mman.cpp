@@ -621,6 +621,7 @@ void mapped_free (addrbank *ab)
 	bool rtgmem = (ab->flags & ABFLAG_RTG) != 0;
 
 	ab->flags &= ~ABFLAG_MAPPED;
+	mapped_clear_direct(ab);
 	if (ab->baseaddr == NULL)
 		return;
 
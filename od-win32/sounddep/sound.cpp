@@ -117,8 +117,7 @@ struct sound_dp
 	int wasapigoodsize;
 	int pullmode;
 	HANDLE pullevent, pullevent2;
-	uae_u8 *pullbuffer;
-	int pullbufferlen;
+	struct sound_ring *pullring;
 	int pullbuffermaxlen;
 	bool gotpullevent;
 
@@ -325,8 +324,8 @@ static void clearbuffer (struct sound_data *sd)
 	if (sd->devicetype == SOUND_DEVICE_DS) {
 		clearbuffer_ds(sd);
 	}
-	if (s->pullbuffer) {
-		memset(s->pullbuffer, 0, s->pullbuffermaxlen);
+	if (s->pullring) {
+		sound_ring_clear(s->pullring);
 	}
 }
 
@@ -687,6 +686,27 @@ static DWORD fillsupportedmodes (struct sound_data *sd, int freq, struct dsaudio
 	return speakerconfig;
 }
 
+// Host pulls at its own clock, keep ring fill level at the adaptive target.
+static void pullcorrection(struct sound_data *sd)
+{
+	struct sound_dp *s = sd->data;
+	static int tfprev;
+	int fill;
+
+	float v = sound_ring_adjust(s->pullring, &fill);
+	if (tfprev != timeframes) {
+		if ((0 || sound_debug) && (tfprev % 10) == 0) {
+			int target;
+			uae_u32 underruns, overruns;
+			sound_ring_stats(s->pullring, &target, &underruns, &overruns);
+			write_log(_T("%+05d T=%d U=%u O=%u ADJ=%+.2f\n"), fill, target, underruns, overruns, v);
+		}
+		gui_data.sndbuf = fill;
+		sound_setadjust(v);
+		tfprev = timeframes;
+	}
+}
+
 static void finish_sound_buffer_pull(struct sound_data *sd, uae_u16 *sndbuffer)
 {
 	struct sound_dp *s = sd->data;
@@ -704,12 +724,11 @@ static void finish_sound_buffer_pull(struct sound_data *sd, uae_u16 *sndbuffer)
 	}
 #endif
 
-	if (s->pullbufferlen + sd->sndbufsize > s->pullbuffermaxlen) {
-		write_log(_T("pull overflow! %d %d %d\n"), s->pullbufferlen, sd->sndbufsize, s->pullbuffermaxlen);
-		s->pullbufferlen = 0;
+	int frames = sd->sndbufsize / sd->samplesize;
+	if (sound_ring_write(s->pullring, sndbuffer, frames) < frames) {
+		write_log(_T("pull overflow! %d %d %d\n"), sound_ring_avail(s->pullring), frames, sound_ring_size(s->pullring));
 	}
-	memcpy(s->pullbuffer + s->pullbufferlen, sndbuffer, sd->sndbufsize);
-	s->pullbufferlen += sd->sndbufsize;
+	pullcorrection(sd);
 }
 
 static void finish_sound_buffer_pa (struct sound_data *sd, uae_u16 *sndbuffer)
@@ -734,29 +753,18 @@ static int _cdecl portAudioCallback (const void *inputBuffer, void *outputBuffer
 {
 	struct sound_data *sd = (struct sound_data*)userData;
 	struct sound_dp *s = sd->data;
-	int bytestocopy;
 
 	if (!framesPerBuffer || sdp->deactive)
 		return paContinue;
 
-	if (s->pullbufferlen <= 0) {
+	if (sound_ring_avail(s->pullring) < (int)framesPerBuffer) {
 		ResetEvent(s->pullevent2);
 		SetEvent(s->pullevent);
 		WaitForSingleObject(s->pullevent2, 1);
-		if (s->pullbufferlen <= 0) {
-			return paContinue;
-		}
 	}
 
-	bytestocopy = framesPerBuffer * sd->samplesize;
-	if (bytestocopy > 0) {
-		memcpy(outputBuffer, s->pullbuffer, bytestocopy);
-	}
-
-	if (bytestocopy < s->pullbufferlen) {
-		memmove(s->pullbuffer, s->pullbuffer + bytestocopy, s->pullbufferlen - bytestocopy);
-	}
-	s->pullbufferlen -= bytestocopy;
+	// short read is padded with silence and counted as underrun
+	sound_ring_read(s->pullring, outputBuffer, framesPerBuffer);
 
 	return paContinue;
 }
@@ -774,9 +782,8 @@ static void close_audio_pa (struct sound_data *sd)
 		CloseHandle(s->pullevent2);
 	s->pullevent2 = NULL;
 	s->pastream = NULL;
-	xfree(s->pullbuffer);
-	s->pullbuffer = NULL;
-	s->pullbufferlen = 0;
+	sound_ring_free(s->pullring);
+	s->pullring = NULL;
 }
 
 static int open_audio_pa (struct sound_data *sd, int index)
@@ -865,8 +872,7 @@ fixfreq:
 	s->pullevent = CreateEvent(NULL, TRUE, FALSE, NULL);
 	s->pullevent2 = CreateEvent(NULL, FALSE, FALSE, NULL);
 	s->pullbuffermaxlen = sd->sndbufsize * 2;
-	s->pullbuffer = xcalloc(uae_u8, s->pullbuffermaxlen);
-	s->pullbufferlen = 0;
+	s->pullring = sound_ring_alloc(s->pullbuffermaxlen / sd->samplesize, sd->samplesize);
 
 	name = au (di->name);
 	write_log (_T("PASOUND: CH=%d,FREQ=%d (%s) '%s' buffer %d/%d (%s)\n"),
@@ -1322,9 +1328,8 @@ static void close_audio_wasapi(struct sound_data *sd)
 		CloseHandle(s->pullevent);
 		s->pullevent = NULL;
 	}
-	xfree(s->pullbuffer);
-	s->pullbuffer = NULL;
-	s->pullbufferlen = 0;
+	sound_ring_free(s->pullring);
+	s->pullring = NULL;
 }
 
 static int open_audio_wasapi (struct sound_data *sd, int index, int exclusive)
@@ -1721,8 +1726,7 @@ retry:
 			s->pullbuffermaxlen = sd->sndbufsize * 2;
 		}
 		s->wasapigoodsize = s->bufferFrameCount;
-		s->pullbuffer = xcalloc(uae_u8, s->pullbuffermaxlen);
-		s->pullbufferlen = 0;
+		s->pullring = sound_ring_alloc(s->pullbuffermaxlen / sd->samplesize, sd->samplesize);
 	} else {
 		sd->sndbufsize = (s->bufferFrameCount / 8) * sd->samplesize;
 		v = s->bufferFrameCount * sd->samplesize;
@@ -1919,11 +1923,43 @@ error:
 	return 0;
 }
 
+// -soundsink: no host device, sndring.cpp sink thread consumes the ring
+static void close_audio_null (struct sound_data *sd)
+{
+	struct sound_dp *s = sd->data;
+
+	sound_sink_close();
+	s->pullring = NULL;
+}
+
+static int open_audio_null (struct sound_data *sd)
+{
+	struct sound_dp *s = sd->data;
+	int size = sd->sndbufsize;
+
+	sd->devicetype = SOUND_DEVICE_NULL;
+	if (size < 0x80)
+		size = 0x80;
+	sd->sndbufsize = size * sd->channels * 2 / 8;
+	if (sd->sndbufsize > SND_MAX_BUFFER)
+		sd->sndbufsize = SND_MAX_BUFFER;
+	s->pullring = sound_sink_open(sound_sink_path, sd->freq, sd->channels, size);
+	return s->pullring != NULL;
+}
+
+static void finish_sound_buffer_null (struct sound_data *sd, uae_u16 *sndbuffer)
+{
+	struct sound_dp *s = sd->data;
+
+	sound_ring_write(s->pullring, sndbuffer, sd->sndbufsize / (sd->channels * 2));
+	pullcorrection(sd);
+}
+
 int open_sound_device (struct sound_data *sd, int index, int bufsize, int freq, int channels)
 {
 	int ret = 0;
 	struct sound_dp *sdp = xcalloc (struct sound_dp, 1);
-	int type = sound_devices[index]->type;
+	int type = index < 0 ? SOUND_DEVICE_NULL : sound_devices[index]->type;
 	
 	sd->data = sdp;
 	sd->sndbufsize = bufsize;
@@ -1943,6 +1979,8 @@ int open_sound_device (struct sound_data *sd, int index, int bufsize, int freq,
 	else if (type == SOUND_DEVICE_XAUDIO2)
 		ret = open_audio_xaudio2 (sd, index);
 #endif
+	else if (type == SOUND_DEVICE_NULL)
+		ret = open_audio_null (sd);
 	sd->samplesize = sd->channels * 2;
 	sd->sndbufframes = sd->sndbufsize / sd->samplesize;
 	return ret;
@@ -1962,6 +2000,8 @@ void close_sound_device (struct sound_data *sd)
 	else if (sd->devicetype == SOUND_DEVICE_XAUDIO2)
 		close_audio_xaudio2 (sd);
 #endif
+	else if (sd->devicetype == SOUND_DEVICE_NULL)
+		close_audio_null (sd);
 	xfree (sd->data);
 	sd->data = NULL;
 	sd->index = -1;
@@ -2163,7 +2203,7 @@ static int open_sound (void)
 #endif
 	
 	ch = get_audio_nativechannels(active_sound_stereo);
-	ret = open_sound_device (sdp, currprefs.win32_soundcard, size, currprefs.sound_freq, ch);
+	ret = open_sound_device (sdp, sound_sink_path ? -1 : currprefs.win32_soundcard, size, currprefs.sound_freq, ch);
 	if (!ret)
 		return 0;
 	currprefs.sound_freq = changed_prefs.sound_freq = sdp->freq;
@@ -2584,10 +2624,12 @@ static bool finish_sound_buffer_wasapi_pull_do(struct sound_data *sd)
     
     // Fallback to legacy code if Layer 2/3 not available
 
-	if (s->pullbufferlen <= 0)
+	if (!s->pullring)
+		return false;
+	int frames = sound_ring_avail(s->pullring);
+	if (frames <= 0)
 		return false;
 
-	int frames = s->pullbufferlen / sd->samplesize;
 	int avail = frames;
 
 	if (!s->wasapiexclusive) {
@@ -2596,7 +2638,7 @@ static bool finish_sound_buffer_wasapi_pull_do(struct sound_data *sd)
 		wasapi_check_state(sd, hr);
 		if (FAILED(hr)) {
 			write_log(_T("WASAPI: GetCurrentPadding() %08X\n"), hr);
-			s->pullbufferlen = 0;
+			sound_ring_skip(s->pullring);
 			return false;
 		}
 		avail = s->bufferFrameCount - numFramesPadding;
@@ -2611,7 +2653,7 @@ static bool finish_sound_buffer_wasapi_pull_do(struct sound_data *sd)
 	hr = s->pRenderClient->GetBuffer(avail, &pData);
 	wasapi_check_state(sd, hr);
 	if (SUCCEEDED(hr)) {
-		memcpy(pData, s->pullbuffer, avail * sd->samplesize);
+		sound_ring_read(s->pullring, pData, avail);
 		hr = s->pRenderClient->ReleaseBuffer(avail, 0);
 		if (FAILED(hr)) {
 			write_log(_T("WASAPI: ReleaseBuffer() %08X\n"), hr);
@@ -2619,11 +2661,6 @@ static bool finish_sound_buffer_wasapi_pull_do(struct sound_data *sd)
 	} else {
 		write_log(_T("WASAPI: GetBuffer() %08X\n"), hr);
 	}
-	
-	if (avail < frames) {
-		memmove(s->pullbuffer, s->pullbuffer + avail * sd->samplesize, s->pullbufferlen - (avail  * sd->samplesize));
-	}
-	s->pullbufferlen -= avail * sd->samplesize;
 
 	return true;
 }
@@ -2884,6 +2921,8 @@ static void send_sound (struct sound_data *sd, uae_u16 *sndbuffer)
 	else if (type == SOUND_DEVICE_XAUDIO2)
 		finish_sound_buffer_xaudio2 (sd, sndbuffer);
 #endif
+	else if (type == SOUND_DEVICE_NULL)
+		finish_sound_buffer_null (sd, sndbuffer);
 }
 
 HANDLE get_sound_event(void)
@@ -2968,7 +3007,7 @@ int audio_pull_buffer(void)
 #endif
 		
 		// Legacy path for old pullbuffer
-		if (s->pullbufferlen > 0) {
+		if (s->pullring && sound_ring_avail(s->pullring) > 0) {
 			cnt++;
 			int size = (int)((uae_u8*)paula_sndbufpt - (uae_u8*)paula_sndbuffer);
 			if (size > sdp->sndbufsize * 2 / 3)
@@ -92,6 +92,7 @@
 #include "specialmonitors.h"
 #include "debug.h"
 #include "disasm.h"
+#include "cpubench.h"
 
 #include "darkmode.h"
 
@@ -6937,6 +6938,10 @@ static int parseargs(const TCHAR *argx, const TCHAR *np, const TCHAR *np2)
 		quit_to_gui = 1;
 		return 1;
 	}
+	if (!_tcscmp(arg, _T("cpubench")) && np) {
+		cpubench_file = my_strdup(np);
+		return 2;
+	}
 	if (!_tcscmp(arg, _T("ini")) && np) {
 		inipath = my_strdup(np);
 		return 2;
@@ -7452,6 +7457,7 @@ static int PASCAL WinMain2 (HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR
 	HANDLE hMutex;
 	TCHAR **argv = NULL, **argv2 = NULL, **argv3;
 	int argc, i;
+	int ret = FALSE;
 
 	if (!osdetect ())
 		return 0;
@@ -7545,7 +7551,7 @@ static int PASCAL WinMain2 (HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR
 			shmem_serial_create();
 			enumserialports ();
 			enummidiports ();
-			real_main (argc, argv);
+			ret = real_main (argc, argv);
 		}
 	}
 end:
@@ -7591,7 +7597,7 @@ end:
 	for (i = 0; argv3 && argv3[i]; i++)
 		xfree (argv3[i]);
 	xfree (argv3);
-	return FALSE;
+	return ret;
 }
 
 #if 0
@@ -8467,16 +8473,17 @@ int PASCAL wWinMain (HINSTANCE hInstance, HINSTANCE hPrevInstance, LPWSTR lpCmdL
 
 	log_open (NULL, 0, -1, NULL);
 
+	int ret = FALSE;
 #ifdef NDEBUG
 	__try {
 #endif
-		WinMain2 (hInstance, hPrevInstance, lpCmdLine, nCmdShow);
+		ret = WinMain2 (hInstance, hPrevInstance, lpCmdLine, nCmdShow);
 #ifdef NDEBUG
 	} __except(WIN32_ExceptionFilter (GetExceptionInformation (), GetExceptionCode ())) {
 	}
 #endif
 	//SetThreadAffinityMask (thread, original_affinity);
-	return FALSE;
+	return ret;
 }
 
 
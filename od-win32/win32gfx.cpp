@@ -2138,6 +2138,7 @@ int check_prefs_changed_gfx(void)
 	c |= currprefs.gfx_monitorblankdelay != changed_prefs.gfx_monitorblankdelay ? (512) : 0;
 
 	c |= currprefs.gfx_display_sections != changed_prefs.gfx_display_sections ? (512) : 0;
+	c |= currprefs.gfx_denise_threads != changed_prefs.gfx_denise_threads ? (512) : 0;
 	c |= currprefs.gfx_variable_sync != changed_prefs.gfx_variable_sync ? 1 : 0;
 	c |= currprefs.gfx_windowed_resize != changed_prefs.gfx_windowed_resize ? 1 : 0;
 
@@ -2242,6 +2243,7 @@ int check_prefs_changed_gfx(void)
 		currprefs.gfx_monitorblankdelay = changed_prefs.gfx_monitorblankdelay;
 
 		currprefs.gfx_display_sections = changed_prefs.gfx_display_sections;
+		currprefs.gfx_denise_threads = changed_prefs.gfx_denise_threads;
 		currprefs.gfx_variable_sync = changed_prefs.gfx_variable_sync;
 		currprefs.gfx_windowed_resize = changed_prefs.gfx_windowed_resize;
 
@@ -1713,7 +1713,7 @@ retry2:
 	tlen += len;
 	p += len;
 
-	if (bufcheck (st, p, 0))
+	if (bufcheck (st, p, save_custom_event_delay_size ()))
 		goto retry;
 	p3 = p;
 	save_u32_func (&p, 0);
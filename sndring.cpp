@@ -0,0 +1,325 @@
+/*
+* UAE - The Un*x Amiga Emulator
+*
+* Lock-free sound ring buffer and null/file sound sink
+*
+* One producer (emulation thread, finish_sound_buffer) and one consumer
+* (host sound callback or sink thread). Positions are free running frame
+* counters, only the producer writes wpos and only the consumer writes
+* rpos, no locks or events are needed to move samples.
+*
+* The producer side also runs the latency controller: target fill level
+* grows when the consumer sees underruns and slowly shrinks back while
+* playback is clean. Fill error is converted to sound_setadjust() units.
+*/
+
+#include "sysconfig.h"
+#include "sysdeps.h"
+
+#include <atomic>
+
+#include "options.h"
+#include "uae.h"
+#include "zfile.h"
+#include "gensound.h"
+#include "events.h"
+#include "threaddep/thread.h"
+
+#define SOUND_RING_DEBUG 0
+
+// clean blocks before target latency is lowered again
+#define SOUND_RING_STABLE 500
+// sound_setadjust() range
+#define SOUND_RING_ADJUST_MAX 6.0f
+
+struct sound_ring
+{
+	std::atomic<uae_u32> wpos;
+	std::atomic<uae_u32> rpos;
+	std::atomic<uae_u32> underruns;
+	uae_u8 *buf;
+	uae_u32 frames, mask;
+	int framesize;
+
+	// producer only
+	uae_u32 overruns;
+	uae_u32 last_underruns;
+	int minfill, target;
+	int stable;
+	float avgerr;
+};
+
+struct sound_ring *sound_ring_alloc(int frames, int framesize)
+{
+	struct sound_ring *r = new sound_ring;
+	uae_u32 size = 1;
+	while (size < (uae_u32)frames)
+		size <<= 1;
+	r->frames = size;
+	r->mask = size - 1;
+	r->framesize = framesize;
+	r->buf = xcalloc(uae_u8, size * framesize);
+	r->minfill = frames / 4;
+	sound_ring_reset(r);
+	return r;
+}
+
+void sound_ring_free(struct sound_ring *r)
+{
+	if (!r)
+		return;
+	xfree(r->buf);
+	delete r;
+}
+
+void sound_ring_reset(struct sound_ring *r)
+{
+	r->wpos.store(0, std::memory_order_relaxed);
+	r->rpos.store(0, std::memory_order_relaxed);
+	r->underruns.store(0, std::memory_order_relaxed);
+	r->overruns = 0;
+	r->last_underruns = 0;
+	r->target = r->frames / 2;
+	r->stable = 0;
+	r->avgerr = 0;
+}
+
+void sound_ring_clear(struct sound_ring *r)
+{
+	memset(r->buf, 0, r->frames * r->framesize);
+}
+
+int sound_ring_size(struct sound_ring *r)
+{
+	return r->frames;
+}
+
+int sound_ring_avail(struct sound_ring *r)
+{
+	return r->wpos.load(std::memory_order_acquire) - r->rpos.load(std::memory_order_acquire);
+}
+
+int sound_ring_write(struct sound_ring *r, const void *data, int frames)
+{
+	uae_u32 w = r->wpos.load(std::memory_order_relaxed);
+	uae_u32 rd = r->rpos.load(std::memory_order_acquire);
+	uae_u32 space = r->frames - (w - rd);
+	if ((uae_u32)frames > space) {
+		r->overruns++;
+		frames = space;
+	}
+	const uae_u8 *p = (const uae_u8*)data;
+	uae_u32 ofs = w & r->mask;
+	uae_u32 n = r->frames - ofs;
+	if (n > (uae_u32)frames)
+		n = frames;
+	memcpy(r->buf + ofs * r->framesize, p, n * r->framesize);
+	memcpy(r->buf, p + n * r->framesize, (frames - n) * r->framesize);
+	r->wpos.store(w + frames, std::memory_order_release);
+	return frames;
+}
+
+int sound_ring_read(struct sound_ring *r, void *data, int frames)
+{
+	uae_u32 rd = r->rpos.load(std::memory_order_relaxed);
+	uae_u32 w = r->wpos.load(std::memory_order_acquire);
+	uae_u32 avail = w - rd;
+	uae_u8 *p = (uae_u8*)data;
+	int got = frames;
+	if ((uae_u32)got > avail) {
+		r->underruns.fetch_add(1, std::memory_order_relaxed);
+		got = avail;
+		// missing part is silence
+		memset(p + got * r->framesize, 0, (frames - got) * r->framesize);
+	}
+	uae_u32 ofs = rd & r->mask;
+	uae_u32 n = r->frames - ofs;
+	if (n > (uae_u32)got)
+		n = got;
+	memcpy(p, r->buf + ofs * r->framesize, n * r->framesize);
+	memcpy(p + n * r->framesize, r->buf, (got - n) * r->framesize);
+	r->rpos.store(rd + got, std::memory_order_release);
+	return got;
+}
+
+// consumer side: drop everything written so far
+int sound_ring_skip(struct sound_ring *r)
+{
+	uae_u32 rd = r->rpos.load(std::memory_order_relaxed);
+	uae_u32 w = r->wpos.load(std::memory_order_acquire);
+	r->rpos.store(w, std::memory_order_release);
+	return w - rd;
+}
+
+float sound_ring_adjust(struct sound_ring *r, int *fillpermille)
+{
+	int step = r->frames / 16;
+	int fill = sound_ring_avail(r);
+	uae_u32 u = r->underruns.load(std::memory_order_relaxed);
+
+	if (u != r->last_underruns) {
+		r->last_underruns = u;
+		r->target += step;
+		if (r->target > r->frames * 3 / 4)
+			r->target = r->frames * 3 / 4;
+		r->stable = 0;
+	} else if (++r->stable >= SOUND_RING_STABLE) {
+		r->stable = 0;
+		r->target -= step / 4;
+		if (r->target < r->minfill)
+			r->target = r->minfill;
+	}
+
+	float err = (float)(fill - r->target) / r->frames;
+	r->avgerr = r->avgerr * 0.95f + err * 0.05f;
+	float adj = err * 10.0f + r->avgerr * 20.0f;
+	if (adj > SOUND_RING_ADJUST_MAX)
+		adj = SOUND_RING_ADJUST_MAX;
+	if (adj < -SOUND_RING_ADJUST_MAX)
+		adj = -SOUND_RING_ADJUST_MAX;
+
+	if (fillpermille)
+		*fillpermille = (int)(1000.0f * (fill - r->target) / r->frames);
+#if SOUND_RING_DEBUG
+	write_log(_T("ring fill %d target %d adj %+.2f\n"), fill, r->target, adj);
+#endif
+	return adj;
+}
+
+void sound_ring_stats(struct sound_ring *r, int *target, uae_u32 *underruns, uae_u32 *overruns)
+{
+	*target = r->target;
+	*underruns = r->underruns.load(std::memory_order_relaxed);
+	*overruns = r->overruns;
+}
+
+/* Null/file sink: consumer thread takes samples at real time rate and
+ * optionally writes them to a WAV file. Useful for measuring the ring
+ * buffer path without sound hardware. */
+
+TCHAR *sound_sink_path;
+
+static struct sound_ring *sink_ring;
+static struct zfile *sink_file;
+static int sink_freq, sink_channels, sink_period;
+static volatile int sink_thread_active;
+static uae_u32 sink_bytes;
+static uae_u8 *sink_buf;
+
+static uae_u8 *sink_put16(uae_u8 *p, uae_u16 v)
+{
+	p[0] = (uae_u8)v;
+	p[1] = (uae_u8)(v >> 8);
+	return p + 2;
+}
+
+static uae_u8 *sink_put32(uae_u8 *p, uae_u32 v)
+{
+	p[0] = (uae_u8)v;
+	p[1] = (uae_u8)(v >> 8);
+	p[2] = (uae_u8)(v >> 16);
+	p[3] = (uae_u8)(v >> 24);
+	return p + 4;
+}
+
+// RIFF fields are always little-endian
+static void sink_wavheader(struct zfile *f, uae_u32 size)
+{
+	uae_u8 hdr[44], *p = hdr;
+
+	memcpy(p, "RIFF", 4);
+	p = sink_put32(p + 4, size + 36);
+	memcpy(p, "WAVEfmt ", 8);
+	p = sink_put32(p + 8, 16);
+	p = sink_put16(p, 1);
+	p = sink_put16(p, sink_channels);
+	p = sink_put32(p, sink_freq);
+	p = sink_put32(p, sink_freq * sink_channels * 2);
+	p = sink_put16(p, sink_channels * 2);
+	p = sink_put16(p, 16);
+	memcpy(p, "data", 4);
+	p = sink_put32(p + 4, size);
+	zfile_fseek(f, 0, SEEK_SET);
+	zfile_fwrite(hdr, 1, p - hdr, f);
+}
+
+static void sink_thread(void *v)
+{
+	frame_time_t start = read_processor_time();
+	uae_u64 done = 0;
+
+	uae_set_thread_priority(NULL, 1);
+	while (sink_thread_active > 0) {
+		sleep_millis(sink_period);
+		uae_u64 due = (uae_u64)((double)(read_processor_time() - start) * sink_freq / syncbase);
+		while (done < due) {
+			int frames = (int)(due - done);
+			if (frames > sound_ring_size(sink_ring))
+				frames = sound_ring_size(sink_ring);
+			sound_ring_read(sink_ring, sink_buf, frames);
+			if (sink_file) {
+				zfile_fwrite(sink_buf, frames, sink_channels * 2, sink_file);
+				sink_bytes += frames * sink_channels * 2;
+			}
+			done += frames;
+		}
+	}
+	sink_thread_active = 0;
+}
+
+struct sound_ring *sound_sink_open(const TCHAR *path, int freq, int channels, int bufframes)
+{
+	sound_sink_close();
+	if (path && path[0]) {
+		sink_file = zfile_fopen(path, _T("wb"), 0);
+		if (!sink_file) {
+			write_log(_T("SOUNDSINK: can't create '%s'\n"), path);
+			return NULL;
+		}
+	}
+	sink_freq = freq;
+	sink_channels = channels;
+	sink_ring = sound_ring_alloc(bufframes * 2, channels * 2);
+	sink_buf = xcalloc(uae_u8, sound_ring_size(sink_ring) * channels * 2);
+	sink_period = bufframes * 1000 / freq / 4;
+	if (sink_period < 1)
+		sink_period = 1;
+	sink_bytes = 0;
+	if (sink_file)
+		sink_wavheader(sink_file, 0);
+	sink_thread_active = 1;
+	if (!uae_start_thread(_T("soundsink"), sink_thread, NULL, NULL)) {
+		write_log(_T("SOUNDSINK: failed to start thread\n"));
+		sink_thread_active = 0;
+		sound_sink_close();
+		return NULL;
+	}
+	write_log(_T("SOUNDSINK: %s %dHz %dch ring %d frames\n"),
+		sink_file ? path : _T("null"), freq, channels, sound_ring_size(sink_ring));
+	return sink_ring;
+}
+
+void sound_sink_close(void)
+{
+	if (!sink_ring)
+		return;
+	if (sink_thread_active > 0) {
+		sink_thread_active = -1;
+		while (sink_thread_active)
+			sleep_millis(1);
+	}
+	int target;
+	uae_u32 underruns, overruns;
+	sound_ring_stats(sink_ring, &target, &underruns, &overruns);
+	write_log(_T("SOUNDSINK: closed, target latency %d frames (%.1fms), %u underruns, %u overruns\n"),
+		target, target * 1000.0 / sink_freq, underruns, overruns);
+	if (sink_file) {
+		sink_wavheader(sink_file, sink_bytes);
+		zfile_fclose(sink_file);
+		sink_file = NULL;
+	}
+	sound_ring_free(sink_ring);
+	sink_ring = NULL;
+	xfree(sink_buf);
+	sink_buf = NULL;
+}
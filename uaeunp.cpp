@@ -41,6 +41,26 @@ uae_u32 uaerand (void)
 	return rand ();
 }
 
+// no persistent unpack cache in command line tool
+bool zfile_cache_enabled (void)
+{
+	return false;
+}
+bool zfile_cache_key (struct zfile *z, int mask, int index, uae_u8 *key)
+{
+	return false;
+}
+struct zfile *zfile_cache_open (const uae_u8 *key, struct zfile *z, const TCHAR *originalname)
+{
+	return NULL;
+}
+void zfile_cache_store (const uae_u8 *key, const TCHAR *packedname, struct zfile *z)
+{
+}
+void zfile_cache_exit (void)
+{
+}
+
 /* convert time_t to/from AmigaDOS time */
 static const uae_s64 msecs_per_day = 24 * 60 * 60 * 1000;
 static const uae_s64 diff = ((8 * 365 + 2) * (24 * 60 * 60)) * (uae_u64)1000;
@@ -70,6 +70,7 @@ struct zdiskimage
 struct zcache
 {
 	TCHAR *name;
+	uae_u32 hash;
 	struct zdiskimage *zd;
 	void *data;
 	int size;
@@ -78,11 +79,20 @@ struct zcache
 };
 static struct zcache *zcachedata;
 
+static uae_u32 zcache_hash (const TCHAR *name)
+{
+	uae_u32 h = 2166136261u;
+	while (*name)
+		h = (h ^ *name++) * 16777619u;
+	return h;
+}
+
 static struct zcache *cache_get (const TCHAR *name)
 {
 	struct zcache *zc = zcachedata;
+	uae_u32 hash = zcache_hash (name);
 	while (zc) {
-		if (!_tcscmp (name, zc->name)) {
+		if (zc->hash == hash && !_tcscmp (name, zc->name)) {
 			zc->tm = time (NULL);
 			return zc;
 		}
@@ -166,6 +176,7 @@ static struct zcache *zcache_put (const TCHAR *name, struct zdiskimage *data)
 	zcachedata = zc;
 	zc->zd = data;
 	zc->name = my_strdup (name);
+	zc->hash = zcache_hash (name);
 	zc->tm = time (NULL);
 	return zc;
 }
@@ -210,6 +221,8 @@ static void zfile_free (struct zfile *f)
 	xfree (f->originalname);
 	xfree (f->data);
 	xfree (f->mode);
+	if (f->zfileclose)
+		f->zfileclose (f);
 	xfree (f->userdata);
 	xfree (f);
 }
@@ -217,6 +230,7 @@ static void zfile_free (struct zfile *f)
 void zfile_exit (void)
 {
 	struct zfile *l;
+	zfile_cache_exit ();
 	while ((l = zlist)) {
 		zlist = l->next;
 		zfile_free (l);
@@ -1776,6 +1790,43 @@ int zfile_zopen (const TCHAR *name, zfile_callback zc, void *user)
 	return 1;
 }
 
+static const TCHAR *zcache_ext[] = {
+	_T("7z"), _T("zip"), _T("lha"), _T("lzh"), _T("lzx"), _T("rar"), _T("tar"),
+	_T("gz"), _T("adz"), _T("roz"), _T("hdz"), _T("wrp"), _T("xz"), _T("dms"),
+	_T("ipf"), _T("fdi"), _T("dsq"), NULL
+};
+
+// packed file that zuncompress() would unpack
+static bool zfile_cache_candidate (struct zfile *z, int mask)
+{
+	uae_u8 header[8];
+
+	if (!(mask & (ZFD_ARCHIVE | ZFD_UNPACK | ZFD_RAWDISK)) || !z->f)
+		return false;
+	if (z->zipname)
+		return true;
+	const TCHAR *ext = zfile_get_ext (z->name);
+	if (ext) {
+		for (int i = 0; zcache_ext[i]; i++) {
+			if (!strcasecmp (ext + 1, zcache_ext[i]))
+				return true;
+		}
+	}
+	memset (header, 0, sizeof (header));
+	zfile_fseek (z, 0, SEEK_SET);
+	zfile_fread (header, sizeof (header), 1, z);
+	zfile_fseek (z, 0, SEEK_SET);
+	if (header[0] == 0x1f && header[1] == 0x8b)
+		return true;
+	if (header[0] == 0xfd && !memcmp (header + 1, "7zXZ", 4))
+		return true;
+	if (!memcmp (header, "DMS!", 4) || !memcmp (header, "CAPS", 4) || !memcmp (header, "Rar!", 4))
+		return true;
+	if (!memcmp (header, "PKD", 3) || !memcmp (header, "LZX", 3) || !memcmp (header, "PK", 2))
+		return true;
+	return false;
+}
+
 /*
 * fopen() for a compressed file
 */
@@ -1784,6 +1835,9 @@ static struct zfile *zfile_fopen_x (const TCHAR *name, const TCHAR *mode, int ma
 	int cnt = 10;
 	struct zfile *l, *l2;
 	TCHAR path[MAX_DPATH];
+	uae_u8 key[20];
+	TCHAR *packedname = NULL;
+	bool cached, unpacked = false;
 
 	if (_tcslen (name) == 0)
 		return NULL;
@@ -1791,6 +1845,16 @@ static struct zfile *zfile_fopen_x (const TCHAR *name, const TCHAR *mode, int ma
 	l = zfile_fopen_2 (path, mode, mask);
 	if (!l)
 		return 0;
+	cached = !writeneeded (mode) && zfile_cache_enabled () && zfile_cache_candidate (l, mask) && zfile_cache_key (l, mask, index, key);
+	if (cached) {
+		l2 = zfile_cache_open (key, l, path);
+		if (l2) {
+			l2->zfdmask = mask;
+			zfile_fclose (l);
+			return l2;
+		}
+		packedname = my_strdup (l->name);
+	}
 	l2 = NULL;
 	while (cnt-- > 0) {
 		int rc;
@@ -1799,6 +1863,7 @@ static struct zfile *zfile_fopen_x (const TCHAR *name, const TCHAR *mode, int ma
 		if (!l2) {
 			if (rc < 0) {
 				zfile_fclose (l);
+				xfree (packedname);
 				return NULL;
 			}
 			zfile_fseek (l, 0, SEEK_SET);
@@ -1806,9 +1871,13 @@ static struct zfile *zfile_fopen_x (const TCHAR *name, const TCHAR *mode, int ma
 		} else {
 			if (l2->parent == l)
 				l->opencnt--;
+			unpacked = true;
 		}
 		l = l2;
 	}
+	if (cached && unpacked)
+		zfile_cache_store (key, packedname, l);
+	xfree (packedname);
 	return l;
 }
 
@@ -1986,8 +2055,14 @@ struct zfile *zfile_dup (struct zfile *zf)
 		return NULL;
 	if (zf->archiveparent)
 		checkarchiveparent (zf);
-	if (zf->userdata)
-		return NULL;
+	if (zf->userdata) {
+		if (!zf->zfiledup)
+			return NULL;
+		nzf = zf->zfiledup (zf);
+		if (nzf)
+			zfile_fseek (nzf, zf->seek, SEEK_SET);
+		return nzf;
+	}
 	if (!zf->data && zf->dataseek) {
 		nzf = zfile_create (zf, NULL);
 	} else if (zf->data) {
@@ -2363,6 +2438,29 @@ size_t zfile_fputs (struct zfile *z, const TCHAR *s)
 	return t;
 }
 
+// fgets() for real files and files without memory data
+static char *zfile_fgets_x (char *s, int size, struct zfile *z)
+{
+	int i;
+
+	if (z->f && !z->zfileread && !(z->parent && z->useparent))
+		return fgets (s, size, z->f);
+	for (i = 0; i < size - 1; i++) {
+		int c = zfile_getc (z);
+		if (c < 0)
+			break;
+		s[i] = c;
+		if (c == '\n') {
+			i++;
+			break;
+		}
+	}
+	if (i == 0)
+		return NULL;
+	s[i] = 0;
+	return s;
+}
+
 char *zfile_fgetsa (char *s, int size, struct zfile *z)
 {
 	checkarchiveparent (z);
@@ -2385,7 +2483,7 @@ char *zfile_fgetsa (char *s, int size, struct zfile *z)
 		*s = 0;
 		return os;
 	} else {
-		return fgets (s, size, z->f);
+		return zfile_fgets_x (s, size, z);
 	}
 }
 
@@ -2428,7 +2526,7 @@ TCHAR *zfile_fgets (TCHAR *s, int size, struct zfile *z)
 			}
 			alloc = true;
 		}
-		s1 = fgets (s2, size, z->f);
+		s1 = zfile_fgets_x (s2, size, z);
 		if (!s1) {
 			if (alloc) {
 				xfree(s2);
@@ -2455,7 +2553,11 @@ int zfile_getc (struct zfile *z)
 {
 	checkarchiveparent (z);
 	int out = -1;
-	if (z->data) {
+	if (z->zfileread || (z->parent && z->useparent)) {
+		uae_u8 c;
+		if (zfile_fread (&c, 1, 1, z) == 1)
+			out = c;
+	} else if (z->data) {
 		if (z->seek < z->size) {
 			out = z->data[z->seek++];
 		}
@@ -425,6 +425,380 @@ struct zvolume *archive_directory_zip (struct zfile *z)
 }
 
 
+/* Seekable deflate stream for large zip members.
+ *
+ * Member is decompressed on demand instead of unpacking it completely
+ * to memory. Restart points (bit position in compressed data plus last
+ * 32K of output) are recorded at deflate block boundaries while
+ * decompressing, any later seek restarts from the nearest point below
+ * the target. Recently decoded blocks are kept in a small LRU.
+ */
+
+// smaller members are unpacked to memory as before
+#define ZIPSTREAM_MIN (16 * 1024 * 1024)
+// restart point distance, increased for very large members
+#define ZIPSTREAM_SPAN (1024 * 1024)
+#define ZIPSTREAM_MAXPOINTS 1024
+#define ZIPSTREAM_WINSIZE 32768
+#define ZIPSTREAM_BLOCKSIZE 65536
+#define ZIPSTREAM_BLOCKS 16
+#define ZIPSTREAM_INSIZE 16384
+
+struct zipstream_point
+{
+	uae_u64 out; // uncompressed offset
+	uae_u64 in; // compressed offset of first complete byte
+	int bits; // unused bits in byte before 'in'
+	uae_u8 *window;
+};
+
+struct zipstream_block
+{
+	uae_u64 block;
+	uae_u32 lastuse;
+	uae_u8 *data;
+};
+
+struct zipstream
+{
+	z_stream strm;
+	uae_u64 csize;
+	uae_u64 size;
+	uae_u64 inpos; // compressed bytes read to inbuf
+	uae_u64 out; // uncompressed position of strm
+	bool eof;
+	uae_u8 inbuf[ZIPSTREAM_INSIZE];
+	uae_u8 window[ZIPSTREAM_WINSIZE]; // last output, circular at out % ZIPSTREAM_WINSIZE
+	struct zipstream_point *points;
+	int numpoints;
+	uae_u64 span;
+	struct zipstream_block blocks[ZIPSTREAM_BLOCKS];
+	uae_u32 tick;
+	int restarts;
+};
+
+// archive can be shared with other streams, always seek before reading
+static bool zipstream_readin (struct zfile *zf, struct zipstream *zs, uae_u8 *dst, uae_u64 len)
+{
+	if (zfile_fseek (zf->parent, zf->offset + zs->inpos, SEEK_SET))
+		return false;
+	if (zfile_fread (dst, 1, (size_t)len, zf->parent) != len)
+		return false;
+	zs->inpos += len;
+	return true;
+}
+
+static void zipstream_seekin (struct zipstream *zs, uae_u64 in)
+{
+	zs->inpos = in;
+	zs->strm.next_in = zs->inbuf;
+	zs->strm.avail_in = 0;
+}
+
+static void zipstream_addpoint (struct zipstream *zs)
+{
+	struct zipstream_point *p;
+	uae_u32 wpos = zs->out % ZIPSTREAM_WINSIZE;
+
+	if (zs->numpoints >= ZIPSTREAM_MAXPOINTS)
+		return;
+	p = &zs->points[zs->numpoints];
+	p->window = xmalloc (uae_u8, ZIPSTREAM_WINSIZE);
+	if (!p->window)
+		return;
+	p->out = zs->out;
+	p->in = zs->inpos - zs->strm.avail_in;
+	p->bits = zs->strm.data_type & 7;
+	memcpy (p->window, zs->window + wpos, ZIPSTREAM_WINSIZE - wpos);
+	memcpy (p->window + ZIPSTREAM_WINSIZE - wpos, zs->window, wpos);
+	zs->numpoints++;
+}
+
+// restart decompression from point p, NULL = beginning of stream
+static bool zipstream_restart (struct zfile *zf, struct zipstream *zs, struct zipstream_point *p)
+{
+	inflateReset (&zs->strm);
+	zs->eof = false;
+	zs->restarts++;
+	if (!p) {
+		zs->out = 0;
+		zipstream_seekin (zs, 0);
+		return true;
+	}
+	zipstream_seekin (zs, p->in - (p->bits ? 1 : 0));
+	if (p->bits) {
+		uae_u8 c;
+		if (!zipstream_readin (zf, zs, &c, 1))
+			return false;
+		inflatePrime (&zs->strm, p->bits, c >> (8 - p->bits));
+	}
+	inflateSetDictionary (&zs->strm, p->window, ZIPSTREAM_WINSIZE);
+	uae_u32 wpos = p->out % ZIPSTREAM_WINSIZE;
+	memcpy (zs->window + wpos, p->window, ZIPSTREAM_WINSIZE - wpos);
+	memcpy (zs->window, p->window + ZIPSTREAM_WINSIZE - wpos, wpos);
+	zs->out = p->out;
+	return true;
+}
+
+// decompress up to uncompressed offset 'end', bytes from 'start' onwards are copied to dst
+static bool zipstream_inflate (struct zfile *zf, struct zipstream *zs, uae_u64 start, uae_u64 end, uae_u8 *dst)
+{
+	while (zs->out < end) {
+		if (zs->eof)
+			return false;
+		if (!zs->strm.avail_in) {
+			uae_u64 len = zs->csize - zs->inpos;
+			if (len > ZIPSTREAM_INSIZE)
+				len = ZIPSTREAM_INSIZE;
+			if (len == 0 || !zipstream_readin (zf, zs, zs->inbuf, len))
+				return false;
+			zs->strm.next_in = zs->inbuf;
+			zs->strm.avail_in = (uInt)len;
+		}
+		uae_u32 wpos = zs->out % ZIPSTREAM_WINSIZE;
+		uae_u32 room = ZIPSTREAM_WINSIZE - wpos;
+		if (room > end - zs->out)
+			room = (uae_u32)(end - zs->out);
+		zs->strm.next_out = zs->window + wpos;
+		zs->strm.avail_out = room;
+		int ret = inflate (&zs->strm, Z_BLOCK);
+		uae_u32 got = room - zs->strm.avail_out;
+		if (got && zs->out + got > start) {
+			uae_u32 skip = zs->out < start ? (uae_u32)(start - zs->out) : 0;
+			memcpy (dst + (zs->out + skip - start), zs->window + wpos + skip, got - skip);
+		}
+		zs->out += got;
+		if (ret == Z_STREAM_END) {
+			zs->eof = true;
+		} else if (ret != Z_OK && ret != Z_BUF_ERROR) {
+			write_log (_T("ZIP: stream inflate error %d at %lld\n"), ret, zs->out);
+			return false;
+		} else if (ret == Z_BUF_ERROR && !got && zs->strm.avail_in) {
+			return false;
+		}
+		// end of deflate block, not last block
+		if ((zs->strm.data_type & 128) && !(zs->strm.data_type & 64)) {
+			uae_u64 last = zs->numpoints ? zs->points[zs->numpoints - 1].out : 0;
+			if (zs->out > last && zs->out - last >= zs->span)
+				zipstream_addpoint (zs);
+		}
+	}
+	return true;
+}
+
+static uae_u8 *zipstream_getblock (struct zfile *zf, struct zipstream *zs, uae_u64 block)
+{
+	struct zipstream_block *b = NULL;
+	struct zipstream_point *p = NULL;
+
+	zs->tick++;
+	for (int i = 0; i < ZIPSTREAM_BLOCKS; i++) {
+		struct zipstream_block *zb = &zs->blocks[i];
+		if (zb->data && zb->block == block) {
+			zb->lastuse = zs->tick;
+			return zb->data;
+		}
+		if (!b || !zb->data || (b->data && zb->lastuse < b->lastuse))
+			b = zb;
+	}
+	if (!b->data) {
+		b->data = xmalloc (uae_u8, ZIPSTREAM_BLOCKSIZE);
+		if (!b->data)
+			return NULL;
+	}
+	b->lastuse = zs->tick;
+	b->block = -1;
+
+	uae_u64 start = block * ZIPSTREAM_BLOCKSIZE;
+	uae_u64 end = start + ZIPSTREAM_BLOCKSIZE;
+	if (end > zs->size)
+		end = zs->size;
+	// nearest restart point below start
+	for (int i = zs->numpoints - 1; i >= 0; i--) {
+		if (zs->points[i].out <= start) {
+			p = &zs->points[i];
+			break;
+		}
+	}
+	if (start < zs->out || zs->eof) {
+		if (!zipstream_restart (zf, zs, p))
+			return NULL;
+	} else if (p && p->out > zs->out) {
+		if (!zipstream_restart (zf, zs, p))
+			return NULL;
+	}
+	if (!zipstream_inflate (zf, zs, start, end, b->data)) {
+		// force restart next time
+		zs->eof = true;
+		return NULL;
+	}
+	b->block = block;
+	return b->data;
+}
+
+static uae_s64 zipstream_fread (void *data, uae_u64 l1, uae_u64 l2, struct zfile *zf)
+{
+	struct zipstream *zs = (struct zipstream*)zf->userdata;
+	uae_u8 *dataptr = (uae_u8*)data;
+	uae_u64 size = l1 * l2;
+	uae_u64 read = 0;
+
+	if (!size)
+		return 0;
+	if (zf->seek >= zf->size)
+		return 0;
+	if (size > zf->size - zf->seek)
+		size = zf->size - zf->seek;
+	while (read < size) {
+		uae_u64 block = zf->seek / ZIPSTREAM_BLOCKSIZE;
+		uae_u32 offset = (uae_u32)(zf->seek % ZIPSTREAM_BLOCKSIZE);
+		uae_u8 *b = zipstream_getblock (zf, zs, block);
+		if (!b)
+			break;
+		uae_u64 len = ZIPSTREAM_BLOCKSIZE - offset;
+		if (len > size - read)
+			len = size - read;
+		memcpy (dataptr + read, b + offset, (size_t)len);
+		read += len;
+		zf->seek += len;
+	}
+	return read / l1;
+}
+
+static void zipstream_close (struct zfile *zf)
+{
+	struct zipstream *zs = (struct zipstream*)zf->userdata;
+
+	if (!zs)
+		return;
+	unpack_log (_T("ZIP: stream closed, %d restart points, %d restarts\n"), zs->numpoints, zs->restarts);
+	inflateEnd (&zs->strm);
+	for (int i = 0; i < zs->numpoints; i++)
+		xfree (zs->points[i].window);
+	xfree (zs->points);
+	for (int i = 0; i < ZIPSTREAM_BLOCKS; i++)
+		xfree (zs->blocks[i].data);
+}
+
+static struct zfile *zipstream_dup (struct zfile *zf);
+
+// First write converts the file to normal memory file, same as fully unpacked
+// members, writes are not saved back to the archive.
+static uae_s64 zipstream_fwrite (const void *data, uae_u64 l1, uae_u64 l2, struct zfile *zf)
+{
+	uae_s64 seek = zf->seek;
+	uae_u8 *mem;
+
+	if (zf->size > INT_MAX)
+		return 0;
+	mem = xmalloc (uae_u8, (size_t)zf->size);
+	if (!mem)
+		return 0;
+	zf->zfilewrite = NULL;
+	zfile_fseek (zf, 0, SEEK_SET);
+	if (zfile_fread (mem, 1, (size_t)zf->size, zf) != zf->size) {
+		zf->zfilewrite = zipstream_fwrite;
+		zf->seek = seek;
+		xfree (mem);
+		return 0;
+	}
+	if (zf->zfileclose)
+		zf->zfileclose (zf);
+	xfree (zf->userdata);
+	zf->userdata = NULL;
+	zf->zfileread = NULL;
+	zf->zfileclose = NULL;
+	zf->zfiledup = NULL;
+	zf->useparent = 0;
+	zf->dataseek = 0;
+	zf->data = mem;
+	zf->datasize = zf->allocsize = zf->size;
+	zf->seek = seek;
+	write_log (_T("ZIP: '%s' written to, unpacked to memory\n"), zf->name);
+	return zfile_fwrite (data, (size_t)l1, (size_t)l2, zf);
+}
+
+static struct zfile *zipstream_create (struct zfile *archive, const TCHAR *name, uae_u64 pos, uae_u64 csize, uae_u64 size)
+{
+	struct zipstream *zs;
+	struct zfile *z;
+
+	zs = xcalloc (struct zipstream, 1);
+	if (!zs)
+		return NULL;
+	if (inflateInit2 (&zs->strm, -MAX_WBITS) != Z_OK) {
+		xfree (zs);
+		return NULL;
+	}
+	zs->points = xcalloc (struct zipstream_point, ZIPSTREAM_MAXPOINTS);
+	if (!zs->points) {
+		inflateEnd (&zs->strm);
+		xfree (zs);
+		return NULL;
+	}
+	zs->csize = csize;
+	zs->size = size;
+	zs->span = ZIPSTREAM_SPAN;
+	while (zs->size / zs->span > ZIPSTREAM_MAXPOINTS)
+		zs->span *= 2;
+	z = zfile_fopen_parent (archive, name, pos, size);
+	if (!z) {
+		inflateEnd (&zs->strm);
+		xfree (zs->points);
+		xfree (zs);
+		return NULL;
+	}
+	z->useparent = 0;
+	z->dataseek = 1;
+	z->userdata = zs;
+	z->zfileread = zipstream_fread;
+	z->zfileclose = zipstream_close;
+	z->zfilewrite = zipstream_fwrite;
+	z->zfiledup = zipstream_dup;
+	zs->eof = true; // first read starts from the beginning
+	return z;
+}
+
+// independent stream of same member, restart points are not shared
+static struct zfile *zipstream_dup (struct zfile *zf)
+{
+	struct zipstream *zs = (struct zipstream*)zf->userdata;
+	return zipstream_create (zf->parent, zf->name, zf->offset, zs->csize, zs->size);
+}
+
+static struct zfile *zipstream_open (struct znode *zn, unzFile uz)
+{
+	unz_file_info fi;
+	struct zfile *z;
+	uae_u64 pos;
+
+	if (zn->size < ZIPSTREAM_MIN)
+		return NULL;
+	if (unzGetCurrentFileInfo (uz, &fi, NULL, 0, NULL, 0, NULL, 0) != UNZ_OK)
+		return NULL;
+	if (fi.flag & 1) // encrypted
+		return NULL;
+	pos = unzGetCurrentFileZStreamPos (uz);
+	if (!pos || pos + fi.compressed_size > (uae_u64)zfile_size (zn->volume->archive))
+		return NULL;
+	if (fi.compression_method == 0) {
+		// stored, direct view to archive
+		if (fi.compressed_size != zn->size)
+			return NULL;
+		unpack_log (_T("ZIP: '%s' stored, direct access\n"), zn->fullname);
+		z = zfile_fopen_parent (zn->volume->archive, zn->fullname, pos, zn->size);
+		if (z)
+			z->zfilewrite = zipstream_fwrite;
+		return z;
+	}
+	if (fi.compression_method != Z_DEFLATED)
+		return NULL;
+	z = zipstream_create (zn->volume->archive, zn->fullname, pos, fi.compressed_size, zn->size);
+	if (z)
+		unpack_log (_T("ZIP: '%s' streamed, %lu -> %lld bytes\n"), zn->fullname, fi.compressed_size, zn->size);
+	return z;
+}
+
 static struct zfile *archive_do_zip (struct znode *zn, struct zfile *z, int flags)
 {
 	unzFile uz;
@@ -463,8 +837,15 @@ static struct zfile *archive_do_zip (struct znode *zn, struct zfile *z, int flag
 	s = NULL;
 	if (unzOpenCurrentFile (uz) != UNZ_OK)
 		goto error;
-	if (!z)
+	if (!z) {
+		struct zfile *zs = zipstream_open (zn, uz);
+		if (zs) {
+			unzCloseCurrentFile (uz);
+			unzClose (uz);
+			return zs;
+		}
 		z = zfile_fopen_empty (NULL, zn->fullname, zn->size);
+	}
 	if (z) {
 		int err = -1;
 		if (!(flags & FILE_DELAYEDOPEN) || z->size <= PEEK_BYTES) {
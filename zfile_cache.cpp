@@ -0,0 +1,450 @@
+/*
+* UAE - The Un*x Amiga Emulator
+*
+* Persistent cache of decompressed media images
+*
+* Archives, DMS, IPF, xz and other packed images are normally unpacked
+* again each time they are opened. Unpacked result of zfile_fopen() is
+* stored in cache directory and later opens of the same image load it
+* directly. Lookup key is SHA-1 of packed file path and size, archive
+* member path, open mask and image index. Entries also hold modification
+* time and SHA-1 of packed file contents, contents are only hashed again
+* if modification time has changed. Total size is limited by zfile_cache
+* (MB), least recently used entries are deleted first.
+*/
+
+#include "sysconfig.h"
+#include "sysdeps.h"
+
+#include "options.h"
+#include "uae.h"
+#include "zfile.h"
+#include "zarchive.h"
+#include "crc32.h"
+#include "fsdb.h"
+
+#define ZCACHE_MAGIC "UAEZC001"
+#define ZCACHE_HASH 256
+#define ZCACHE_KEYSIZE 20
+// packed files larger than this are not hashed
+#define ZCACHE_MAXSOURCE (1024 * 1024 * 1024)
+#define ZCACHE_CHUNK (1024 * 1024)
+
+struct zcache_entry
+{
+	uae_u8 key[ZCACHE_KEYSIZE];
+	uae_u8 hash[ZCACHE_KEYSIZE];
+	uae_s64 mtime;
+	uae_u64 size;
+	uae_u32 lastuse;
+	struct zcache_entry *next;
+};
+
+static struct zcache_entry *zc_hash[ZCACHE_HASH];
+static TCHAR zc_path[MAX_DPATH];
+static bool zc_initialized, zc_enabled;
+static uae_u64 zc_total, zc_budget;
+static int zc_entries;
+static uae_u32 zc_hits, zc_misses, zc_stores, zc_evicted, zc_validated;
+static uae_u64 zc_hitbytes;
+
+static void zc_keytxt(const uae_u8 *key, char *out)
+{
+	for (int i = 0; i < ZCACHE_KEYSIZE; i++)
+		sprintf(out + i * 2, "%02x", key[i]);
+}
+
+static bool zc_txtkey(const char *s, uae_u8 *key)
+{
+	for (int i = 0; i < ZCACHE_KEYSIZE; i++) {
+		unsigned int v;
+		if (sscanf(s + i * 2, "%2x", &v) != 1)
+			return false;
+		key[i] = v;
+	}
+	return true;
+}
+
+static void zc_filename(const uae_u8 *key, TCHAR *out, const TCHAR *ext)
+{
+	char txt[ZCACHE_KEYSIZE * 2 + 1];
+	zc_keytxt(key, txt);
+	TCHAR *s = au(txt);
+	_stprintf(out, _T("%s%s%s"), zc_path, s, ext);
+	xfree(s);
+}
+
+static struct zcache_entry *zc_find(const uae_u8 *key)
+{
+	struct zcache_entry *e = zc_hash[key[0]];
+	while (e) {
+		if (!memcmp(e->key, key, ZCACHE_KEYSIZE))
+			return e;
+		e = e->next;
+	}
+	return NULL;
+}
+
+static struct zcache_entry *zc_add(const uae_u8 *key, const uae_u8 *hash, uae_s64 mtime, uae_u64 size, uae_u32 lastuse)
+{
+	struct zcache_entry *e = xcalloc(struct zcache_entry, 1);
+	memcpy(e->key, key, ZCACHE_KEYSIZE);
+	memcpy(e->hash, hash, ZCACHE_KEYSIZE);
+	e->mtime = mtime;
+	e->size = size;
+	e->lastuse = lastuse;
+	e->next = zc_hash[key[0]];
+	zc_hash[key[0]] = e;
+	zc_total += size;
+	zc_entries++;
+	return e;
+}
+
+static void zc_remove(struct zcache_entry *e)
+{
+	TCHAR name[MAX_DPATH];
+	struct zcache_entry **p = &zc_hash[e->key[0]];
+	while (*p != e)
+		p = &(*p)->next;
+	*p = e->next;
+	zc_filename(e->key, name, _T(".zc"));
+	my_unlink(name, true);
+	zc_total -= e->size;
+	zc_entries--;
+	xfree(e);
+}
+
+static void zc_saveindex(void)
+{
+	TCHAR name[MAX_DPATH];
+	char line[ZCACHE_KEYSIZE * 4 + 80];
+
+	_stprintf(name, _T("%sindex.txt"), zc_path);
+	struct zfile *f = zfile_fopen(name, _T("wb"), 0);
+	if (!f)
+		return;
+	for (int i = 0; i < ZCACHE_HASH; i++) {
+		for (struct zcache_entry *e = zc_hash[i]; e; e = e->next) {
+			zc_keytxt(e->key, line);
+			line[ZCACHE_KEYSIZE * 2] = ' ';
+			zc_keytxt(e->hash, line + ZCACHE_KEYSIZE * 2 + 1);
+			sprintf(line + ZCACHE_KEYSIZE * 4 + 1, " %lld %llu %u\n", (long long)e->mtime, (unsigned long long)e->size, e->lastuse);
+			zfile_fwrite(line, strlen(line), 1, f);
+		}
+	}
+	zfile_fclose(f);
+}
+
+// entries whose cache file has disappeared are dropped, files of
+// entries in unknown (old) index format are deleted
+static void zc_loadindex(void)
+{
+	TCHAR name[MAX_DPATH];
+	char line[256];
+
+	_stprintf(name, _T("%sindex.txt"), zc_path);
+	struct zfile *f = zfile_fopen(name, _T("rb"), 0);
+	if (!f)
+		return;
+	while (zfile_fgetsa(line, sizeof line, f)) {
+		uae_u8 key[ZCACHE_KEYSIZE], hash[ZCACHE_KEYSIZE];
+		long long mtime;
+		unsigned long long size;
+		unsigned int lastuse;
+		if (strlen(line) < ZCACHE_KEYSIZE * 2 || !zc_txtkey(line, key))
+			continue;
+		zc_filename(key, name, _T(".zc"));
+		if (strlen(line) < ZCACHE_KEYSIZE * 4 + 1 || line[ZCACHE_KEYSIZE * 2] != ' ' || !zc_txtkey(line + ZCACHE_KEYSIZE * 2 + 1, hash) ||
+			sscanf(line + ZCACHE_KEYSIZE * 4 + 1, "%lld %llu %u", &mtime, &size, &lastuse) != 3) {
+			my_unlink(name, true);
+			continue;
+		}
+		if (zc_find(key))
+			continue;
+		if (!my_existsfile(name))
+			continue;
+		zc_add(key, hash, mtime, size, lastuse);
+	}
+	zfile_fclose(f);
+}
+
+static bool zc_init(void)
+{
+	if (zc_initialized)
+		return zc_enabled;
+	zc_initialized = true;
+	if (currprefs.zfile_cache <= 0)
+		return false;
+	zc_budget = (uae_u64)currprefs.zfile_cache * 1024 * 1024;
+	fetch_datapath(zc_path, sizeof zc_path / sizeof(TCHAR));
+	_tcscat(zc_path, _T("ZCache"));
+	if (!my_existsdir(zc_path) && my_mkdir(zc_path)) {
+		write_log(_T("ZCACHE: can't create '%s'\n"), zc_path);
+		return false;
+	}
+	fixtrailing(zc_path);
+	zc_loadindex();
+	zc_enabled = true;
+	write_log(_T("ZCACHE: '%s' %d entries, %lluM/%lluM\n"), zc_path, zc_entries, zc_total >> 20, zc_budget >> 20);
+	return true;
+}
+
+// cache configured and usable, initializes it on first call
+bool zfile_cache_enabled(void)
+{
+	return zc_init();
+}
+
+// delete least recently used entries until size more bytes fit
+static void zc_evict(uae_u64 size)
+{
+	bool changed = false;
+	while (zc_entries > 0 && zc_total + size > zc_budget) {
+		struct zcache_entry *v = NULL;
+		for (int i = 0; i < ZCACHE_HASH; i++) {
+			for (struct zcache_entry *e = zc_hash[i]; e; e = e->next) {
+				if (!v || (uae_s32)(e->lastuse - v->lastuse) < 0)
+					v = e;
+			}
+		}
+		zc_remove(v);
+		zc_evicted++;
+		changed = true;
+	}
+	if (changed)
+		zc_saveindex();
+}
+
+/* SHA-1 of packed file contents, hashed in ZCACHE_CHUNK sized pieces and
+ * the chunk digests hashed together. Only needed when an entry is stored
+ * or its packed file has a new modification time. */
+static bool zc_hashfile(struct zfile *z, uae_u8 *hash)
+{
+	uae_s64 pos = zfile_ftell(z);
+	zfile_fseek(z, 0, SEEK_END);
+	uae_s64 size = zfile_ftell(z);
+	zfile_fseek(z, 0, SEEK_SET);
+	if (size <= 0 || size > ZCACHE_MAXSOURCE) {
+		zfile_fseek(z, pos, SEEK_SET);
+		return false;
+	}
+	int chunks = (int)((size + ZCACHE_CHUNK - 1) / ZCACHE_CHUNK);
+	uae_u8 *digests = xcalloc(uae_u8, chunks * ZCACHE_KEYSIZE);
+	uae_u8 *buf = xmalloc(uae_u8, ZCACHE_CHUNK);
+	int cnt = 0;
+	bool ok = true;
+	while (cnt < chunks) {
+		int len = (int)zfile_fread(buf, 1, ZCACHE_CHUNK, z);
+		if (len <= 0) {
+			ok = false;
+			break;
+		}
+		get_sha1(buf, len, digests + cnt * ZCACHE_KEYSIZE);
+		cnt++;
+	}
+	zfile_fseek(z, pos, SEEK_SET);
+	if (ok)
+		get_sha1(digests, chunks * ZCACHE_KEYSIZE, hash);
+	xfree(buf);
+	xfree(digests);
+	return ok;
+}
+
+static bool zc_mtime(const TCHAR *name, uae_s64 *mtime)
+{
+	struct mystat st;
+	if (!my_stat(name, &st))
+		return false;
+	*mtime = st.mtime.tv_sec;
+	return true;
+}
+
+/* Lookup key of packed file z opened with mask and index: SHA-1 of file
+ * path, size, archive member name, mask and index. Contents are not read. */
+bool zfile_cache_key(struct zfile *z, int mask, int index, uae_u8 *key)
+{
+	if (!zc_init())
+		return false;
+	uae_s64 size = zfile_size(z);
+	if (size <= 0 || size > ZCACHE_MAXSOURCE)
+		return false;
+	char *path = uutf8(z->name);
+	char *member = z->zipname ? uutf8(z->zipname) : NULL;
+	int pathlen = uaestrlen(path) + 1;
+	int memberlen = member ? uaestrlen(member) + 1 : 0;
+	int dlen = pathlen + memberlen + 16;
+	uae_u8 *d = xcalloc(uae_u8, dlen);
+	uae_u8 *p = d;
+	memcpy(p, path, pathlen);
+	p += pathlen;
+	if (member)
+		memcpy(p, member, memberlen);
+	p += memberlen;
+	for (int i = 0; i < 8; i++)
+		p[i] = (uae_u8)(size >> (56 - i * 8));
+	p += 8;
+	p[0] = mask >> 24; p[1] = mask >> 16; p[2] = mask >> 8; p[3] = mask;
+	p[4] = index >> 24; p[5] = index >> 16; p[6] = index >> 8; p[7] = index;
+	get_sha1(d, dlen, key);
+	xfree(d);
+	xfree(member);
+	xfree(path);
+	return true;
+}
+
+/* Cache file: magic, name length, payload size, unpacked file name (UTF-8),
+ * payload. Returns new memory zfile or NULL if not cached. Packed file z is
+ * hashed only if its modification time differs from the cached one. */
+struct zfile *zfile_cache_open(const uae_u8 *key, struct zfile *z, const TCHAR *originalname)
+{
+	TCHAR name[MAX_DPATH];
+	uae_u8 hdr[16];
+	struct zfile *zo = NULL;
+	uae_s64 mtime;
+
+	if (!zc_enabled)
+		return NULL;
+	struct zcache_entry *e = zc_find(key);
+	if (!e) {
+		zc_misses++;
+		return NULL;
+	}
+	if (!zc_mtime(z->name, &mtime)) {
+		zc_misses++;
+		return NULL;
+	}
+	if (mtime != e->mtime) {
+		uae_u8 hash[ZCACHE_KEYSIZE];
+		if (!zc_hashfile(z, hash) || memcmp(hash, e->hash, ZCACHE_KEYSIZE)) {
+			// modified, stored again after unpacking
+			zc_remove(e);
+			zc_saveindex();
+			zc_misses++;
+			return NULL;
+		}
+		// touched or copied but contents unchanged
+		e->mtime = mtime;
+		zc_validated++;
+		zc_saveindex();
+	}
+	zc_filename(key, name, _T(".zc"));
+	struct zfile *f = zfile_fopen(name, _T("rb"), 0);
+	if (f && zfile_fread(hdr, sizeof hdr, 1, f) == 1 && !memcmp(hdr, ZCACHE_MAGIC, 8)) {
+		uae_u32 namelen = (hdr[8] << 24) | (hdr[9] << 16) | (hdr[10] << 8) | hdr[11];
+		uae_u32 size = (hdr[12] << 24) | (hdr[13] << 16) | (hdr[14] << 8) | hdr[15];
+		char *uname = xcalloc(char, MAX_DPATH * 4 + 1);
+		if (namelen < MAX_DPATH * 4 && size > 0 && size <= INT_MAX && (!namelen || zfile_fread(uname, namelen, 1, f) == 1)) {
+			TCHAR *zname = utf8u(uname);
+			zo = zfile_fopen_empty(NULL, zname, size);
+			if (zo) {
+				if (zfile_fread(zo->data, size, 1, f) != 1) {
+					zfile_fclose(zo);
+					zo = NULL;
+				} else {
+					xfree(zo->originalname);
+					zo->originalname = my_strdup(originalname);
+				}
+			}
+			xfree(zname);
+		}
+		xfree(uname);
+	}
+	zfile_fclose(f);
+	if (!zo) {
+		write_log(_T("ZCACHE: '%s' is corrupt\n"), name);
+		zc_remove(e);
+		zc_saveindex();
+		zc_misses++;
+		return NULL;
+	}
+	e->lastuse = (uae_u32)time(NULL);
+	zc_hits++;
+	zc_hitbytes += zo->size;
+	return zo;
+}
+
+/* Store unpacked z of packed file packedname. Streamed archive members
+ * (zfileread set) are not stored, they would have to be unpacked to
+ * memory in full. */
+void zfile_cache_store(const uae_u8 *key, const TCHAR *packedname, struct zfile *z)
+{
+	TCHAR name[MAX_DPATH], tmpname[MAX_DPATH];
+	uae_u8 hdr[16], hash[ZCACHE_KEYSIZE];
+	uae_s64 mtime;
+
+	if (!zc_enabled || zc_find(key) || z->zfileread)
+		return;
+	uae_s64 size = zfile_size(z);
+	if (size <= 0 || size > INT_MAX || (uae_u64)size > zc_budget / 2)
+		return;
+	if (!zc_mtime(packedname, &mtime))
+		return;
+	struct zfile *pf = zfile_fopen(packedname, _T("rb"), 0);
+	if (!pf)
+		return;
+	bool hashed = zc_hashfile(pf, hash);
+	zfile_fclose(pf);
+	if (!hashed)
+		return;
+	char *uname = uutf8(zfile_getname(z));
+	int namelen = uaestrlen(uname);
+	uae_u64 total = sizeof hdr + namelen + size;
+	uae_u8 *data = xmalloc(uae_u8, (size_t)size);
+	uae_s64 pos = zfile_ftell(z);
+	zfile_fseek(z, 0, SEEK_SET);
+	bool ok = zfile_fread(data, (size_t)size, 1, z) == 1;
+	zfile_fseek(z, pos, SEEK_SET);
+	if (ok) {
+		zc_evict(total);
+		memcpy(hdr, ZCACHE_MAGIC, 8);
+		hdr[8] = namelen >> 24; hdr[9] = namelen >> 16; hdr[10] = namelen >> 8; hdr[11] = namelen;
+		hdr[12] = (uae_u8)(size >> 24); hdr[13] = (uae_u8)(size >> 16); hdr[14] = (uae_u8)(size >> 8); hdr[15] = (uae_u8)size;
+		// write to temporary name first, interrupted write must not leave valid looking entry
+		zc_filename(key, tmpname, _T(".tmp"));
+		zc_filename(key, name, _T(".zc"));
+		struct zfile *f = zfile_fopen(tmpname, _T("wb"), 0);
+		if (f) {
+			ok = zfile_fwrite(hdr, sizeof hdr, 1, f) == 1;
+			if (ok && namelen)
+				ok = zfile_fwrite(uname, namelen, 1, f) == 1;
+			if (ok)
+				ok = zfile_fwrite(data, (size_t)size, 1, f) == 1;
+			zfile_fclose(f);
+			if (ok)
+				ok = my_rename(tmpname, name) == 0;
+			if (!ok)
+				my_unlink(tmpname, true);
+		} else {
+			ok = false;
+		}
+		if (ok) {
+			zc_add(key, hash, mtime, total, (uae_u32)time(NULL));
+			zc_stores++;
+			zc_saveindex();
+		} else {
+			write_log(_T("ZCACHE: failed to write '%s'\n"), name);
+		}
+	}
+	xfree(data);
+	xfree(uname);
+}
+
+void zfile_cache_exit(void)
+{
+	if (zc_enabled) {
+		zc_saveindex();
+		write_log(_T("ZCACHE: %u hits (%lluK not unpacked, %u rehashed), %u misses, %u stored, %u evicted, %d entries %lluK\n"),
+			zc_hits, zc_hitbytes >> 10, zc_validated, zc_misses, zc_stores, zc_evicted, zc_entries, zc_total >> 10);
+	}
+	for (int i = 0; i < ZCACHE_HASH; i++) {
+		while (zc_hash[i]) {
+			struct zcache_entry *e = zc_hash[i];
+			zc_hash[i] = e->next;
+			xfree(e);
+		}
+	}
+	zc_total = 0;
+	zc_entries = 0;
+	zc_initialized = false;
+	zc_enabled = false;
+}